@@ -0,0 +1,302 @@
+#ifndef Q_CRT_ALGORITHM_PARALLEL_IMPLEMENTATION
+#define Q_CRT_ALGORITHM_PARALLEL_IMPLEMENTATION
+namespace DETAIL
+{
+	// count of elements below which parallel sorting falls back to the single-threaded sort
+	inline constexpr std::size_t kParallelSortThreshold = 1U << 14U;
+	// count of sorted partitions per worker, more partitions give better balancing through the stealing but cost more merge rounds
+	inline constexpr std::size_t kParallelSortPartitionsPerWorker = 4U;
+
+	/*
+	 * range of task indices owned by a single worker
+	 * owner takes tasks from the front, while idle workers steal them from the back
+	 */
+	struct alignas(64) ParallelQueue_t
+	{
+		/// take next task of the own queue
+		/// @returns: true if task has been taken and stored into @a`pnTask`, false if the queue is empty
+		bool PopFront(std::size_t* pnTask)
+		{
+			Lock();
+			const bool bHasTask = (this->nFront < this->nBack);
+			if (bHasTask)
+				*pnTask = this->nFront++;
+			Unlock();
+
+			return bHasTask;
+		}
+
+		/// steal last task of the queue owned by the other worker
+		/// @returns: true if task has been taken and stored into @a`pnTask`, false if the queue is empty
+		bool PopBack(std::size_t* pnTask)
+		{
+			Lock();
+			const bool bHasTask = (this->nFront < this->nBack);
+			if (bHasTask)
+				*pnTask = --this->nBack;
+			Unlock();
+
+			return bHasTask;
+		}
+
+		void Lock()
+		{
+			while (this->flagLock.test_and_set(std::memory_order_acquire))
+			{
+				while (this->flagLock.test(std::memory_order_relaxed))
+				{
+				#ifdef Q_ISA_SSE2
+					::_mm_pause();
+				#else
+					std::this_thread::yield();
+				#endif
+				}
+			}
+		}
+
+		void Unlock()
+		{
+			this->flagLock.clear(std::memory_order_release);
+		}
+
+		std::atomic_flag flagLock = { };
+		std::size_t nFront = 0U;
+		std::size_t nBack = 0U;
+	};
+
+	/*
+	 * shared state of the single parallel sort invocation
+	 * all the work is split into phases (partitions sort, merge rounds and final copy), each of which is a set of independent tasks identified by index.
+	 * every merge round consists of two phases, the first finds splits of the output along the merge path and the second one merges the segments, since merging moves elements out of the runs that are still read by the searches
+	 * tasks of the phase are evenly distributed over the worker queues, and phases are separated with a barrier
+	 */
+	template <typename T, typename C>
+	struct ParallelSort_t
+	{
+		enum EPhase : int
+		{
+			PHASE_SORT = 0,
+			PHASE_SPLIT,
+			PHASE_MERGE,
+			PHASE_COPY,
+			PHASE_DONE
+		};
+
+		/// @returns: offset of the partition boundary with given index
+		[[nodiscard]] std::size_t GetBound(const std::size_t nPartition) const
+		{
+			return (nPartition >= this->nPartitionCount) ? this->nCount : (this->nCount / this->nPartitionCount) * nPartition + Min(nPartition, this->nCount % this->nPartitionCount);
+		}
+
+		/// prepare tasks of the next phase, called by the barrier when all workers have completed the current one
+		void NextPhase()
+		{
+			if (this->nPhase == PHASE_SORT)
+			{
+				// first merge round moves runs from the input to the buffer
+				this->nPhase = PHASE_SPLIT;
+				this->nRunWidth = 1U;
+				this->pSource = this->pData;
+				this->pDestination = this->pBuffer;
+			}
+			else if (this->nPhase == PHASE_SPLIT)
+				this->nPhase = PHASE_MERGE;
+			else if (this->nPhase == PHASE_MERGE)
+			{
+				// every next round swaps roles of the input and the buffer
+				this->nPhase = PHASE_SPLIT;
+				this->nRunWidth <<= 1U;
+				std::swap(this->pSource, this->pDestination);
+
+				// check if all runs have been merged, and move them back to the input if they ended up in the buffer
+				if (this->nRunWidth >= this->nPartitionCount)
+				{
+					this->nPhase = (this->pSource != this->pData ? PHASE_COPY : PHASE_DONE);
+					this->pDestination = this->pData;
+				}
+			}
+			else
+				this->nPhase = PHASE_DONE;
+
+			// every phase consists of as much tasks as partitions, each of them processes approximately equal count of elements
+			if (this->nPhase != PHASE_DONE)
+				Distribute(this->nPartitionCount);
+		}
+
+		/// evenly split task indices [0 .. @a`nTaskCount`) over the worker queues
+		void Distribute(const std::size_t nTaskCount)
+		{
+			for (std::size_t i = 0U; i < this->nWorkerCount; ++i)
+			{
+				this->arrQueues[i].nFront = (nTaskCount * i) / this->nWorkerCount;
+				this->arrQueues[i].nBack = (nTaskCount * (i + 1U)) / this->nWorkerCount;
+			}
+		}
+
+		void RunTask(const std::size_t nTask)
+		{
+			switch (this->nPhase)
+			{
+			case PHASE_SORT:
+			{
+				Sort(this->pData + GetBound(nTask), this->pData + GetBound(nTask + 1U), this->fnCompare);
+				break;
+			}
+			case PHASE_SPLIT:
+				[[fallthrough]];
+			case PHASE_MERGE:
+			{
+				// each pair of runs is merged by the (2 * run width) tasks, every of which produces own segment of the output
+				const std::size_t nSegmentCount = this->nRunWidth << 1U;
+				const std::size_t nPair = nTask / nSegmentCount;
+				const std::size_t nSegment = nTask % nSegmentCount;
+
+				const std::size_t nLeftBegin = GetBound(nPair * nSegmentCount);
+				const std::size_t nRightBegin = GetBound(nPair * nSegmentCount + this->nRunWidth);
+				const std::size_t nRightEnd = GetBound((nPair + 1U) * nSegmentCount);
+
+				T* pLeft = this->pSource + nLeftBegin;
+				T* pRight = this->pSource + nRightBegin;
+				const std::size_t nLeftCount = nRightBegin - nLeftBegin;
+				const std::size_t nRightCount = nRightEnd - nRightBegin;
+				const std::size_t nTotalCount = nLeftCount + nRightCount;
+
+				const std::size_t nOutputBegin = (nTotalCount / nSegmentCount) * nSegment + Min(nSegment, nTotalCount % nSegmentCount);
+
+				if (this->nPhase == PHASE_SPLIT)
+				{
+					this->arrSplits[nTask] = MergePathSplit(pLeft, nLeftCount, pRight, nRightCount, nOutputBegin);
+					break;
+				}
+
+				const std::size_t nOutputEnd = (nTotalCount / nSegmentCount) * (nSegment + 1U) + Min(nSegment + 1U, nTotalCount % nSegmentCount);
+				const std::size_t nLeftSplitBegin = this->arrSplits[nTask];
+				const std::size_t nLeftSplitEnd = (nSegment + 1U < nSegmentCount ? this->arrSplits[nTask + 1U] : nLeftCount);
+
+				Merge(pLeft + nLeftSplitBegin, pLeft + nLeftSplitEnd, pRight + (nOutputBegin - nLeftSplitBegin), pRight + (nOutputEnd - nLeftSplitEnd), this->pDestination + nLeftBegin + nOutputBegin, this->fnCompare);
+				break;
+			}
+			case PHASE_COPY:
+			{
+				T* pCurrentSource = this->pSource + GetBound(nTask);
+				T* pCurrentDestination = this->pDestination + GetBound(nTask);
+				for (T* pSourceEnd = this->pSource + GetBound(nTask + 1U); pCurrentSource != pSourceEnd; )
+					*pCurrentDestination++ = std::move(*pCurrentSource++);
+
+				break;
+			}
+			default:
+				break;
+			}
+		}
+
+		/// find the split of the merge output at @a`nDiagonal` position with the binary search along the merge path
+		/// @returns: count of elements of the left range that precede the split
+		std::size_t MergePathSplit(const T* pLeft, const std::size_t nLeftCount, const T* pRight, const std::size_t nRightCount, const std::size_t nDiagonal)
+		{
+			std::size_t nLow = (nDiagonal > nRightCount ? nDiagonal - nRightCount : 0U);
+			std::size_t nHigh = Min(nDiagonal, nLeftCount);
+
+			while (nLow < nHigh)
+			{
+				const std::size_t nMiddle = nLow + ((nHigh - nLow) >> 1U);
+
+				// elements of the left range precede equivalent elements of the right range
+				if (!this->fnCompare(pRight[nDiagonal - nMiddle - 1U], pLeft[nMiddle]))
+					nLow = nMiddle + 1U;
+				else
+					nHigh = nMiddle;
+			}
+
+			return nLow;
+		}
+
+		/// process own tasks of the current phase, then steal remaining tasks of the other workers
+		void Work(const std::size_t nWorker)
+		{
+			std::size_t nTask;
+			while (this->arrQueues[nWorker].PopFront(&nTask))
+				RunTask(nTask);
+
+			for (std::size_t i = 1U; i < this->nWorkerCount; ++i)
+			{
+				ParallelQueue_t& queueVictim = this->arrQueues[(nWorker + i) % this->nWorkerCount];
+				while (queueVictim.PopBack(&nTask))
+					RunTask(nTask);
+			}
+		}
+
+		T* pData;
+		T* pBuffer;
+		T* pSource;
+		T* pDestination;
+		std::size_t nCount;
+		std::size_t nPartitionCount;
+		std::size_t nWorkerCount;
+		std::size_t nRunWidth;
+		EPhase nPhase;
+		C fnCompare;
+		ParallelQueue_t* arrQueues;
+		// count of left run elements that precede the output segment of every merge task
+		std::size_t* arrSplits;
+	};
+}
+
+/// multi-threaded sort of elements in range, alternative of 'std::sort(std::execution::par, ...)'
+/// @param[in] nThreadCount count of threads to perform sorting with, including the calling thread, or 0 to use count of hardware threads
+/// @remarks: sorts elements in range [@a`pBegin` .. @a`pEnd`) in ascending order defined by @a`fnCompare`, the order of equivalent elements is not guaranteed to be preserved. input is split into partitions that are sorted by the work-stealing set of workers, then sorted partitions are merged with the parallel merge rounds. requires temporary buffer of the same size as input. @a`fnCompare` must be safe to call concurrently
+template <typename T, typename C = Less_t> requires (std::is_default_constructible_v<T> && std::is_move_assignable_v<T>)
+void ParallelSort(T* pBegin, T* pEnd, std::size_t nThreadCount = 0U, C fnCompare = C())
+{
+	const std::size_t nCount = static_cast<std::size_t>(pEnd - pBegin);
+
+	if (nThreadCount == 0U)
+		nThreadCount = Max(std::thread::hardware_concurrency(), 1U);
+
+	// limit count of workers, so each of them would have enough of work
+	nThreadCount = Min(nThreadCount, nCount / DETAIL::kParallelSortThreshold);
+
+	if (nThreadCount <= 1U)
+	{
+		Sort(pBegin, pEnd, fnCompare);
+		return;
+	}
+
+	// round partitions count up to the power of two, so each merge round has no unpaired runs
+	std::size_t nPartitionCount = 1U;
+	while (nPartitionCount < nThreadCount * DETAIL::kParallelSortPartitionsPerWorker)
+		nPartitionCount <<= 1U;
+
+	const std::unique_ptr<T[]> pBuffer(new T[nCount]);
+	const std::unique_ptr<DETAIL::ParallelQueue_t[]> arrQueues(new DETAIL::ParallelQueue_t[nThreadCount]);
+	const std::unique_ptr<std::size_t[]> arrSplits(new std::size_t[nPartitionCount]);
+
+	DETAIL::ParallelSort_t<T, C> context = { pBegin, pBuffer.get(), pBegin, pBuffer.get(), nCount, nPartitionCount, nThreadCount, 0U, DETAIL::ParallelSort_t<T, C>::PHASE_SORT, fnCompare, arrQueues.get(), arrSplits.get() };
+	context.Distribute(nPartitionCount);
+
+	auto fnOnPhaseCompletion = [&context]() noexcept
+	{
+		context.NextPhase();
+	};
+	std::barrier barrierPhase(static_cast<std::ptrdiff_t>(nThreadCount), fnOnPhaseCompletion);
+
+	auto fnWorker = [&context, &barrierPhase](const std::size_t nWorker)
+	{
+		while (context.nPhase != DETAIL::ParallelSort_t<T, C>::PHASE_DONE)
+		{
+			context.Work(nWorker);
+			barrierPhase.arrive_and_wait();
+		}
+	};
+
+	const std::unique_ptr<std::thread[]> arrThreads(new std::thread[nThreadCount - 1U]);
+	for (std::size_t i = 1U; i < nThreadCount; ++i)
+		arrThreads[i - 1U] = std::thread(fnWorker, i);
+
+	// calling thread participates as the first worker
+	fnWorker(0U);
+
+	for (std::size_t i = 0U; i < nThreadCount - 1U; ++i)
+		arrThreads[i].join();
+}
+#endif
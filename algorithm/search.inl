@@ -0,0 +1,176 @@
+#ifndef Q_CRT_ALGORITHM_SEARCH_IMPLEMENTATION
+#define Q_CRT_ALGORITHM_SEARCH_IMPLEMENTATION
+/*
+ * static search index over the sorted array, laid out in the Eytzinger (BFS) order
+ * - node at index 'k' has children at '2k' and '2k + 1', index 0 is unused. top levels of the tree share few cache lines and stay hot,
+ *   while descendants of the next levels lay contiguous, so they are prefetched few iterations ahead
+ * - doesn't own the storage, elements are copied into the caller-supplied buffer that should be aligned to the cache line
+ */
+template <typename T, typename C = Less_t> requires (std::is_copy_assignable_v<T>)
+class EytzingerIndex_t
+{
+public:
+	/// @returns: count of elements of the storage required to index @a`nCount` elements
+	[[nodiscard]] static constexpr std::size_t GetStorageCount(const std::size_t nCount)
+	{
+		return nCount + 1U;
+	}
+
+	/// @param[in] pSortedBegin,pSortedEnd range of elements sorted in order defined by @a`fnCompare`
+	/// @param[in] pStorage buffer that is large enough to hold @code GetStorageCount(pSortedEnd - pSortedBegin) @endcode elements
+	constexpr EytzingerIndex_t(const T* pSortedBegin, const T* pSortedEnd, T* pStorage, C fnCompare = C()) :
+		pStorage(pStorage), nCount(static_cast<std::size_t>(pSortedEnd - pSortedBegin)), fnCompare(fnCompare)
+	{
+		std::size_t nSortedIndex = 0U;
+		Build(1U, pSortedBegin, nSortedIndex);
+	}
+
+	/// find the first element that isn't ordered before the given value, alternative of 'std::lower_bound()'
+	/// @returns: pointer to the first element of the index for which @a`fnCompare(element, value)` is false, null if there is no such element
+	template <typename V>
+	[[nodiscard]] const T* LowerBound(const V& value) const
+	{
+		std::size_t k = 1U;
+		while (k <= this->nCount)
+		{
+			DETAIL::Prefetch(this->pStorage + k * kPrefetchStride);
+			k = k * 2U + (this->fnCompare(this->pStorage[k], value) ? 1U : 0U);
+		}
+
+		// cancel the trailing right turns and the last left turn to get the node where the search went left for the last time
+		k >>= std::countr_one(k) + 1;
+		return (k != 0U ? this->pStorage + k : nullptr);
+	}
+
+	/// find the first element that is ordered after the given value, alternative of 'std::upper_bound()'
+	/// @returns: pointer to the first element of the index for which @a`fnCompare(value, element)` is true, null if there is no such element
+	template <typename V>
+	[[nodiscard]] const T* UpperBound(const V& value) const
+	{
+		std::size_t k = 1U;
+		while (k <= this->nCount)
+		{
+			DETAIL::Prefetch(this->pStorage + k * kPrefetchStride);
+			k = k * 2U + (this->fnCompare(value, this->pStorage[k]) ? 0U : 1U);
+		}
+
+		k >>= std::countr_one(k) + 1;
+		return (k != 0U ? this->pStorage + k : nullptr);
+	}
+
+private:
+	/// assign sorted elements to the nodes with the in-order traversal of the implicit tree
+	constexpr void Build(const std::size_t k, const T* pSorted, std::size_t& nSortedIndex)
+	{
+		if (k > this->nCount)
+			return;
+
+		Build(k * 2U, pSorted, nSortedIndex);
+		this->pStorage[k] = pSorted[nSortedIndex++];
+		Build(k * 2U + 1U, pSorted, nSortedIndex);
+	}
+
+	// distance to the descendants that are few levels below, so all of them fit into the single cache line
+	static constexpr std::size_t kPrefetchStride = (sizeof(T) < 64U ? 64U / sizeof(T) : 1U);
+
+	T* pStorage;
+	std::size_t nCount;
+	C fnCompare;
+};
+
+/*
+ * static search index over the sorted array, laid out in the implicit cache-line-blocked B-tree (S-tree) order
+ * - every node is a block of keys that fits the single cache line, node 'k' has children at 'k * (B + 1) + i + 1' for 'i' in [0 .. B],
+ *   so the lookup touches one cache line per level and the in-node search is a branchless count that can be vectorized
+ * - last node is padded with copies of the greatest element
+ * - doesn't own the storage, elements are copied into the caller-supplied buffer that should be aligned to the cache line
+ */
+template <typename T, typename C = Less_t> requires (std::is_copy_assignable_v<T>)
+class BlockTreeIndex_t
+{
+public:
+	// count of keys in the single node
+	static constexpr std::size_t kNodeCount = (sizeof(T) < 64U ? 64U / sizeof(T) : 1U);
+
+	/// @returns: count of elements of the storage required to index @a`nCount` elements
+	[[nodiscard]] static constexpr std::size_t GetStorageCount(const std::size_t nCount)
+	{
+		return ((nCount + kNodeCount - 1U) / kNodeCount) * kNodeCount;
+	}
+
+	/// @param[in] pSortedBegin,pSortedEnd non-empty range of elements sorted in order defined by @a`fnCompare`
+	/// @param[in] pStorage buffer that is large enough to hold @code GetStorageCount(pSortedEnd - pSortedBegin) @endcode elements
+	constexpr BlockTreeIndex_t(const T* pSortedBegin, const T* pSortedEnd, T* pStorage, C fnCompare = C()) :
+		pStorage(pStorage), nNodeCount(GetStorageCount(static_cast<std::size_t>(pSortedEnd - pSortedBegin)) / kNodeCount), fnCompare(fnCompare)
+	{
+		std::size_t nSortedIndex = 0U;
+		Build(0U, pSortedBegin, static_cast<std::size_t>(pSortedEnd - pSortedBegin), nSortedIndex);
+	}
+
+	/// find the first element that isn't ordered before the given value, alternative of 'std::lower_bound()'
+	/// @returns: pointer to the first element of the index for which @a`fnCompare(element, value)` is false, null if there is no such element
+	template <typename V>
+	[[nodiscard]] const T* LowerBound(const V& value) const
+	{
+		const T* pResult = nullptr;
+
+		for (std::size_t k = 0U; k < this->nNodeCount;)
+		{
+			const T* pNode = this->pStorage + k * kNodeCount;
+
+			// count keys of the node ordered before the value
+			std::size_t nIndex = 0U;
+			for (std::size_t i = 0U; i < kNodeCount; ++i)
+				nIndex += (this->fnCompare(pNode[i], value) ? 1U : 0U);
+
+			pResult = (nIndex < kNodeCount ? pNode + nIndex : pResult);
+			k = k * (kNodeCount + 1U) + nIndex + 1U;
+		}
+
+		return pResult;
+	}
+
+	/// find the first element that is ordered after the given value, alternative of 'std::upper_bound()'
+	/// @returns: pointer to the first element of the index for which @a`fnCompare(value, element)` is true, null if there is no such element
+	template <typename V>
+	[[nodiscard]] const T* UpperBound(const V& value) const
+	{
+		const T* pResult = nullptr;
+
+		for (std::size_t k = 0U; k < this->nNodeCount;)
+		{
+			const T* pNode = this->pStorage + k * kNodeCount;
+
+			// count keys of the node not ordered after the value
+			std::size_t nIndex = 0U;
+			for (std::size_t i = 0U; i < kNodeCount; ++i)
+				nIndex += (this->fnCompare(value, pNode[i]) ? 0U : 1U);
+
+			pResult = (nIndex < kNodeCount ? pNode + nIndex : pResult);
+			k = k * (kNodeCount + 1U) + nIndex + 1U;
+		}
+
+		return pResult;
+	}
+
+private:
+	/// assign sorted elements to the nodes with the in-order traversal of the implicit tree
+	constexpr void Build(const std::size_t k, const T* pSorted, const std::size_t nSortedCount, std::size_t& nSortedIndex)
+	{
+		if (k >= this->nNodeCount)
+			return;
+
+		for (std::size_t i = 0U; i < kNodeCount; ++i)
+		{
+			Build(k * (kNodeCount + 1U) + i + 1U, pSorted, nSortedCount, nSortedIndex);
+			this->pStorage[k * kNodeCount + i] = (nSortedIndex < nSortedCount ? pSorted[nSortedIndex++] : pSorted[nSortedCount - 1U]);
+		}
+
+		Build(k * (kNodeCount + 1U) + kNodeCount + 1U, pSorted, nSortedCount, nSortedIndex);
+	}
+
+	T* pStorage;
+	std::size_t nNodeCount;
+	C fnCompare;
+};
+#endif
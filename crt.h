@@ -9,6 +9,19 @@
 #include <limits>
 // used: [stl] bit_cast
 #include <bit>
+// used: [stl] move, swap
+#include <utility>
+
+#ifdef Q_CRT_ALGORITHM_PARALLEL
+// used: [stl] thread
+#include <thread>
+// used: [stl] atomic, atomic_flag
+#include <atomic>
+// used: [stl] barrier
+#include <barrier>
+// used: [stl] unique_ptr
+#include <memory>
+#endif
 
 #if defined(Q_COMPILER_CLANG) || defined(Q_COMPILER_GCC)
 #include <x86intrin.h>
@@ -100,6 +113,638 @@ namespace CRT
 	{
 		return (value < minimal) ? minimal : (value > maximal) ? maximal : value;
 	}
+
+	/// alternative of 'std::less<>'
+	struct Less_t
+	{
+		template <typename L, typename R>
+		[[nodiscard]] Q_INLINE constexpr bool operator()(const L& left, const R& right) const noexcept(noexcept(left < right))
+		{
+			return left < right;
+		}
+	};
+
+	namespace DETAIL
+	{
+		/// hint the processor to fetch the cache line containing given address
+		Q_INLINE inline void Prefetch(const void* pAddress)
+		{
+		#if defined(Q_COMPILER_CLANG) || defined(Q_COMPILER_GCC)
+			::__builtin_prefetch(pAddress);
+		#elif defined(Q_COMPILER_MSC) && !defined(Q_ARCH_ARM64)
+			::_mm_prefetch(static_cast<const char*>(pAddress), _MM_HINT_T0);
+		#else
+			static_cast<void>(pAddress);
+		#endif
+		}
+
+		/*
+		 * vector operations over the packed elements of given type, used by the array algorithms
+		 * - 'Min()' and 'Max()' return the second operand when either of floating-point operands is NaN
+		 */
+		template <typename T>
+		struct SimdTraits_t
+		{
+			static constexpr bool kIsSupported = false;
+		};
+
+	#if defined(Q_ISA_AVX2)
+		template <>
+		struct SimdTraits_t<float>
+		{
+			using Vector_t = __m256;
+			static constexpr bool kIsSupported = true;
+			static constexpr std::size_t kLaneCount = sizeof(Vector_t) / sizeof(float);
+
+			Q_INLINE static Vector_t Load(const float* pSource) { return ::_mm256_loadu_ps(pSource); }
+			Q_INLINE static void Store(float* pDestination, const Vector_t vecValue) { ::_mm256_storeu_ps(pDestination, vecValue); }
+			Q_INLINE static Vector_t Broadcast(const float flValue) { return ::_mm256_set1_ps(flValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_ps(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_ps(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<double>
+		{
+			using Vector_t = __m256d;
+			static constexpr bool kIsSupported = true;
+			static constexpr std::size_t kLaneCount = sizeof(Vector_t) / sizeof(double);
+
+			Q_INLINE static Vector_t Load(const double* pSource) { return ::_mm256_loadu_pd(pSource); }
+			Q_INLINE static void Store(double* pDestination, const Vector_t vecValue) { ::_mm256_storeu_pd(pDestination, vecValue); }
+			Q_INLINE static Vector_t Broadcast(const double dbValue) { return ::_mm256_set1_pd(dbValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_pd(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_pd(vecLeft, vecRight); }
+		};
+
+		// common operations of the packed integers
+		template <typename T>
+		struct SimdIntegerTraits_t
+		{
+			using Vector_t = __m256i;
+			static constexpr bool kIsSupported = true;
+			static constexpr std::size_t kLaneCount = sizeof(Vector_t) / sizeof(T);
+
+			Q_INLINE static Vector_t Load(const T* pSource) { return ::_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSource)); }
+			Q_INLINE static void Store(T* pDestination, const Vector_t vecValue) { ::_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDestination), vecValue); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::int8_t> : SimdIntegerTraits_t<std::int8_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::int8_t iValue) { return ::_mm256_set1_epi8(iValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_epi8(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_epi8(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::uint8_t> : SimdIntegerTraits_t<std::uint8_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::uint8_t uValue) { return ::_mm256_set1_epi8(static_cast<char>(uValue)); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_epu8(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_epu8(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::int16_t> : SimdIntegerTraits_t<std::int16_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::int16_t iValue) { return ::_mm256_set1_epi16(iValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_epi16(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_epi16(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::uint16_t> : SimdIntegerTraits_t<std::uint16_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::uint16_t uValue) { return ::_mm256_set1_epi16(static_cast<short>(uValue)); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_epu16(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_epu16(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::int32_t> : SimdIntegerTraits_t<std::int32_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::int32_t iValue) { return ::_mm256_set1_epi32(iValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_epi32(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_epi32(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::uint32_t> : SimdIntegerTraits_t<std::uint32_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::uint32_t uValue) { return ::_mm256_set1_epi32(static_cast<int>(uValue)); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_min_epu32(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm256_max_epu32(vecLeft, vecRight); }
+		};
+	#elif defined(Q_ISA_SSE2)
+		template <>
+		struct SimdTraits_t<float>
+		{
+			using Vector_t = __m128;
+			static constexpr bool kIsSupported = true;
+			static constexpr std::size_t kLaneCount = sizeof(Vector_t) / sizeof(float);
+
+			Q_INLINE static Vector_t Load(const float* pSource) { return ::_mm_loadu_ps(pSource); }
+			Q_INLINE static void Store(float* pDestination, const Vector_t vecValue) { ::_mm_storeu_ps(pDestination, vecValue); }
+			Q_INLINE static Vector_t Broadcast(const float flValue) { return ::_mm_set1_ps(flValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_min_ps(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_max_ps(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<double>
+		{
+			using Vector_t = __m128d;
+			static constexpr bool kIsSupported = true;
+			static constexpr std::size_t kLaneCount = sizeof(Vector_t) / sizeof(double);
+
+			Q_INLINE static Vector_t Load(const double* pSource) { return ::_mm_loadu_pd(pSource); }
+			Q_INLINE static void Store(double* pDestination, const Vector_t vecValue) { ::_mm_storeu_pd(pDestination, vecValue); }
+			Q_INLINE static Vector_t Broadcast(const double dbValue) { return ::_mm_set1_pd(dbValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_min_pd(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_max_pd(vecLeft, vecRight); }
+		};
+
+		// common operations of the packed integers
+		template <typename T>
+		struct SimdIntegerTraits_t
+		{
+			using Vector_t = __m128i;
+			static constexpr bool kIsSupported = true;
+			static constexpr std::size_t kLaneCount = sizeof(Vector_t) / sizeof(T);
+
+			Q_INLINE static Vector_t Load(const T* pSource) { return ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource)); }
+			Q_INLINE static void Store(T* pDestination, const Vector_t vecValue) { ::_mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination), vecValue); }
+
+			/// @returns: elements of @a`vecLeft` where @a`vecMask` is set, elements of @a`vecRight` otherwise
+			Q_INLINE static Vector_t Select(const Vector_t vecMask, const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_or_si128(::_mm_and_si128(vecMask, vecLeft), ::_mm_andnot_si128(vecMask, vecRight)); }
+		};
+
+		// @note: SSE2 lacks min/max of the most integer types, those are emulated either with the sign bias or with the compare and select
+		template <>
+		struct SimdTraits_t<std::int8_t> : SimdIntegerTraits_t<std::int8_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::int8_t iValue) { return ::_mm_set1_epi8(iValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { const __m128i vecBias = ::_mm_set1_epi8(static_cast<char>(0x80)); return ::_mm_xor_si128(::_mm_min_epu8(::_mm_xor_si128(vecLeft, vecBias), ::_mm_xor_si128(vecRight, vecBias)), vecBias); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { const __m128i vecBias = ::_mm_set1_epi8(static_cast<char>(0x80)); return ::_mm_xor_si128(::_mm_max_epu8(::_mm_xor_si128(vecLeft, vecBias), ::_mm_xor_si128(vecRight, vecBias)), vecBias); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::uint8_t> : SimdIntegerTraits_t<std::uint8_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::uint8_t uValue) { return ::_mm_set1_epi8(static_cast<char>(uValue)); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_min_epu8(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_max_epu8(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::int16_t> : SimdIntegerTraits_t<std::int16_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::int16_t iValue) { return ::_mm_set1_epi16(iValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_min_epi16(vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return ::_mm_max_epi16(vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::uint16_t> : SimdIntegerTraits_t<std::uint16_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::uint16_t uValue) { return ::_mm_set1_epi16(static_cast<short>(uValue)); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { const __m128i vecBias = ::_mm_set1_epi16(static_cast<short>(0x8000)); return ::_mm_xor_si128(::_mm_min_epi16(::_mm_xor_si128(vecLeft, vecBias), ::_mm_xor_si128(vecRight, vecBias)), vecBias); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { const __m128i vecBias = ::_mm_set1_epi16(static_cast<short>(0x8000)); return ::_mm_xor_si128(::_mm_max_epi16(::_mm_xor_si128(vecLeft, vecBias), ::_mm_xor_si128(vecRight, vecBias)), vecBias); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::int32_t> : SimdIntegerTraits_t<std::int32_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::int32_t iValue) { return ::_mm_set1_epi32(iValue); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { return Select(::_mm_cmplt_epi32(vecLeft, vecRight), vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { return Select(::_mm_cmpgt_epi32(vecLeft, vecRight), vecLeft, vecRight); }
+		};
+
+		template <>
+		struct SimdTraits_t<std::uint32_t> : SimdIntegerTraits_t<std::uint32_t>
+		{
+			Q_INLINE static Vector_t Broadcast(const std::uint32_t uValue) { return ::_mm_set1_epi32(static_cast<int>(uValue)); }
+			Q_INLINE static Vector_t Min(const Vector_t vecLeft, const Vector_t vecRight) { const __m128i vecBias = ::_mm_set1_epi32(static_cast<int>(0x80000000)); return Select(::_mm_cmplt_epi32(::_mm_xor_si128(vecLeft, vecBias), ::_mm_xor_si128(vecRight, vecBias)), vecLeft, vecRight); }
+			Q_INLINE static Vector_t Max(const Vector_t vecLeft, const Vector_t vecRight) { const __m128i vecBias = ::_mm_set1_epi32(static_cast<int>(0x80000000)); return Select(::_mm_cmpgt_epi32(::_mm_xor_si128(vecLeft, vecBias), ::_mm_xor_si128(vecRight, vecBias)), vecLeft, vecRight); }
+		};
+	#endif
+
+		// count of elements below which sorting falls back to insertion sort
+		inline constexpr std::ptrdiff_t kSortInsertionThreshold = 16;
+
+		template <typename T, typename C>
+		constexpr void InsertionSort(T* pBegin, T* pEnd, C& fnCompare)
+		{
+			if (pEnd - pBegin < 2)
+				return;
+
+			for (T* pCurrent = pBegin + 1; pCurrent != pEnd; ++pCurrent)
+			{
+				T value = std::move(*pCurrent);
+
+				T* pHole = pCurrent;
+				for (; pHole != pBegin && fnCompare(value, pHole[-1]); --pHole)
+					*pHole = std::move(pHole[-1]);
+
+				*pHole = std::move(value);
+			}
+		}
+
+		template <typename T, typename C>
+		constexpr void HeapSiftDown(T* pBase, std::size_t nIndex, const std::size_t nCount, C& fnCompare)
+		{
+			T value = std::move(pBase[nIndex]);
+
+			for (std::size_t nChild; (nChild = nIndex * 2U + 1U) < nCount; nIndex = nChild)
+			{
+				// select the greater child
+				if (nChild + 1U < nCount && fnCompare(pBase[nChild], pBase[nChild + 1U]))
+					++nChild;
+
+				if (!fnCompare(value, pBase[nChild]))
+					break;
+
+				pBase[nIndex] = std::move(pBase[nChild]);
+			}
+
+			pBase[nIndex] = std::move(value);
+		}
+
+		template <typename T, typename C>
+		constexpr void HeapSort(T* pBegin, T* pEnd, C& fnCompare)
+		{
+			const std::size_t nCount = static_cast<std::size_t>(pEnd - pBegin);
+
+			// build max-heap
+			for (std::size_t i = nCount / 2U; i-- > 0U;)
+				HeapSiftDown(pBegin, i, nCount, fnCompare);
+
+			// extract elements from the heap in descending order
+			for (std::size_t i = nCount; i-- > 1U;)
+			{
+				std::swap(pBegin[0], pBegin[i]);
+				HeapSiftDown(pBegin, 0U, i, fnCompare);
+			}
+		}
+
+		/// move median of the @a`pFirst`, @a`pSecond` and @a`pThird` to the @a`pResult`
+		template <typename T, typename C>
+		constexpr void MoveMedianToFirst(T* pResult, T* pFirst, T* pSecond, T* pThird, C& fnCompare)
+		{
+			if (fnCompare(*pFirst, *pSecond))
+			{
+				if (fnCompare(*pSecond, *pThird))
+					std::swap(*pResult, *pSecond);
+				else if (fnCompare(*pFirst, *pThird))
+					std::swap(*pResult, *pThird);
+				else
+					std::swap(*pResult, *pFirst);
+			}
+			else if (fnCompare(*pFirst, *pThird))
+				std::swap(*pResult, *pFirst);
+			else if (fnCompare(*pSecond, *pThird))
+				std::swap(*pResult, *pThird);
+			else
+				std::swap(*pResult, *pSecond);
+		}
+
+		template <typename T, typename C>
+		constexpr void IntroSort(T* pBegin, T* pEnd, int nDepthLimit, C& fnCompare)
+		{
+			while (pEnd - pBegin > kSortInsertionThreshold)
+			{
+				// fall back to the guaranteed O(n log n) when partitioning degenerates
+				if (nDepthLimit-- == 0)
+				{
+					HeapSort(pBegin, pEnd, fnCompare);
+					return;
+				}
+
+				T* pMiddle = pBegin + (pEnd - pBegin) / 2;
+				MoveMedianToFirst(pBegin, pBegin + 1, pMiddle, pEnd - 1, fnCompare);
+
+				// unguarded partition around the pivot at the beginning, median selection guarantees that both scans stop in range
+				T* pLeft = pBegin + 1;
+				T* pRight = pEnd;
+				while (true)
+				{
+					while (fnCompare(*pLeft, *pBegin))
+						++pLeft;
+
+					--pRight;
+					while (fnCompare(*pBegin, *pRight))
+						--pRight;
+
+					if (!(pLeft < pRight))
+						break;
+
+					std::swap(*pLeft, *pRight);
+					++pLeft;
+				}
+
+				// recurse into the smaller part and loop over the larger one to keep the stack depth logarithmic
+				if (pLeft - pBegin < pEnd - pLeft)
+				{
+					IntroSort(pBegin, pLeft, nDepthLimit, fnCompare);
+					pBegin = pLeft;
+				}
+				else
+				{
+					IntroSort(pLeft, pEnd, nDepthLimit, fnCompare);
+					pEnd = pLeft;
+				}
+			}
+
+			InsertionSort(pBegin, pEnd, fnCompare);
+		}
+
+		/// merge two sorted ranges into the @a`pDestination`, elements of the left range precede equivalent elements of the right range
+		/// @returns: pointer to the @a`pDestination` advanced by count of merged elements
+		template <typename T, typename C>
+		constexpr T* Merge(T* pLeft, T* pLeftEnd, T* pRight, T* pRightEnd, T* pDestination, C& fnCompare)
+		{
+			while (pLeft != pLeftEnd && pRight != pRightEnd)
+				*pDestination++ = (fnCompare(*pRight, *pLeft) ? std::move(*pRight++) : std::move(*pLeft++));
+
+			while (pLeft != pLeftEnd)
+				*pDestination++ = std::move(*pLeft++);
+
+			while (pRight != pRightEnd)
+				*pDestination++ = std::move(*pRight++);
+
+			return pDestination;
+		}
+	}
+
+	/// sort elements in range, alternative of 'std::sort()', 'qsort()'
+	/// @remarks: sorts elements in range [@a`pBegin` .. @a`pEnd`) in ascending order defined by @a`fnCompare`, the order of equivalent elements is not guaranteed to be preserved. uses introspective sort with worst case complexity O(n log n)
+	template <typename T, typename C = Less_t>
+	constexpr void Sort(T* pBegin, T* pEnd, C fnCompare = C())
+	{
+		if (pEnd - pBegin < 2)
+			return;
+
+		int nDepthLimit = 0;
+		for (std::size_t nCount = static_cast<std::size_t>(pEnd - pBegin); nCount > 1U; nCount >>= 1U)
+			nDepthLimit += 2;
+
+		DETAIL::IntroSort(pBegin, pEnd, nDepthLimit, fnCompare);
+	}
+
+	/// find the first element that isn't ordered before the given value, alternative of 'std::lower_bound()'
+	/// @remarks: performs branchless binary search over the range [@a`pBegin` .. @a`pEnd`) that must be partitioned with respect to @a`fnCompare(element, value)`, candidates of the next two iterations are prefetched
+	/// @returns: pointer to the first element for which @a`fnCompare(element, value)` is false, or @a`pEnd` if there is no such element
+	template <typename T, typename V, typename C = Less_t>
+	[[nodiscard]] constexpr T* LowerBound(T* pBegin, T* pEnd, const V& value, C fnCompare = C())
+	{
+		std::size_t nCount = static_cast<std::size_t>(pEnd - pBegin);
+		if (nCount == 0U)
+			return pEnd;
+
+		while (nCount > 1U)
+		{
+			const std::size_t nHalf = nCount >> 1U;
+
+			if (!std::is_constant_evaluated())
+			{
+				DETAIL::Prefetch(pBegin + (nHalf >> 1U));
+				DETAIL::Prefetch(pBegin + nHalf + (nHalf >> 1U));
+			}
+
+			// @note: expected to be compiled into conditional move
+			pBegin = (fnCompare(pBegin[nHalf], value) ? pBegin + nHalf : pBegin);
+			nCount -= nHalf;
+		}
+
+		return pBegin + (fnCompare(*pBegin, value) ? 1 : 0);
+	}
+
+	/// find the first element that is ordered after the given value, alternative of 'std::upper_bound()'
+	/// @remarks: performs branchless binary search over the range [@a`pBegin` .. @a`pEnd`) that must be partitioned with respect to @a`fnCompare(value, element)`, candidates of the next two iterations are prefetched
+	/// @returns: pointer to the first element for which @a`fnCompare(value, element)` is true, or @a`pEnd` if there is no such element
+	template <typename T, typename V, typename C = Less_t>
+	[[nodiscard]] constexpr T* UpperBound(T* pBegin, T* pEnd, const V& value, C fnCompare = C())
+	{
+		std::size_t nCount = static_cast<std::size_t>(pEnd - pBegin);
+		if (nCount == 0U)
+			return pEnd;
+
+		while (nCount > 1U)
+		{
+			const std::size_t nHalf = nCount >> 1U;
+
+			if (!std::is_constant_evaluated())
+			{
+				DETAIL::Prefetch(pBegin + (nHalf >> 1U));
+				DETAIL::Prefetch(pBegin + nHalf + (nHalf >> 1U));
+			}
+
+			// @note: expected to be compiled into conditional move
+			pBegin = (fnCompare(value, pBegin[nHalf]) ? pBegin : pBegin + nHalf);
+			nCount -= nHalf;
+		}
+
+		return pBegin + (fnCompare(value, *pBegin) ? 0 : 1);
+	}
+
+	namespace DETAIL
+	{
+		// count of elements that are reduced at once, position of the extreme element is searched only inside of the block that contains it
+		inline constexpr std::size_t kReduceBlockCount = 4096U;
+
+		/// @returns: true if the given value is unordered with any other value (i.e. NaN), false otherwise
+		template <typename T>
+		[[nodiscard]] Q_INLINE constexpr bool IsUnordered(const T& value)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+				return (value != value);
+			else
+				return false;
+		}
+
+		/// reduce the range to the minimal and/or maximal values, NaN elements are skipped
+		/// @param[in,out] minimal,maximal initial ordered values of the reduction, receive the result
+		template <bool bMinimal, bool bMaximal, typename T>
+		Q_INLINE inline void ReduceRange(const T* pBegin, const T* pEnd, T& minimal, T& maximal)
+		{
+			if constexpr (SimdTraits_t<T>::kIsSupported)
+			{
+				using Traits_t = SimdTraits_t<T>;
+
+				if (static_cast<std::size_t>(pEnd - pBegin) >= Traits_t::kLaneCount)
+				{
+					typename Traits_t::Vector_t vecMinimal = Traits_t::Broadcast(minimal);
+					typename Traits_t::Vector_t vecMaximal = Traits_t::Broadcast(maximal);
+
+					// accumulator is passed as the second operand, so NaN elements don't replace it
+					for (; static_cast<std::size_t>(pEnd - pBegin) >= Traits_t::kLaneCount; pBegin += Traits_t::kLaneCount)
+					{
+						const typename Traits_t::Vector_t vecValue = Traits_t::Load(pBegin);
+
+						if constexpr (bMinimal)
+							vecMinimal = Traits_t::Min(vecValue, vecMinimal);
+						if constexpr (bMaximal)
+							vecMaximal = Traits_t::Max(vecValue, vecMaximal);
+					}
+
+					T arrLanes[Traits_t::kLaneCount];
+					if constexpr (bMinimal)
+					{
+						Traits_t::Store(arrLanes, vecMinimal);
+						for (const T& lane : arrLanes)
+							minimal = (lane < minimal ? lane : minimal);
+					}
+					if constexpr (bMaximal)
+					{
+						Traits_t::Store(arrLanes, vecMaximal);
+						for (const T& lane : arrLanes)
+							maximal = (maximal < lane ? lane : maximal);
+					}
+				}
+			}
+
+			// reduce the rest of elements, comparisons with NaN are false
+			for (; pBegin != pEnd; ++pBegin)
+			{
+				if constexpr (bMinimal)
+					minimal = (*pBegin < minimal ? *pBegin : minimal);
+				if constexpr (bMaximal)
+					maximal = (maximal < *pBegin ? *pBegin : maximal);
+			}
+		}
+
+		/// find the first minimal and/or maximal elements of the range, NaN elements are skipped
+		template <bool bMinimal, bool bMaximal, typename T>
+		void FindExtremeElements(T* pBegin, T* pEnd, T** ppMinimal, T** ppMaximal)
+		{
+			using Value_t = std::remove_const_t<T>;
+
+			// skip leading NaN elements to get the initial ordered value
+			T* pFirst = pBegin;
+			while (pFirst != pEnd && IsUnordered(*pFirst))
+				++pFirst;
+
+			if (pFirst == pEnd)
+			{
+				*ppMinimal = pBegin;
+				*ppMaximal = pBegin;
+				return;
+			}
+
+			Value_t minimal = *pFirst, maximal = *pFirst;
+			T* pMinimalBlock = pFirst;
+			T* pMaximalBlock = pFirst;
+
+			for (T* pBlock = pFirst; pBlock != pEnd;)
+			{
+				T* pBlockEnd = pBlock + Min(kReduceBlockCount, static_cast<std::size_t>(pEnd - pBlock));
+
+				Value_t blockMinimal = minimal, blockMaximal = maximal;
+				ReduceRange<bMinimal, bMaximal, Value_t>(pBlock, pBlockEnd, blockMinimal, blockMaximal);
+
+				// remember only the first block that improves the result
+				if (blockMinimal < minimal)
+				{
+					minimal = blockMinimal;
+					pMinimalBlock = pBlock;
+				}
+				if (maximal < blockMaximal)
+				{
+					maximal = blockMaximal;
+					pMaximalBlock = pBlock;
+				}
+
+				pBlock = pBlockEnd;
+			}
+
+			// locate the first occurrence of the extreme values inside of their blocks
+			if constexpr (bMinimal)
+			{
+				while (*pMinimalBlock != minimal)
+					++pMinimalBlock;
+			}
+			if constexpr (bMaximal)
+			{
+				while (*pMaximalBlock != maximal)
+					++pMaximalBlock;
+			}
+
+			*ppMinimal = pMinimalBlock;
+			*ppMaximal = pMaximalBlock;
+		}
+	}
+
+	/// find the smallest element in range, alternative of 'std::min_element()'
+	/// @remarks: NaN elements are skipped. reduction is vectorized for the arithmetic types with SSE2 or AVX2
+	/// @returns: pointer to the first smallest element in range [@a`pBegin` .. @a`pEnd`), the index is its offset from @a`pBegin`. @a`pEnd` if the range is empty, @a`pBegin` if all elements are NaN
+	template <typename T>
+	[[nodiscard]] T* MinElement(T* pBegin, T* pEnd)
+	{
+		T* pMinimal = pEnd;
+		T* pMaximal = pEnd;
+		DETAIL::FindExtremeElements<true, false>(pBegin, pEnd, &pMinimal, &pMaximal);
+		return pMinimal;
+	}
+
+	/// find the largest element in range, alternative of 'std::max_element()'
+	/// @remarks: NaN elements are skipped. reduction is vectorized for the arithmetic types with SSE2 or AVX2
+	/// @returns: pointer to the first largest element in range [@a`pBegin` .. @a`pEnd`), the index is its offset from @a`pBegin`. @a`pEnd` if the range is empty, @a`pBegin` if all elements are NaN
+	template <typename T>
+	[[nodiscard]] T* MaxElement(T* pBegin, T* pEnd)
+	{
+		T* pMinimal = pEnd;
+		T* pMaximal = pEnd;
+		DETAIL::FindExtremeElements<false, true>(pBegin, pEnd, &pMinimal, &pMaximal);
+		return pMaximal;
+	}
+
+	template <typename T>
+	struct MinMaxElement_t
+	{
+		T* pMinimal;
+		T* pMaximal;
+	};
+
+	/// find the smallest and the largest elements in range with a single pass, alternative of 'std::minmax_element()'
+	/// @remarks: NaN elements are skipped. reduction is vectorized for the arithmetic types with SSE2 or AVX2
+	/// @returns: pointers to the first smallest and the first largest elements in range [@a`pBegin` .. @a`pEnd`), the indices are their offsets from @a`pBegin`. @a`pEnd` if the range is empty, @a`pBegin` if all elements are NaN
+	template <typename T>
+	[[nodiscard]] MinMaxElement_t<T> MinMaxElement(T* pBegin, T* pEnd)
+	{
+		MinMaxElement_t<T> result = { pEnd, pEnd };
+		DETAIL::FindExtremeElements<true, true>(pBegin, pEnd, &result.pMinimal, &result.pMaximal);
+		return result;
+	}
+
+	/// clamp every element in range [@a`minimal` .. @a`maximal`] in-place
+	/// @remarks: behaves as @a`Clamp()` for every element in range [@a`pBegin` .. @a`pEnd`), so NaN elements are kept unchanged. vectorized for the arithmetic types with SSE2 or AVX2
+	template <typename T>
+	void ClampRange(T* pBegin, T* pEnd, const T minimal, const T maximal)
+	{
+		if constexpr (DETAIL::SimdTraits_t<T>::kIsSupported)
+		{
+			using Traits_t = DETAIL::SimdTraits_t<T>;
+
+			const typename Traits_t::Vector_t vecMinimal = Traits_t::Broadcast(minimal);
+			const typename Traits_t::Vector_t vecMaximal = Traits_t::Broadcast(maximal);
+
+			// element is passed as the second operand, so NaN elements are kept
+			for (; static_cast<std::size_t>(pEnd - pBegin) >= Traits_t::kLaneCount; pBegin += Traits_t::kLaneCount)
+				Traits_t::Store(pBegin, Traits_t::Min(vecMaximal, Traits_t::Max(vecMinimal, Traits_t::Load(pBegin))));
+		}
+
+		for (; pBegin != pEnd; ++pBegin)
+			*pBegin = Clamp(*pBegin, minimal, maximal);
+	}
+
+	#ifdef Q_CRT_ALGORITHM_SEARCH
+	#include "algorithm/search.inl"
+	#endif
+
+	#ifdef Q_CRT_ALGORITHM_PARALLEL
+	#include "algorithm/parallel.inl"
+	#endif
 	#pragma endregion
 
 	/* @section: memory */
@@ -197,7 +842,7 @@ namespace CRT
 	#ifdef Q_ISA_SSE2
 		// copy the max of owords
 		const __m128i arrByte = ::_mm_set1_epi8(uByte);
-		for (std::size_t i = 0U; i < (nCount >> 4U); i += 16U)
+		for (std::size_t i = 0U; i < (nCount >> 4U); ++i)
 		{
 			::_mm_storeu_si128(reinterpret_cast<__m128i*>(pCurrentDestination), arrByte);
 			pCurrentDestination += sizeof(__m128i);
@@ -257,7 +902,7 @@ namespace CRT
 
 	#ifdef Q_ISA_SSE2
 		// copy the max of owords
-		for (std::size_t i = 0U; i < (nCount >> 4U); i += 16U)
+		for (std::size_t i = 0U; i < (nCount >> 4U); ++i)
 		{
 			::_mm_storeu_si128(reinterpret_cast<__m128i*>(pCurrentDestination), ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCurrentSource)));
 			pCurrentDestination += sizeof(__m128i);
@@ -408,6 +1053,24 @@ namespace CRT
 	#pragma region crt_characters
 	#ifdef Q_CRT_STRING_WIDE_TYPE
 	#include "string/wctype.inl"
+
+	namespace DETAIL
+	{
+		/// @returns: type flags of the given wide character
+		[[nodiscard]] Q_INLINE constexpr std::uint8_t GetWideCharType(const std::uint32_t uChar)
+		{
+			if (uChar > 0x10FFFF)
+				return 0U;
+
+			// every codepoint is looked up through the same three stages and the palette, so it always takes four loads
+			constexpr std::uint32_t kBlocksPerPlaneShift = kWideCharacterTypePlaneShift - kWideCharacterTypeBlockShift;
+			const std::uint32_t uBlockOffset = arrWideCharacterTypeOffsets[(static_cast<std::uint32_t>(arrWideCharacterTypeIndices[uChar >> kWideCharacterTypePlaneShift]) << kBlocksPerPlaneShift) + ((uChar >> kWideCharacterTypeBlockShift) & ((1U << kBlocksPerPlaneShift) - 1U))];
+
+			// locate packed type index inside of the block
+			const std::uint32_t uPosition = (uChar & ((1U << kWideCharacterTypeBlockShift) - 1U)) * kWideCharacterTypeIndexBits;
+			return arrWideCharacterTypePalette[(arrWideCharacterTypeLUT[uBlockOffset + (uPosition >> 3U)] >> (uPosition & 7U)) & ((1U << kWideCharacterTypeIndexBits) - 1U)];
+		}
+	}
 	#endif
 
 	/// alternative of 'iscntrl()'
@@ -422,7 +1085,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsControl(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & TYPE_CONTROL) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & TYPE_CONTROL) != 0U;
 	#else
 		return (wChar <= 0x1F || wChar == 0x7F);
 	#endif
@@ -440,7 +1103,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsDigit(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & TYPE_DIGIT) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & TYPE_DIGIT) != 0U;
 	#else
 		return (wChar >= L'0' && wChar <= L'9');
 	#endif
@@ -477,7 +1140,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsBlank(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & TYPE_BLANK) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & TYPE_BLANK) != 0U;
 	#else
 		return (wChar == L'\t' || wChar == L' ');
 	#endif
@@ -495,7 +1158,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsSpace(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & TYPE_SPACE) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & TYPE_SPACE) != 0U;
 	#else
 		return ((wChar >= L'\t' && wChar <= L'\r') || wChar == L' ');
 	#endif
@@ -513,7 +1176,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsAlpha(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & (TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & (TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
 	#else
 		return ((wChar >= L'0' && wChar <= L'9') || (wChar >= L'A' && wChar <= L'Z') || (wChar >= L'a' && wChar <= L'z'));
 	#endif
@@ -531,7 +1194,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsAlphaNum(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & (TYPE_DIGIT | TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & (TYPE_DIGIT | TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
 	#else
 		return ((wChar >= L'0' && wChar <= L'9') || (wChar >= L'A' && wChar <= L'Z') || (wChar >= L'a' && wChar <= L'z'));
 	#endif
@@ -549,7 +1212,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsPrint(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return wChar != L'\t' && (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & (TYPE_BLANK | TYPE_PUNCT | TYPE_DIGIT | TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
+		return wChar != L'\t' && (DETAIL::GetWideCharType(wChar) & (TYPE_BLANK | TYPE_PUNCT | TYPE_DIGIT | TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
 	#else
 		return (wChar >= L' ' && wChar <= L'~');
 	#endif
@@ -567,7 +1230,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsGraph(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & (TYPE_PUNCT | TYPE_DIGIT | TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & (TYPE_PUNCT | TYPE_DIGIT | TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA)) != 0U;
 	#else
 		return (wChar >= L'!' && wChar <= L'~');
 	#endif
@@ -585,7 +1248,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsPunct(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & TYPE_PUNCT) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & TYPE_PUNCT) != 0U;
 	#else
 		return ((wChar >= L'!' && wChar <= L'/') || (wChar >= L':' && wChar <= L'@') || (wChar >= L'[' && wChar <= L'`') || (wChar >= L'{' && wChar <= L'~'));
 	#endif
@@ -603,7 +1266,7 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsUpper(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & TYPE_UPPER) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & TYPE_UPPER) != 0U;
 	#else
 		return (wChar >= L'A' && wChar <= L'Z');
 	#endif
@@ -621,11 +1284,236 @@ namespace CRT
 	[[nodiscard]] constexpr bool IsLower(const wint_t wChar)
 	{
 	#ifdef Q_CRT_STRING_WIDE_TYPE
-		return (arrWideCharacterTypeLUT[arrWideCharacterTypeOffsets[wChar >> 5U] + (wChar & 0x1F)] & TYPE_LOWER) != 0U;
+		return (DETAIL::GetWideCharType(wChar) & TYPE_LOWER) != 0U;
 	#else
 		return (wChar >= L'a' && wChar <= L'z');
 	#endif
 	}
+	#ifdef Q_CRT_STRING_WIDE_TYPE
+	namespace DETAIL
+	{
+		// count of characters that are checked to be in ASCII range at once by the bulk classification
+		inline constexpr std::size_t kCharTypeBlockCount = 16U;
+
+		/// @returns: true if all characters of the block at @a`pwchSource` are in ASCII range, false otherwise
+		Q_INLINE inline bool IsAsciiCharBlock(const wchar_t* pwchSource)
+		{
+		#ifdef Q_ISA_SSE2
+			__m128i vecBits = ::_mm_setzero_si128();
+			for (std::size_t i = 0U; i < kCharTypeBlockCount; i += sizeof(__m128i) / sizeof(wchar_t))
+				vecBits = ::_mm_or_si128(vecBits, ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pwchSource + i)));
+
+			if constexpr (sizeof(wchar_t) == 2U)
+				return (::_mm_movemask_epi8(::_mm_cmpeq_epi16(::_mm_and_si128(vecBits, ::_mm_set1_epi16(~0x7F)), ::_mm_setzero_si128())) == 0xFFFF);
+			else
+				return (::_mm_movemask_epi8(::_mm_cmpeq_epi32(::_mm_and_si128(vecBits, ::_mm_set1_epi32(~0x7F)), ::_mm_setzero_si128())) == 0xFFFF);
+		#else
+			std::uint32_t uBits = 0U;
+			for (std::size_t i = 0U; i < kCharTypeBlockCount; ++i)
+				uBits |= static_cast<std::uint32_t>(pwchSource[i]);
+
+			return ((uBits & ~0x7FU) == 0U);
+		#endif
+		}
+
+		/*
+		 * matcher of the characters in ASCII range against the type flags
+		 * - with AVX2 whole block is matched with the nibble lookup: row of the low nibble holds a bit for each high nibble which character matches flags
+		 */
+		class CharTypeMatcher_t
+		{
+		public:
+			explicit CharTypeMatcher_t(const std::uint8_t uTypeMask) :
+				uTypeMask(uTypeMask)
+			{
+			#ifdef Q_ISA_AVX2
+				alignas(16) std::uint8_t arrRows[16] = { };
+				for (std::uint8_t uChar = 0U; uChar < 0x80; ++uChar)
+				{
+					if ((arrWideCharacterTypeASCII[uChar] & uTypeMask) != 0U)
+						arrRows[uChar & 0xF] |= static_cast<std::uint8_t>(1U << (uChar >> 4U));
+				}
+
+				vecRows = ::_mm_load_si128(reinterpret_cast<const __m128i*>(arrRows));
+			#else
+				for (std::uint8_t uChar = 0U; uChar < 0x80; ++uChar)
+					arrMatches[uChar] = ((arrWideCharacterTypeASCII[uChar] & uTypeMask) != 0U ? 0xFF : 0x00);
+			#endif
+			}
+
+			/// @returns: bitmask where each set bit corresponds to the character of the ASCII block that matches any of the type flags
+			[[nodiscard]] Q_INLINE std::uint32_t MatchBlock(const wchar_t* pwchSource) const
+			{
+			#ifdef Q_ISA_AVX2
+				// narrow characters to bytes, they are known to be in ASCII range
+				__m128i vecChars;
+				if constexpr (sizeof(wchar_t) == 2U)
+					vecChars = ::_mm_packus_epi16(::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pwchSource)), ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pwchSource + 8)));
+				else
+				{
+					const __m128i vecLow = ::_mm_packs_epi32(::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pwchSource)), ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pwchSource + 4)));
+					const __m128i vecHigh = ::_mm_packs_epi32(::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pwchSource + 8)), ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pwchSource + 12)));
+					vecChars = ::_mm_packus_epi16(vecLow, vecHigh);
+				}
+
+				const __m128i vecLowNibbles = ::_mm_and_si128(vecChars, ::_mm_set1_epi8(0x0F));
+				const __m128i vecHighNibbles = ::_mm_and_si128(::_mm_srli_epi16(vecChars, 4), ::_mm_set1_epi8(0x0F));
+				const __m128i vecRowBits = ::_mm_shuffle_epi8(vecRows, vecLowNibbles);
+				const __m128i vecColumnBits = ::_mm_shuffle_epi8(::_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0), vecHighNibbles);
+				return (~static_cast<std::uint32_t>(::_mm_movemask_epi8(::_mm_cmpeq_epi8(::_mm_and_si128(vecRowBits, vecColumnBits), ::_mm_setzero_si128()))) & 0xFFFF);
+			#else
+				// characters in ASCII range map to the match table directly, then gather its sign bits
+				alignas(16) std::uint8_t arrBlockMatches[kCharTypeBlockCount];
+				for (std::size_t i = 0U; i < kCharTypeBlockCount; ++i)
+					arrBlockMatches[i] = arrMatches[pwchSource[i]];
+
+			#ifdef Q_ISA_SSE2
+				return static_cast<std::uint32_t>(::_mm_movemask_epi8(::_mm_load_si128(reinterpret_cast<const __m128i*>(arrBlockMatches))));
+			#else
+				std::uint32_t uMatch = 0U;
+				for (std::size_t i = 0U; i < kCharTypeBlockCount; ++i)
+					uMatch |= static_cast<std::uint32_t>(arrBlockMatches[i] & 1U) << i;
+
+				return uMatch;
+			#endif
+			#endif
+			}
+
+			/// @returns: bitmask where each set bit corresponds to the character of the block that matches any of the type flags
+			[[nodiscard]] Q_INLINE std::uint32_t MatchAnyBlock(const wchar_t* pwchSource) const
+			{
+				if (IsAsciiCharBlock(pwchSource))
+					return MatchBlock(pwchSource);
+
+				std::uint32_t uMatch = 0U;
+				for (std::size_t i = 0U; i < kCharTypeBlockCount; ++i)
+					uMatch |= static_cast<std::uint32_t>((GetWideCharType(pwchSource[i]) & uTypeMask) != 0U) << i;
+
+				return uMatch;
+			}
+
+			/// @returns: true if the character matches any of the type flags, false otherwise
+			[[nodiscard]] Q_INLINE bool Match(const wchar_t wChar) const
+			{
+				return (GetWideCharType(wChar) & uTypeMask) != 0U;
+			}
+
+		private:
+			std::uint8_t uTypeMask;
+		#ifdef Q_ISA_AVX2
+			__m128i vecRows;
+		#else
+			std::uint8_t arrMatches[0x80];
+		#endif
+		};
+
+		/// find the first character in range that matches or doesn't match the type flags
+		template <bool bMatch>
+		const wchar_t* FindCharType(const wchar_t* pwchBegin, const wchar_t* pwchEnd, const std::uint8_t uTypeMask)
+		{
+			const CharTypeMatcher_t matcher(uTypeMask);
+
+			for (; static_cast<std::size_t>(pwchEnd - pwchBegin) >= kCharTypeBlockCount; pwchBegin += kCharTypeBlockCount)
+			{
+				std::uint32_t uMatch = matcher.MatchAnyBlock(pwchBegin);
+				if constexpr (!bMatch)
+					uMatch = ~uMatch & ((1U << kCharTypeBlockCount) - 1U);
+
+				if (uMatch != 0U)
+					return pwchBegin + std::countr_zero(uMatch);
+			}
+
+			for (; pwchBegin != pwchEnd; ++pwchBegin)
+			{
+				if (matcher.Match(*pwchBegin) == bMatch)
+					return pwchBegin;
+			}
+
+			return pwchEnd;
+		}
+
+		/// find the last character in range that matches or doesn't match the type flags
+		template <bool bMatch>
+		const wchar_t* FindCharTypeR(const wchar_t* pwchBegin, const wchar_t* pwchEnd, const std::uint8_t uTypeMask)
+		{
+			const CharTypeMatcher_t matcher(uTypeMask);
+
+			for (const wchar_t* pwchCurrent = pwchEnd; pwchCurrent != pwchBegin;)
+			{
+				if (static_cast<std::size_t>(pwchCurrent - pwchBegin) >= kCharTypeBlockCount)
+				{
+					pwchCurrent -= kCharTypeBlockCount;
+
+					std::uint32_t uMatch = matcher.MatchAnyBlock(pwchCurrent);
+					if constexpr (!bMatch)
+						uMatch = ~uMatch & ((1U << kCharTypeBlockCount) - 1U);
+
+					if (uMatch != 0U)
+						return pwchCurrent + (31 - std::countl_zero(uMatch));
+				}
+				else if (matcher.Match(*--pwchCurrent) == bMatch)
+					return pwchCurrent;
+			}
+
+			return pwchEnd;
+		}
+	}
+
+	/// get type flags of each wide character in range
+	/// @remarks: characters in ASCII range are classified in blocks with a single lookup, others use the multi-stage lookup table
+	/// @param[out] puTypes array of at least [@a`pwchEnd` - @a`pwchBegin`] elements that receives the combination of 'EWideCharacterTypeFlags_t' flags of the corresponding characters
+	inline void GetCharTypes(const wchar_t* pwchBegin, const wchar_t* pwchEnd, std::uint8_t* puTypes)
+	{
+		for (; static_cast<std::size_t>(pwchEnd - pwchBegin) >= DETAIL::kCharTypeBlockCount; pwchBegin += DETAIL::kCharTypeBlockCount, puTypes += DETAIL::kCharTypeBlockCount)
+		{
+			if (DETAIL::IsAsciiCharBlock(pwchBegin))
+			{
+				for (std::size_t i = 0U; i < DETAIL::kCharTypeBlockCount; ++i)
+					puTypes[i] = arrWideCharacterTypeASCII[pwchBegin[i]];
+			}
+			else
+			{
+				for (std::size_t i = 0U; i < DETAIL::kCharTypeBlockCount; ++i)
+					puTypes[i] = DETAIL::GetWideCharType(pwchBegin[i]);
+			}
+		}
+
+		for (; pwchBegin != pwchEnd; ++pwchBegin, ++puTypes)
+			*puTypes = DETAIL::GetWideCharType(*pwchBegin);
+	}
+
+	/// find the first wide character in range that has any of the given type flags
+	/// @param[in] uTypeMask combination of 'EWideCharacterTypeFlags_t' flags to search for, e.g. 'TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA' matches the same characters as 'IsAlpha()'
+	/// @returns: pointer to the first matching character, @a`pwchEnd` if there are no matches
+	[[nodiscard]] inline const wchar_t* FindCharType(const wchar_t* pwchBegin, const wchar_t* pwchEnd, const std::uint8_t uTypeMask)
+	{
+		return DETAIL::FindCharType<true>(pwchBegin, pwchEnd, uTypeMask);
+	}
+
+	/// find the first wide character in range that has none of the given type flags
+	/// @param[in] uTypeMask combination of 'EWideCharacterTypeFlags_t' flags to skip, e.g. 'TYPE_SPACE' skips the same characters as 'IsSpace()'
+	/// @returns: pointer to the first non-matching character, @a`pwchEnd` if all characters match
+	[[nodiscard]] inline const wchar_t* FindCharNotType(const wchar_t* pwchBegin, const wchar_t* pwchEnd, const std::uint8_t uTypeMask)
+	{
+		return DETAIL::FindCharType<false>(pwchBegin, pwchEnd, uTypeMask);
+	}
+
+	/// find the last wide character in range that has any of the given type flags
+	/// @param[in] uTypeMask combination of 'EWideCharacterTypeFlags_t' flags to search for
+	/// @returns: pointer to the last matching character, @a`pwchEnd` if there are no matches
+	[[nodiscard]] inline const wchar_t* FindCharTypeR(const wchar_t* pwchBegin, const wchar_t* pwchEnd, const std::uint8_t uTypeMask)
+	{
+		return DETAIL::FindCharTypeR<true>(pwchBegin, pwchEnd, uTypeMask);
+	}
+
+	/// find the last wide character in range that has none of the given type flags
+	/// @param[in] uTypeMask combination of 'EWideCharacterTypeFlags_t' flags to skip, e.g. 'TYPE_SPACE' to trim trailing whitespaces
+	/// @returns: pointer to the last non-matching character, @a`pwchEnd` if all characters match
+	[[nodiscard]] inline const wchar_t* FindCharNotTypeR(const wchar_t* pwchBegin, const wchar_t* pwchEnd, const std::uint8_t uTypeMask)
+	{
+		return DETAIL::FindCharTypeR<false>(pwchBegin, pwchEnd, uTypeMask);
+	}
+	#endif
 	#pragma endregion
 
 	/*
@@ -633,6 +1521,30 @@ namespace CRT
 	 * - valid only for default C locale, unless 'Q_CRT_STRING_WIDE_CASE' is defined
 	 */
 	#pragma region crt_character_convert
+	#ifdef Q_CRT_STRING_WIDE_CASE
+	#include "string/wcase.inl"
+
+	namespace DETAIL
+	{
+		enum EWideCaseMapping : std::size_t
+		{
+			WIDE_CASE_UPPER = 0U,
+			WIDE_CASE_LOWER,
+			WIDE_CASE_FOLD
+		};
+
+		/// @returns: wide character mapped with the given case mapping, for characters outside of ASCII range
+		template <EWideCaseMapping nMapping>
+		[[nodiscard]] Q_INLINE constexpr wint_t MapWideCase(const wint_t wChar)
+		{
+			if ((wChar >> 6U) >= (sizeof(arrWideCaseIndices) / sizeof(arrWideCaseIndices[0])))
+				return wChar;
+
+			return static_cast<wint_t>(static_cast<std::int32_t>(wChar) + arrWideCaseDeltas[arrWideCaseLUT[(arrWideCaseIndices[wChar >> 6U] << 6U) + (wChar & 0x3F)]][nMapping]);
+		}
+	}
+	#endif
+
 	// convert single character to uppercase, alternative of 'toupper()'
 	[[nodiscard]] constexpr int CharToUpper(const int iChar)
 	{
@@ -642,7 +1554,15 @@ namespace CRT
 	// convert single wide character to uppercase, alternative of 'towupper()'
 	[[nodiscard]] constexpr wint_t CharToUpper(const wint_t wChar)
 	{
+	#ifdef Q_CRT_STRING_WIDE_CASE
+		// branchless conversion of ASCII range
+		if (wChar < 0x80)
+			return wChar - (static_cast<wint_t>(static_cast<std::uint32_t>(wChar - L'a') <= static_cast<std::uint32_t>(L'z' - L'a')) << 5U);
+
+		return DETAIL::MapWideCase<DETAIL::WIDE_CASE_UPPER>(wChar);
+	#else
 		return (IsLower(wChar) ? (wChar & ~('a' ^ 'A')) : wChar);
+	#endif
 	}
 
 	// convert single character to lowercase, alternative of 'tolower()'
@@ -654,7 +1574,35 @@ namespace CRT
 	// convert single wide character to lowercase, alternative of 'towlower()'
 	[[nodiscard]] constexpr wint_t CharToLower(const wint_t wChar)
 	{
+	#ifdef Q_CRT_STRING_WIDE_CASE
+		// branchless conversion of ASCII range
+		if (wChar < 0x80)
+			return wChar + (static_cast<wint_t>(static_cast<std::uint32_t>(wChar - L'A') <= static_cast<std::uint32_t>(L'Z' - L'A')) << 5U);
+
+		return DETAIL::MapWideCase<DETAIL::WIDE_CASE_LOWER>(wChar);
+	#else
 		return (IsUpper(wChar) ? (wChar | ('a' ^ 'A')) : wChar);
+	#endif
+	}
+
+	// convert single character to its case folding, used for case-insensitive comparison
+	[[nodiscard]] constexpr int CharFoldCase(const int iChar)
+	{
+		return CharToLower(iChar);
+	}
+
+	// convert single wide character to its case folding, used for case-insensitive comparison. with 'Q_CRT_STRING_WIDE_CASE' it's a simple case folding ('C' and 'S' statuses of 'CaseFolding.txt')
+	[[nodiscard]] constexpr wint_t CharFoldCase(const wint_t wChar)
+	{
+	#ifdef Q_CRT_STRING_WIDE_CASE
+		// branchless conversion of ASCII range
+		if (wChar < 0x80)
+			return wChar + (static_cast<wint_t>(static_cast<std::uint32_t>(wChar - L'A') <= static_cast<std::uint32_t>(L'Z' - L'A')) << 5U);
+
+		return DETAIL::MapWideCase<DETAIL::WIDE_CASE_FOLD>(wChar);
+	#else
+		return CharToLower(wChar);
+	#endif
 	}
 	#pragma endregion
 
@@ -726,15 +1674,16 @@ namespace CRT
 				// get up to 4-byte alignment
 				while ((reinterpret_cast<std::uintptr_t>(tszSourceEnd) & 3U) != 0U)
 				{
-					if (*tszSourceEnd == '\0')
+					if (nMaxLength == 0U || *tszSourceEnd == '\0')
 						return tszSourceEnd - tszSource;
 
 					++tszSourceEnd;
+					--nMaxLength;
 				}
 
 				// scan over 4 bytes at a time to find the terminating null
 				// @note: read past the end of the buffer, but guaranteed to never cross the page boundaries
-				while (nMaxLength >= 4U)
+				while (nMaxLength >= (sizeof(std::uint32_t) / sizeof(T)))
 				{
 					const std::uint32_t uBits = *reinterpret_cast<const std::uint32_t*>(tszSourceEnd);
 
@@ -751,7 +1700,7 @@ namespace CRT
 					}
 
 					tszSourceEnd += (sizeof(std::uint32_t) / sizeof(T));
-					nMaxLength -= 4U;
+					nMaxLength -= (sizeof(std::uint32_t) / sizeof(T));
 				}
 			}
 		}
@@ -806,19 +1755,115 @@ namespace CRT
 		return 0;
 	}
 
+	namespace DETAIL
+	{
+		/// advance both strings past their common prefix of the blocks that consist of non-null ASCII characters equal ignoring case
+		/// @remarks: reads by 16-byte blocks and may read past the terminating null character, but never crosses the page boundaries
+		/// @returns: count of skipped characters, not greater than @a`nMaxCount`
+		template <typename T>
+		Q_CRT_NO_SANITIZE Q_INLINE inline std::size_t SkipEqualAsciiI(const T*& tszLeft, const T*& tszRight, const std::size_t nMaxCount)
+		{
+		#ifdef Q_ISA_SSE2
+			constexpr std::size_t nBlockLength = sizeof(__m128i) / sizeof(T);
+			constexpr std::uintptr_t uPageMask = 0xFFF;
+
+			const auto CompareGreater = [](const __m128i vecLeft, const __m128i vecRight)
+			{
+				if constexpr (sizeof(T) == 1U)
+					return ::_mm_cmpgt_epi8(vecLeft, vecRight);
+				else if constexpr (sizeof(T) == 2U)
+					return ::_mm_cmpgt_epi16(vecLeft, vecRight);
+				else
+					return ::_mm_cmpgt_epi32(vecLeft, vecRight);
+			};
+
+			const auto Broadcast = [](const int iValue)
+			{
+				if constexpr (sizeof(T) == 1U)
+					return ::_mm_set1_epi8(static_cast<char>(iValue));
+				else if constexpr (sizeof(T) == 2U)
+					return ::_mm_set1_epi16(static_cast<short>(iValue));
+				else
+					return ::_mm_set1_epi32(iValue);
+			};
+
+			// @returns: mask of lanes that are in [1 .. 0x7F] range
+			const auto IsAscii = [&](const __m128i vecChars)
+			{
+				const __m128i vecNonNull = CompareGreater(vecChars, ::_mm_setzero_si128());
+
+				// signed bytes above 0x7F are negative already
+				if constexpr (sizeof(T) == 1U)
+					return vecNonNull;
+				else
+					return ::_mm_and_si128(vecNonNull, CompareGreater(Broadcast(0x80), vecChars));
+			};
+
+			const auto FoldCase = [&](const __m128i vecChars)
+			{
+				const __m128i vecUpper = ::_mm_and_si128(CompareGreater(vecChars, Broadcast('A' - 1)), CompareGreater(Broadcast('Z' + 1), vecChars));
+				return ::_mm_or_si128(vecChars, ::_mm_and_si128(vecUpper, Broadcast('a' ^ 'A')));
+			};
+
+			std::size_t nSkipped = 0U;
+			while (nMaxCount - nSkipped >= nBlockLength)
+			{
+				// count of the whole blocks until the nearest page boundary of either string
+				const std::uintptr_t uLeftPageBytes = uPageMask + 1U - (reinterpret_cast<std::uintptr_t>(tszLeft) & uPageMask);
+				const std::uintptr_t uRightPageBytes = uPageMask + 1U - (reinterpret_cast<std::uintptr_t>(tszRight) & uPageMask);
+				std::size_t nBlockCount = Min(static_cast<std::size_t>(Min(uLeftPageBytes, uRightPageBytes) / sizeof(__m128i)), (nMaxCount - nSkipped) / nBlockLength);
+
+				// step over the page boundary by single character
+				if (nBlockCount == 0U)
+				{
+					const std::uint32_t uLeft = static_cast<std::make_unsigned_t<T>>(*tszLeft), uRight = static_cast<std::make_unsigned_t<T>>(*tszRight);
+					if (uLeft - 1U >= 0x7FU || uRight - 1U >= 0x7FU || (uLeft | ((uLeft - 'A' <= 'Z' - 'A') ? ('a' ^ 'A') : 0U)) != (uRight | ((uRight - 'A' <= 'Z' - 'A') ? ('a' ^ 'A') : 0U)))
+						break;
+
+					++tszLeft;
+					++tszRight;
+					++nSkipped;
+					continue;
+				}
+
+				for (; nBlockCount != 0U; --nBlockCount)
+				{
+					const __m128i vecLeft = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(tszLeft));
+					const __m128i vecRight = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(tszRight));
+					const __m128i vecEqual = ::_mm_and_si128(::_mm_and_si128(IsAscii(vecLeft), IsAscii(vecRight)), ::_mm_cmpeq_epi8(FoldCase(vecLeft), FoldCase(vecRight)));
+
+					if (::_mm_movemask_epi8(vecEqual) != 0xFFFF)
+						return nSkipped;
+
+					tszLeft += nBlockLength;
+					tszRight += nBlockLength;
+					nSkipped += nBlockLength;
+				}
+			}
+
+			return nSkipped;
+		#else
+			return 0U;
+		#endif
+		}
+	}
+
 	/// case-insensitive compare two strings, alternative of 'stricmp()', 'wcsicmp()'
-	/// @remarks: compares @a`tszLeft` to @a`tszRight` and return a value that indicates their relationship, performs conversion of each character to lowercase before comparison
+	/// @remarks: compares @a`tszLeft` to @a`tszRight` and return a value that indicates their relationship, performs case folding of each character before comparison
 	/// @returns: <0 - if @a`tszLeft` less than @a`tszRight`, 0 - if @a`tszLeft` is identical to @a`tszRight`, >0 - if @a`tszLeft` greater than @a`tszRight`
 	template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
 	constexpr int StringCompareI(const T* tszLeft, const T* tszRight)
 	{
 		using ComparisonType_t = std::conditional_t<std::is_same_v<T, char>, int, wint_t>;
 
+		if (!std::is_constant_evaluated())
+			DETAIL::SkipEqualAsciiI(tszLeft, tszRight, static_cast<std::size_t>(-1));
+
 		ComparisonType_t nLeft, nRight;
 		do
 		{
-			nLeft = CharToLower(static_cast<ComparisonType_t>(*tszLeft++));
-			nRight = CharToLower(static_cast<ComparisonType_t>(*tszRight++));
+			nLeft = CharFoldCase(static_cast<ComparisonType_t>(*tszLeft++));
+			nRight = CharFoldCase(static_cast<ComparisonType_t>(*tszRight++));
 
 			if (nLeft == '\0')
 				break;
@@ -828,18 +1873,21 @@ namespace CRT
 	}
 
 	/// case-insensitive compare two strings up to the specified count of characters, alternative of 'strnicmp()', 'wcsnicmp()'
-	/// @remarks: compares at most the first @a`nCount` characters of @a`tszLeft` and @a`tszRight` strings and return a value that indicates their relationship, performs conversion of each character to lowercase before comparison
+	/// @remarks: compares at most the first @a`nCount` characters of @a`tszLeft` and @a`tszRight` strings and return a value that indicates their relationship, performs case folding of each character before comparison
 	/// @returns: <0 - if @a`tszLeft` less than @a`tszRight`, 0 - if @a`tszLeft` is identical to @a`tszRight`, >0 - if @a`tszLeft` greater than @a`tszRight`
 	template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
 	constexpr int StringCompareNI(const T* tszLeft, const T* tszRight, std::size_t nCount)
 	{
 		using ComparisonType_t = std::conditional_t<std::is_same_v<T, char>, int, wint_t>;
 
+		if (!std::is_constant_evaluated())
+			nCount -= DETAIL::SkipEqualAsciiI(tszLeft, tszRight, nCount);
+
 		ComparisonType_t nLeft, nRight;
 		while (nCount-- != 0U)
 		{
-			nLeft = CharToLower(static_cast<ComparisonType_t>(*tszLeft++));
-			nRight = CharToLower(static_cast<ComparisonType_t>(*tszRight++));
+			nLeft = CharFoldCase(static_cast<ComparisonType_t>(*tszLeft++));
+			nRight = CharFoldCase(static_cast<ComparisonType_t>(*tszRight++));
 
 			if (nLeft != nRight)
 				return nLeft - nRight;
@@ -944,29 +1992,40 @@ namespace CRT
 	}
 
 	/// case-insensitive search for one string inside another, alternative of 'strcasestr()'
-	/// @remarks: finds the first occurrence of @a`tszSearch` substring in @a`tszSource`, performs conversion of each character to lowercase before comparison. the search does not include terminating null character
+	/// @remarks: finds the first occurrence of @a`tszSearch` substring in @a`tszSource`, performs case folding of each character before comparison. the search does not include terminating null character
 	/// @returns: pointer to the first occurrence of @a`tszSearch` substring in @a`tszSource` on success, null otherwise
 	template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
 	constexpr T* StringStringI(const T* tszSource, const T* tszSearch)
 	{
 		using ComparisonType_t = std::conditional_t<std::is_same_v<T, char>, int, wint_t>;
 
-		const T* tszCurrentSource = tszSource;
-		const T* tszCurrentSearch = tszSearch;
+		const ComparisonType_t nFirstSearch = CharFoldCase(static_cast<ComparisonType_t>(*tszSearch));
+		if (nFirstSearch == '\0')
+			return const_cast<T*>(tszSource);
 
-		while (true)
+		for (; *tszSource != '\0'; ++tszSource)
 		{
+			if (CharFoldCase(static_cast<ComparisonType_t>(*tszSource)) != nFirstSearch)
+				continue;
+
+			const T* tszCurrentSource = tszSource + 1;
+			const T* tszCurrentSearch = tszSearch + 1;
+
+			if (!std::is_constant_evaluated())
+				DETAIL::SkipEqualAsciiI(tszCurrentSource, tszCurrentSearch, static_cast<std::size_t>(-1));
+
+			while (*tszCurrentSearch != '\0' && CharFoldCase(static_cast<ComparisonType_t>(*tszCurrentSource)) == CharFoldCase(static_cast<ComparisonType_t>(*tszCurrentSearch)))
+			{
+				++tszCurrentSource;
+				++tszCurrentSearch;
+			}
+
 			if (*tszCurrentSearch == '\0')
 				return const_cast<T*>(tszSource);
 
+			// source is shorter than the rest of search string
 			if (*tszCurrentSource == '\0')
 				break;
-
-			if (CharToLower(static_cast<ComparisonType_t>(*tszCurrentSource++)) != CharToLower(static_cast<ComparisonType_t>(*tszCurrentSearch++)))
-			{
-				tszCurrentSource = ++tszSource;
-				tszCurrentSearch = tszSearch;
-			}
 		}
 
 		return nullptr;
@@ -1126,7 +2185,11 @@ namespace CRT
 	 */
 	#pragma region crt_string_convert
 	#ifdef Q_CRT_STRING_CONVERT
+	#include "string/pow10.inl"
 	#include "string/convert.inl"
+	#ifdef Q_CRT_STRING_FORMAT
+	#include "string/format.inl"
+	#endif
 	#endif
 	#pragma endregion
 
@@ -1138,5 +2201,9 @@ namespace CRT
 	#ifdef Q_CRT_STRING_ENCODE
 	#include "string/encode.inl"
 	#endif
+	#ifdef Q_CRT_STRING_NORMALIZE
+	#include "string/wnorm.inl"
+	#include "string/normalize.inl"
+	#endif
 	#pragma endregion
 }
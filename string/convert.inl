@@ -2,6 +2,60 @@
 #define Q_CRT_STRING_CONVERT_IMPLEMENTATION
 namespace DETAIL
 {
+	// the standard library recognizes 128-bit integers as the integral types only in the GNU dialect of GCC and Clang, but not with the strict '-std=c++20' or the Microsoft standard library of 'clang-cl', so the integer conversions use these alternatives of the standard traits, that accept them whenever the compiler supports them
+	/// alternative of 'std::is_integral_v', that also accepts 128-bit integers
+	template <typename T>
+	inline constexpr bool IsIntegral_v = std::is_integral_v<T>;
+
+	/// alternative of 'std::is_signed_v', that also accepts 128-bit integers
+	template <typename T>
+	inline constexpr bool IsSigned_v = std::is_signed_v<T>;
+
+	/// alternative of 'std::make_unsigned', that also accepts 128-bit integers
+	template <typename T>
+	struct MakeUnsigned
+	{
+		using Type_t = std::make_unsigned_t<T>;
+	};
+
+#ifdef __SIZEOF_INT128__
+	template <>
+	inline constexpr bool IsIntegral_v<__int128_t> = true;
+	template <>
+	inline constexpr bool IsIntegral_v<__uint128_t> = true;
+	template <>
+	inline constexpr bool IsSigned_v<__int128_t> = true;
+
+	template <>
+	struct MakeUnsigned<__int128_t>
+	{
+		using Type_t = __uint128_t;
+	};
+
+	template <>
+	struct MakeUnsigned<__uint128_t>
+	{
+		using Type_t = __uint128_t;
+	};
+#endif
+
+	template <typename T>
+	using MakeUnsigned_t = typename MakeUnsigned<T>::Type_t;
+
+	/// alternative of 'std::numeric_limits<T>::max()', that also accepts 128-bit integers
+	template <typename T>
+	[[nodiscard]] consteval T GetIntegerMax()
+	{
+		return static_cast<T>(static_cast<MakeUnsigned_t<T>>(~MakeUnsigned_t<T>(0U)) >> (IsSigned_v<T> ? 1U : 0U));
+	}
+
+	/// alternative of 'std::numeric_limits<T>::min()', that also accepts 128-bit integers
+	template <typename T>
+	[[nodiscard]] consteval T GetIntegerMin()
+	{
+		return (IsSigned_v<T> ? static_cast<T>(-GetIntegerMax<T>() - 1) : T(0));
+	}
+
 	Q_INLINE inline std::uint64_t Multiply64To128(std::uint64_t ullMultiplicand, std::uint64_t ullMultiplier, std::uint64_t* pullProductHigh)
 	{
 	#if defined(Q_COMPILER_MSC) && Q_ARCH_BIT == 64
@@ -24,6 +78,104 @@ namespace DETAIL
 		return (ullHigh << 32ULL) | (ullLow & 0xFFFFFFFF);
 	#endif
 	}
+
+	/// convert the given count of characters to uppercase or lowercase, one character at a time
+	/// @returns: pointer to the @a`tszDestination` advanced by @a`nCount`
+	template <bool bUpper, typename T>
+	constexpr T* ConvertCaseScalar(T* tszDestination, const T* tszSource, std::size_t nCount)
+	{
+		using ConversionType_t = std::conditional_t<std::is_same_v<T, char>, int, wint_t>;
+
+		for (; nCount > 0U; --nCount)
+		{
+			const ConversionType_t tchSource = static_cast<ConversionType_t>(*tszSource++);
+			*tszDestination++ = static_cast<T>(bUpper ? CharToUpper(tchSource) : CharToLower(tchSource));
+		}
+
+		return tszDestination;
+	}
+
+#ifdef Q_ISA_SSE2
+	/// convert the block of characters to uppercase or lowercase with range masks
+	/// @remarks: the source and destination may be the same block
+	/// @returns: true if the block has been converted, false if it contains non-ASCII wide characters that must be converted by 'ConvertCaseScalar()'
+	template <bool bUpper, typename T>
+	Q_INLINE inline bool ConvertCaseBlock(T* tszDestination, const T* tszSource)
+	{
+		constexpr int iFirst = (bUpper ? 'a' : 'A');
+		const __m128i vecChars = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(tszSource));
+
+		__m128i vecMask, vecCaseBit;
+		if constexpr (sizeof(T) == 1U)
+		{
+			// shift the letters range to the beginning of the signed range to check it with single comparison
+			const __m128i vecShifted = ::_mm_add_epi8(vecChars, ::_mm_set1_epi8(static_cast<char>(0x80 - iFirst)));
+			vecMask = ::_mm_cmpgt_epi8(::_mm_set1_epi8(static_cast<char>(0x80 + ('Z' - 'A' + 1))), vecShifted);
+			vecCaseBit = ::_mm_set1_epi8('a' ^ 'A');
+		}
+		else if constexpr (sizeof(T) == 2U)
+		{
+			// saturated subtraction is non-zero only for the characters above the ASCII range
+			if (::_mm_movemask_epi8(::_mm_cmpeq_epi16(::_mm_subs_epu16(vecChars, ::_mm_set1_epi16(0x7F)), ::_mm_setzero_si128())) != 0xFFFF)
+				return false;
+
+			vecMask = ::_mm_and_si128(::_mm_cmpgt_epi16(vecChars, ::_mm_set1_epi16(iFirst - 1)), ::_mm_cmpgt_epi16(::_mm_set1_epi16(iFirst + ('Z' - 'A' + 1)), vecChars));
+			vecCaseBit = ::_mm_set1_epi16('a' ^ 'A');
+		}
+		else
+		{
+			// @note: characters with the sign bit set are above the ASCII range as well
+			if (::_mm_movemask_epi8(::_mm_or_si128(::_mm_cmpgt_epi32(vecChars, ::_mm_set1_epi32(0x7F)), ::_mm_cmpgt_epi32(::_mm_setzero_si128(), vecChars))) != 0)
+				return false;
+
+			vecMask = ::_mm_and_si128(::_mm_cmpgt_epi32(vecChars, ::_mm_set1_epi32(iFirst - 1)), ::_mm_cmpgt_epi32(::_mm_set1_epi32(iFirst + ('Z' - 'A' + 1)), vecChars));
+			vecCaseBit = ::_mm_set1_epi32('a' ^ 'A');
+		}
+
+		// letters differ only by the case bit
+		::_mm_storeu_si128(reinterpret_cast<__m128i*>(tszDestination), ::_mm_xor_si128(vecChars, ::_mm_and_si128(vecMask, vecCaseBit)));
+		return true;
+	}
+#endif
+
+	/// convert the given count of characters to uppercase or lowercase
+	/// @remarks: ASCII characters are converted by the blocks of up to 64 bytes per step, wide blocks that contain non-ASCII characters are converted one character at a time
+	/// @returns: pointer to the @a`tszDestination` advanced by @a`nCount`
+	template <bool bUpper, typename T>
+	Q_INLINE inline T* ConvertCase(T* tszDestination, const T* tszSource, const std::size_t nCount)
+	{
+	#ifdef Q_ISA_SSE2
+		constexpr std::size_t nBlockLength = sizeof(__m128i) / sizeof(T);
+		constexpr std::size_t nStepLength = nBlockLength * 4U;
+
+		std::size_t i = 0U;
+		for (; i + nStepLength <= nCount; i += nStepLength)
+		{
+			for (std::size_t j = i; j < i + nStepLength; j += nBlockLength)
+			{
+				if (!ConvertCaseBlock<bUpper>(tszDestination + j, tszSource + j))
+					ConvertCaseScalar<bUpper>(tszDestination + j, tszSource + j, nBlockLength);
+			}
+		}
+
+		for (; i + nBlockLength <= nCount; i += nBlockLength)
+		{
+			if (!ConvertCaseBlock<bUpper>(tszDestination + i, tszSource + i))
+				ConvertCaseScalar<bUpper>(tszDestination + i, tszSource + i, nBlockLength);
+		}
+
+		if (i == nCount)
+			return tszDestination + nCount;
+
+		// convert the tail with the last whole block, that overlaps already converted characters, conversion of the ASCII characters is idempotent
+		if (nCount >= nBlockLength && ConvertCaseBlock<bUpper>(tszDestination + nCount - nBlockLength, tszSource + nCount - nBlockLength))
+			return tszDestination + nCount;
+
+		return ConvertCaseScalar<bUpper>(tszDestination + i, tszSource + i, nCount - i);
+	#else
+		return ConvertCaseScalar<bUpper>(tszDestination, tszSource, nCount);
+	#endif
+	}
 }
 
 /* @section: [internal] constants */
@@ -48,6 +200,275 @@ inline constexpr char arrDigitPairHexLUT[] =
 "A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
 "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
 "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+// powers of 10 that are representable by 64-bit unsigned integer
+inline constexpr std::uint64_t arrPowersOf10[] =
+{
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+	10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+	10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+// powers of 10 that are exactly representable by single-precision floating-point number
+inline constexpr float arrPowersOf10Float[] =
+{
+	1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+namespace DETAIL
+{
+	// extra precision bits of the fixed-point decimal fraction, limited by the product of 10^8 and the multiplier that must fit into 64 bits
+	inline constexpr int kDecimalFractionShift = 25;
+	// ceiling of '2^(32 + kDecimalFractionShift) / 10^(2 * i)', to convert the value to the fixed-point fraction with 32 integer bits
+	inline constexpr std::uint64_t arrDecimalFractionMultipliers[] =
+	{
+		0ULL,
+		(1ULL << (32 + kDecimalFractionShift)) / 100ULL + 1ULL,
+		(1ULL << (32 + kDecimalFractionShift)) / 10000ULL + 1ULL,
+		(1ULL << (32 + kDecimalFractionShift)) / 1000000ULL + 1ULL
+	};
+
+	/// @returns: count of the decimal digits of the given value, zero has single digit
+	[[nodiscard]] constexpr int CountDecimalDigits(const std::uint64_t ullValue)
+	{
+		// approximate the decimal logarithm from the binary one as 'log10(2) ~= 1233 / 4096', then correct it by the single comparison
+		const int nDigitCount = (static_cast<int>(std::bit_width(ullValue | 1ULL)) * 1233) >> 12;
+		return nDigitCount + ((ullValue | 1ULL) >= arrPowersOf10[nDigitCount] ? 1 : 0);
+	}
+
+	/// @returns: count of the decimal digits of the given value wider than 64 bits, zero has single digit
+	template <typename U> requires (sizeof(U) > sizeof(std::uint64_t))
+	[[nodiscard]] constexpr int CountDecimalDigits(const U uValue)
+	{
+		if (uValue > (std::numeric_limits<std::uint64_t>::max)())
+			return 19 + CountDecimalDigits(static_cast<U>(uValue / arrPowersOf10[19]));
+
+		return CountDecimalDigits(static_cast<std::uint64_t>(uValue));
+	}
+
+	/// write exactly the given count of decimal digits of the value, including leading zeros, forward from the destination
+	/// @param[in] uValue value less than 10^8
+	/// @param[in] nDigitCount count of digits to write, in range [1 .. 8]
+	/// @remarks: instead of division by 100 per each pair of digits, value is converted once to the fixed-point fraction with 32 integer bits, whose integer part holds the leading digits, then each next pair is extracted by multiplication of the fractional part by 100
+	/// @returns: pointer to the @a`tszDestination` advanced by @a`nDigitCount`
+	template <typename T>
+	constexpr T* WriteDecimalDigits(T* tszDestination, const std::uint32_t uValue, const int nDigitCount)
+	{
+		if (nDigitCount == 1)
+		{
+			*tszDestination++ = static_cast<T>('0' + uValue);
+			return tszDestination;
+		}
+
+		if (nDigitCount == 2)
+		{
+			tszDestination[0] = static_cast<T>(arrDigitPairLUT[uValue * 2U]);
+			tszDestination[1] = static_cast<T>(arrDigitPairLUT[uValue * 2U + 1U]);
+			return tszDestination + 2;
+		}
+
+		// count of the digits that follow the leading one or two digits, always even
+		const int nFractionDigitCount = (nDigitCount - 1) & ~1;
+		// multiplier and the extra unit after the shift keep the fraction slightly above the exact one, so the truncation never loses a digit, while the excess multiplied by 10^6 is still less than one unit of the last digit
+		std::uint64_t ullFixed = ((static_cast<std::uint64_t>(uValue) * arrDecimalFractionMultipliers[nFractionDigitCount >> 1]) >> kDecimalFractionShift) + 1ULL;
+
+		if ((nDigitCount & 1) != 0)
+			*tszDestination++ = static_cast<T>('0' + (ullFixed >> 32U));
+		else
+		{
+			const std::size_t nPairIndex = static_cast<std::size_t>(ullFixed >> 32U) * 2U;
+			tszDestination[0] = static_cast<T>(arrDigitPairLUT[nPairIndex]);
+			tszDestination[1] = static_cast<T>(arrDigitPairLUT[nPairIndex + 1U]);
+			tszDestination += 2;
+		}
+
+		for (int i = 0; i < nFractionDigitCount; i += 2)
+		{
+			ullFixed = static_cast<std::uint64_t>(static_cast<std::uint32_t>(ullFixed)) * 100ULL;
+
+			const std::size_t nPairIndex = static_cast<std::size_t>(ullFixed >> 32U) * 2U;
+			tszDestination[0] = static_cast<T>(arrDigitPairLUT[nPairIndex]);
+			tszDestination[1] = static_cast<T>(arrDigitPairLUT[nPairIndex + 1U]);
+			tszDestination += 2;
+		}
+
+		return tszDestination;
+	}
+
+	/// write exactly 19 decimal digits of the limb of the value wider than 64 bits, including leading zeros, forward from the destination
+	/// @param[in] ullLimb value less than 10^19
+	/// @returns: pointer to the @a`tszDestination` advanced by 19
+	template <typename T>
+	constexpr T* WriteDecimalLimb(T* tszDestination, const std::uint64_t ullLimb)
+	{
+		const std::uint64_t ullLowGroups = ullLimb % arrPowersOf10[16];
+		tszDestination = WriteDecimalDigits(tszDestination, static_cast<std::uint32_t>(ullLimb / arrPowersOf10[16]), 3);
+		tszDestination = WriteDecimalDigits(tszDestination, static_cast<std::uint32_t>(ullLowGroups / 100000000U), 8);
+		return WriteDecimalDigits(tszDestination, static_cast<std::uint32_t>(ullLowGroups % 100000000U), 8);
+	}
+
+	/// write the digits of the value in the given base backward from the end of the destination
+	/// @remarks: digit extraction is specialized for the base at compile time, decimal and hexadecimal digits are written in pairs, digits of other power of two bases are extracted by shifts. decimal values wider than 64 bits are split into the limbs of 19 digits, so only the limb division is done with the wide arithmetic
+	/// @returns: pointer to the first written digit
+	template <std::size_t uBase, typename U, typename T>
+	constexpr T* WriteDigitsBackward(U uValue, T* tszDestinationEnd)
+	{
+		if constexpr (uBase == 10U && sizeof(U) > sizeof(std::uint64_t))
+		{
+			while (uValue > (std::numeric_limits<std::uint64_t>::max)())
+			{
+				T* tszLimbBegin = tszDestinationEnd - 19;
+				tszDestinationEnd = WriteDigitsBackward<10U>(static_cast<std::uint64_t>(uValue % arrPowersOf10[19]), tszDestinationEnd);
+				uValue /= arrPowersOf10[19];
+
+				// pad the inner limb with leading zeros
+				while (tszDestinationEnd != tszLimbBegin)
+					*--tszDestinationEnd = '0';
+			}
+
+			return WriteDigitsBackward<10U>(static_cast<std::uint64_t>(uValue), tszDestinationEnd);
+		}
+		else if constexpr (uBase == 10U)
+		{
+			while (uValue >= 100U)
+			{
+				tszDestinationEnd -= 2;
+
+				const char* szTwoDigits = &arrDigitPairLUT[(uValue % 100U) * 2U];
+				tszDestinationEnd[0] = szTwoDigits[0];
+				tszDestinationEnd[1] = szTwoDigits[1];
+
+				uValue /= 100U;
+			}
+
+			if (uValue < 10U)
+				*--tszDestinationEnd = arrAlphanumericLUT[uValue];
+			else
+			{
+				tszDestinationEnd -= 2;
+				tszDestinationEnd[0] = arrDigitPairLUT[uValue * 2U];
+				tszDestinationEnd[1] = arrDigitPairLUT[uValue * 2U + 1U];
+			}
+		}
+		else if constexpr (uBase == 16U)
+		{
+			while (uValue > 0xFF)
+			{
+				tszDestinationEnd -= 2;
+
+				const char* szTwoDigits = &arrDigitPairHexLUT[(uValue & 0xFF) * 2U];
+				tszDestinationEnd[0] = szTwoDigits[0];
+				tszDestinationEnd[1] = szTwoDigits[1];
+
+				uValue >>= 8U;
+			}
+
+			if (uValue < 0x10)
+				*--tszDestinationEnd = arrAlphanumericLUT[uValue];
+			else
+			{
+				tszDestinationEnd -= 2;
+				tszDestinationEnd[0] = arrDigitPairHexLUT[uValue * 2U];
+				tszDestinationEnd[1] = arrDigitPairHexLUT[uValue * 2U + 1U];
+			}
+		}
+		else if constexpr (std::has_single_bit(uBase))
+		{
+			constexpr int nDigitWidth = std::countr_zero(uBase);
+
+			do
+			{
+				*--tszDestinationEnd = arrAlphanumericLUT[uValue & (uBase - 1U)];
+				uValue >>= nDigitWidth;
+			} while (uValue != 0U);
+		}
+		else
+		{
+			do
+			{
+				*--tszDestinationEnd = arrAlphanumericLUT[uValue % uBase];
+				uValue /= uBase;
+			} while (uValue != 0U);
+		}
+
+		return tszDestinationEnd;
+	}
+
+#ifdef Q_ISA_SSE2
+	/// convert two values less than 10^8 to 8 decimal digits each, including leading zeros
+	/// @remarks: splits each value into two groups of 4 digits with single multiplication, then extracts all digits of the groups at once by multiplication with the reciprocals of the powers of 10 in the 16-bit lanes
+	/// @returns: vector of ASCII digits, digits of the @a`uFirst` value are in the low 8 bytes
+	Q_INLINE inline __m128i ConvertDecimalDigitGroups(const std::uint32_t uFirst, const std::uint32_t uSecond)
+	{
+		const __m128i vecValues = ::_mm_set_epi32(0, static_cast<int>(uSecond), 0, static_cast<int>(uFirst));
+
+		// 'abcdefgh' / 10000 = 'abcd', where 0xD1B71759 / 2^45 ~= 1 / 10000
+		const __m128i vecHigh = ::_mm_srli_epi64(::_mm_mul_epu32(vecValues, ::_mm_set1_epi32(static_cast<int>(0xD1B71759))), 45);
+		// 'abcdefgh' - 'abcd' * 10000 = 'efgh'
+		const __m128i vecLow = ::_mm_sub_epi32(vecValues, ::_mm_mul_epu32(vecHigh, ::_mm_set1_epi32(10000)));
+
+		// 16-bit lanes of [abcd, efgh] groups of both values, premultiplied by 4 to keep the precision of the reciprocals
+		const __m128i vecGroups = ::_mm_slli_epi16(::_mm_packs_epi32(::_mm_unpacklo_epi32(vecHigh, vecLow), ::_mm_unpackhi_epi32(vecHigh, vecLow)), 2);
+
+		// [abcd / 1000, abcd / 100, abcd / 10, abcd, efgh / 1000, efgh / 100, efgh / 10, efgh]
+		const __m128i vecDividers = ::_mm_setr_epi16(8389, 5243, 13108, static_cast<short>(32768), 8389, 5243, 13108, static_cast<short>(32768));
+		const __m128i vecShifts = ::_mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, static_cast<short>(1 << 15), 1 << 7, 1 << 11, 1 << 13, static_cast<short>(1 << 15));
+		const auto ExtractDigits = [&](const __m128i vecGroup)
+		{
+			const __m128i vecQuotients = ::_mm_mulhi_epu16(::_mm_mulhi_epu16(::_mm_unpacklo_epi32(vecGroup, vecGroup), vecDividers), vecShifts);
+			// subtract the tens of each quotient, that are the previous quotient multiplied by 10
+			return ::_mm_sub_epi16(vecQuotients, ::_mm_slli_epi64(::_mm_mullo_epi16(vecQuotients, ::_mm_set1_epi16(10)), 16));
+		};
+
+		const __m128i vecDigits = ::_mm_packus_epi16(ExtractDigits(::_mm_unpacklo_epi16(vecGroups, vecGroups)), ExtractDigits(::_mm_unpackhi_epi16(vecGroups, vecGroups)));
+		return ::_mm_add_epi8(vecDigits, ::_mm_set1_epi8('0'));
+	}
+
+	/// write the decimal digits of the value forward from the destination with the SIMD digit extraction
+	/// @remarks: may write up to 8 extra characters past the end of the written digits
+	/// @returns: pointer past the last written digit
+	Q_INLINE inline char* WriteDecimalDigitsVector(char* szDestination, std::uint64_t ullValue, const int nDigitCount)
+	{
+		if (nDigitCount <= 8)
+		{
+			// drop the leading zeros by the shift of the digits
+			const __m128i vecDigits = ConvertDecimalDigitGroups(static_cast<std::uint32_t>(ullValue), 0U);
+			::_mm_storel_epi64(reinterpret_cast<__m128i*>(szDestination), ::_mm_srl_epi64(vecDigits, ::_mm_cvtsi32_si128((8 - nDigitCount) * 8)));
+			return szDestination + nDigitCount;
+		}
+
+		if (nDigitCount > 16)
+		{
+			const auto uTopGroup = static_cast<std::uint32_t>(ullValue / 10000000000000000ULL);
+			szDestination = WriteDecimalDigits(szDestination, uTopGroup, nDigitCount - 16);
+			ullValue %= 10000000000000000ULL;
+		}
+
+		const int nFirstGroupDigitCount = (nDigitCount > 16 ? 8 : nDigitCount - 8);
+		const __m128i vecDigits = ConvertDecimalDigitGroups(static_cast<std::uint32_t>(ullValue / 100000000U), static_cast<std::uint32_t>(ullValue % 100000000U));
+		::_mm_storel_epi64(reinterpret_cast<__m128i*>(szDestination), ::_mm_srl_epi64(vecDigits, ::_mm_cvtsi32_si128((8 - nFirstGroupDigitCount) * 8)));
+		::_mm_storel_epi64(reinterpret_cast<__m128i*>(szDestination + nFirstGroupDigitCount), ::_mm_unpackhi_epi64(vecDigits, vecDigits));
+		return szDestination + nFirstGroupDigitCount + 8;
+	}
+
+	/// write the decimal digits of the value less than 10^10 forward from the destination, where the last 8 digits are already converted with 'ConvertDecimalDigitGroups()'
+	/// @param[in] vecGroupDigits digits of the value modulo 10^8 in the low 8 bytes
+	/// @remarks: may write up to 8 extra characters past the end of the written digits
+	/// @returns: pointer past the last written digit
+	Q_INLINE inline char* WriteDecimalDigitGroup(char* szDestination, const std::uint64_t ullValue, const int nDigitCount, const __m128i vecGroupDigits)
+	{
+		if (nDigitCount <= 8)
+		{
+			::_mm_storel_epi64(reinterpret_cast<__m128i*>(szDestination), ::_mm_srl_epi64(vecGroupDigits, ::_mm_cvtsi32_si128((8 - nDigitCount) * 8)));
+			return szDestination + nDigitCount;
+		}
+
+		// leading one or two digits
+		szDestination = WriteDecimalDigits(szDestination, static_cast<std::uint32_t>(ullValue / 100000000U), nDigitCount - 8);
+		::_mm_storel_epi64(reinterpret_cast<__m128i*>(szDestination), vecGroupDigits);
+		return szDestination + 8;
+	}
+#endif
+}
 
 /*
  * - according to IEEE-754:
@@ -91,6 +512,8 @@ struct RealTraits_t
 	static constexpr int kExponentDecimalMin = (std::is_same_v<T, double> ? -324 : -45);
 	static constexpr int kExponentDecimalMax = (std::is_same_v<T, double> ? 308 : 38);
 	static constexpr int kExponentDenormalMin = (kExponentMin - static_cast<int>(kMantissaWidth));
+	// maximal count of the significant decimal digits of the exact value
+	static constexpr std::size_t kMaxSignificantDigits = (std::is_same_v<T, double> ? 767U : 112U);
 
 	static constexpr BitEquivalent_t kMantissaMask = (BitEquivalent_t(1U) << kMantissaWidth) - 1U;
 	static constexpr BitEquivalent_t kSignMask = (BitEquivalent_t(1U) << (kExponentWidth + kMantissaWidth));
@@ -98,7 +521,7 @@ struct RealTraits_t
 	static constexpr BitEquivalent_t kQuietNanMask = (BitEquivalent_t(1U) << (kMantissaWidth - 1U));
 };
 
-template <typename T, std::size_t uBase> requires (std::is_integral_v<T> && uBase > 0U && uBase <= kMaxNumberBase)
+template <typename T, std::size_t uBase> requires (DETAIL::IsIntegral_v<T> && uBase > 0U && uBase <= kMaxNumberBase)
 struct IntegerToString_t
 {
 	/// @returns: maximum count of characters needed for integer-to-string conversion, including terminating null and negative sign where appropriate
@@ -106,11 +529,12 @@ struct IntegerToString_t
 	{
 		std::size_t nDigitsCount = 0U;
 
-		constexpr std::uint64_t ullNegativeMax = (std::is_unsigned_v<T> ? (std::numeric_limits<T>::max)() : (static_cast<std::uint64_t>((std::numeric_limits<T>::max)()) + 1ULL));
-		for (std::uint64_t nShift = ullNegativeMax; nShift != 0ULL; nShift /= uBase)
+		using UnsignedType_t = DETAIL::MakeUnsigned_t<T>;
+		constexpr UnsignedType_t uNegativeMax = (!DETAIL::IsSigned_v<T> ? DETAIL::GetIntegerMax<T>() : (static_cast<UnsignedType_t>(DETAIL::GetIntegerMax<T>()) + 1U));
+		for (UnsignedType_t uShift = uNegativeMax; uShift != 0U; uShift /= uBase)
 			++nDigitsCount;
 
-		return (nDigitsCount + (std::is_signed_v<T> && uBase == 10U ? 1U : 0U) + 1U);
+		return (nDigitsCount + (DETAIL::IsSigned_v<T> && uBase == 10U ? 1U : 0U) + 1U);
 	}
 };
 
@@ -173,8 +597,7 @@ struct BigInteger_t
 		this->ullLow = ::__builtin_addcll(this->ullLow, other.ullLow, 0ULL, reinterpret_cast<unsigned long long*>(&ullCarryLow));
 		this->ullHigh += other.ullHigh + ullCarryLow;
 	#elif defined(Q_COMPILER_GCC) && Q_ARCH_BIT == 64
-		// @test: haven't tested that
-		this->ullHigh += ::__builtin_add_overflow(this->ullLow, other.ullLow, &this->ullLow);
+		this->ullHigh += other.ullHigh + ::__builtin_add_overflow(this->ullLow, other.ullLow, &this->ullLow);
 	#elif defined(Q_COMPILER_MSC) && Q_ARCH_BIT == 64
 		const unsigned char uCarryLow = ::_addcarry_u64(0U, this->ullLow, other.ullLow, &this->ullLow);
 		this->ullHigh += other.ullHigh + uCarryLow;
@@ -239,993 +662,3150 @@ struct BigInteger_t
 	std::uint64_t ullHigh;
 };
 
-template <typename T>
-concept HasTmZone_t = requires { T::tm_zone; };
-template <typename T>
-concept HasTmGmtOff_t = requires { T::tm_gmtoff; };
-
-/// reverse every character in the string, alternative of '_strrev()', '_wcsrev()'
-/// @returns: pointer to the @a`tszSource`
-template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
-constexpr T* StringReverse(T* tszSource)
+namespace DETAIL
 {
-	T* tszSourceCurrent = tszSource, *tszSourceEnd = tszSource + StringLength(tszSource);
-	while (tszSourceCurrent < tszSourceEnd)
+	// decimal representation of the floating-point number as 'ullSignificand * 10^iExponent'
+	struct DecimalReal_t
 	{
-		// @test: is xor would be really faster than temporary store?
-		T tchCurrent = *tszSourceCurrent++, tchEnd = *--tszSourceEnd;
-		tchCurrent ^= tchEnd;
-		tchEnd ^= tchCurrent;
-		*tszSourceCurrent = tchCurrent ^ tchEnd;
-		*tszSourceEnd = tchEnd;
+		std::uint64_t ullSignificand;
+		int iExponent;
+	};
+
+	/// @returns: 'floor(log2(10^iExponent))', valid for exponents in range [-1233 .. 1233]
+	[[nodiscard]] constexpr int FloorLog2Pow10(const int iExponent)
+	{
+		return (iExponent * 1741647) >> 19;
 	}
 
-	return tszSource;
-}
+	/// @returns: 'floor(log10(2^iExponent))', valid for exponents in range [-2620 .. 2620]
+	[[nodiscard]] constexpr int FloorLog10Pow2(const int iExponent)
+	{
+		return (iExponent * 1262611) >> 22;
+	}
 
-/// convert every character in the string to uppercase, alternative of '_strupr()', @todo: '_wcsupr()'
-/// @returns: pointer to the @a`tszDestination`
-template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
-constexpr T* StringToUpper(T* tszDestination)
-{
-	T* tszDestinationOut = tszDestination;
+	/// @returns: 'floor(log10(3/4 * 2^iExponent))', valid for exponents in range [-2985 .. 2936]
+	[[nodiscard]] constexpr int FloorLog10ThreeQuartersPow2(const int iExponent)
+	{
+		return (iExponent * 1262611 - 524031) >> 22;
+	}
 
-	while (*tszDestinationOut != '\0')
-		*tszDestinationOut = static_cast<T>(CharToUpper(*tszDestinationOut++));
+	/// multiply the given value by the normalized significand of the power of 10, scaled down by 2^128 for double and by 2^64 for float, and round the result to odd
+	/// @remarks: significand from the table is truncated, so it's incremented by one to always overestimate the power, which never overflows the low half
+	template <typename U>
+	Q_INLINE inline U MultiplyPow10RoundToOdd(const std::uint64_t(&arrSignificand)[2], const U uValue)
+	{
+		std::uint64_t ullHigh;
+		if constexpr (sizeof(U) == sizeof(std::uint64_t))
+		{
+			std::uint64_t ullLowHigh;
+			Multiply64To128(arrSignificand[1] + 1ULL, uValue, &ullLowHigh);
+			const std::uint64_t ullLow = Multiply64To128(arrSignificand[0], uValue, &ullHigh) + ullLowHigh;
+			ullHigh += (ullLow < ullLowHigh ? 1ULL : 0ULL);
+			return ullHigh | (ullLow > 1ULL ? 1ULL : 0ULL);
+		}
+		else
+		{
+			const std::uint64_t ullLow = Multiply64To128(arrSignificand[0] + 1ULL, uValue, &ullHigh);
+			return static_cast<U>(ullHigh) | ((ullLow >> 32ULL) > 1ULL ? 1U : 0U);
+		}
+	}
 
-	return tszDestination;
-}
+	/// find the shortest decimal representation that rounds to the given finite non-zero floating-point number, closest to the exact value of the number when there are several of them
+	/// @remarks: implements Schubfach algorithm by R. Giulietti, which brackets the rounding interval of the number with a single power of 10 and three 128-bit multiplications
+	/// @returns: decimal representation, whose significand may have trailing zeros
+	template <typename V>
+	Q_INLINE inline DecimalReal_t ConvertRealToShortestDecimal(const typename RealTraits_t<V>::BitEquivalent_t uMantissa, const std::uint32_t uExponent)
+	{
+		using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
 
-/// convert every character in the string to lowercase, alternative of '_strlwr()', '_wcslwr()'
-/// @returns: pointer to the @a`tszDestination`
-template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
-constexpr T* StringToLower(T* tszDestination)
-{
-	T* tszDestinationOut = tszDestination;
+		UIntType_t uSignificand;
+		int iBinaryExponent;
 
-	while (*tszDestinationOut != '\0')
-		*tszDestinationOut = static_cast<T>(CharToLower(*tszDestinationOut++));
+		if (uExponent == 0U)
+		{
+			uSignificand = uMantissa;
+			iBinaryExponent = RealTraits_t<V>::kExponentDenormalMin;
+		}
+		else
+		{
+			uSignificand = uMantissa | (static_cast<UIntType_t>(1U) << RealTraits_t<V>::kMantissaWidth);
+			iBinaryExponent = static_cast<int>(uExponent) - RealTraits_t<V>::kExponentBias - static_cast<int>(RealTraits_t<V>::kMantissaWidth);
 
-	return tszDestination;
-}
+			// check for the integer values, whose shortest representation is the integer itself
+			if (iBinaryExponent <= 0 && iBinaryExponent >= -static_cast<int>(RealTraits_t<V>::kMantissaWidth) && (uSignificand & ((static_cast<UIntType_t>(1U) << -iBinaryExponent) - 1U)) == 0U)
+				return { static_cast<std::uint64_t>(uSignificand >> -iBinaryExponent), 0 };
+		}
 
-// @todo: rework sprintf like, with specific format flags right here
-/// convert an integer to a string, alternative of 'to_string()', 'to_chars()', '_itoa()', '_ltoa()', '_ultoa()', '_i64toa()', '_ui64toa()'
-/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
-/// @param[in] iBase numeric base in range [2 .. 36] to use to represent the number
-/// @remarks: converts the digits of the given value argument to a null-terminated character string and store the result in @a`tszDestination` buffer. all writes begin from the end of the buffer and may overrun past the bounds of a buffer that is too small, to ensure that buffer is large enough, use @code CRT::IntegerToString_t<T, iBase>::MaxCount() @endcode
-/// @returns: pointer to the beginning of the converted integer in the buffer
-template <typename V, typename T> requires (std::is_integral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
-T* IntegerToString(const V value, T* tszDestination, const std::size_t nDestinationSize, int iBase = 10) // @todo: couldn't it be constexpr?
-{
-	if (iBase < 0 || iBase == 1 || iBase > kMaxNumberBase)
-	{
-		Q_ASSERT(false); // given number base is out of range
-		return tszDestination;
-	}
+		// boundaries of the rounding interval are inclusive only when the significand is even, due to round-half-to-even of the parsing
+		const bool bIsEven = (uSignificand & 1U) == 0U;
+		// lower boundary is closer when the number is a power of 2, except the smallest normalized number, whose predecessor is the largest denormalized one
+		const bool bIsLowerBoundaryCloser = (uMantissa == 0U && uExponent > 1U);
 
-	const bool bIsPositive = (value >= 0);
-	std::make_unsigned_t<V> uValue = (bIsPositive ? static_cast<std::make_unsigned_t<V>>(value) : static_cast<std::make_unsigned_t<V>>(0 - value)); // @test: how it actually compiles, can avoid branch at compile time
+		// the number and its rounding interval boundaries, scaled by 4 to be integers
+		const UIntType_t uCenter = uSignificand << 2U;
+		const UIntType_t uLower = uCenter - 2U + (bIsLowerBoundaryCloser ? 1U : 0U);
+		const UIntType_t uUpper = uCenter + 2U;
 
-	T* tszDestinationEnd = tszDestination + nDestinationSize;
-	*--tszDestinationEnd = '\0';
+		// select the power of 10 such that the rounding interval contains at most one number with one digit less than the scaled number
+		const int iDecimalExponent = (bIsLowerBoundaryCloser ? FloorLog10ThreeQuartersPow2(iBinaryExponent) : FloorLog10Pow2(iBinaryExponent));
+		const int iShift = iBinaryExponent + FloorLog2Pow10(-iDecimalExponent) + 1;
+		const std::uint64_t(&arrSignificand)[2] = arrPowersOf10Significand[-iDecimalExponent - kPowersOf10SignificandMin];
 
-	if (uValue == 0U)
-		*--tszDestinationEnd = '0';
-	else if (iBase == 10)
-	{
-		// for decimal base write two digits in a group
-		while (uValue >= 10U)
-		{
-			tszDestinationEnd -= 2;
+		const UIntType_t uScaledCenter = MultiplyPow10RoundToOdd(arrSignificand, static_cast<UIntType_t>(uCenter << iShift));
+		const UIntType_t uScaledLower = MultiplyPow10RoundToOdd(arrSignificand, static_cast<UIntType_t>(uLower << iShift)) + (bIsEven ? 0U : 1U);
+		const UIntType_t uScaledUpper = MultiplyPow10RoundToOdd(arrSignificand, static_cast<UIntType_t>(uUpper << iShift)) - (bIsEven ? 0U : 1U);
 
-			const char* szTwoDigits = &arrDigitPairLUT[(uValue % 100U) * 2U];
-			tszDestinationEnd[0] = szTwoDigits[0];
-			tszDestinationEnd[1] = szTwoDigits[1];
+		const UIntType_t uDigits = uScaledCenter >> 2U;
 
-			uValue /= 100U;
+		// try the representation with one digit less first
+		if (uDigits >= 10U)
+		{
+			const UIntType_t uShortDigits = uDigits / 10U;
+			const bool bIsShortLowerInside = uScaledLower <= uShortDigits * 40U;
+			const bool bIsShortUpperInside = uShortDigits * 40U + 40U <= uScaledUpper;
+
+			if (bIsShortLowerInside != bIsShortUpperInside)
+				return { static_cast<std::uint64_t>(uShortDigits + (bIsShortUpperInside ? 1U : 0U)), iDecimalExponent + 1 };
 		}
 
-		if (uValue != 0U)
-			*--tszDestinationEnd = arrAlphanumericLUT[uValue];
+		const bool bIsLowerInside = uScaledLower <= uDigits * 4U;
+		const bool bIsUpperInside = uDigits * 4U + 4U <= uScaledUpper;
 
-		// insert negative sign, only decimal base can have it
-		if (!bIsPositive)
-			*--tszDestinationEnd = '-';
+		if (bIsLowerInside != bIsUpperInside)
+			return { static_cast<std::uint64_t>(uDigits + (bIsUpperInside ? 1U : 0U)), iDecimalExponent };
+
+		// both candidates are inside, choose the closest one, or even one if the number falls midway
+		const UIntType_t uMiddle = uDigits * 4U + 2U;
+		const bool bRoundUp = uScaledCenter > uMiddle || (uScaledCenter == uMiddle && (uDigits & 1U) != 0U);
+		return { static_cast<std::uint64_t>(uDigits + (bRoundUp ? 1U : 0U)), iDecimalExponent };
 	}
-	else if (iBase == 16)
+
+	// capacity of the big number in 32-bit blocks, enough to hold the exact value of any double scaled to the single leading decimal digit and normalized for the digits generation
+	inline constexpr std::size_t kBigNumberCapacity = 40U;
+	// capacity of the big number in 32-bit blocks, enough to hold the significant decimal digits of any double, scaled to be compared with the halfway point between two doubles
+	inline constexpr std::size_t kBigNumberDecimalCapacity = 128U;
+
+	// arbitrary precision unsigned integer with the given capacity in 32-bit blocks, used to convert exactly between the decimal and floating-point numbers
+	template <std::size_t nCapacity>
+	struct BigNumber_t
 	{
-		// for hexadecimal base write two digits in a group
-		while (uValue > 0xFF)
+		Q_INLINE void Assign(const std::uint64_t ullValue)
 		{
-			tszDestinationEnd -= 2;
+			this->arrBlocks[0] = static_cast<std::uint32_t>(ullValue);
+			this->arrBlocks[1] = static_cast<std::uint32_t>(ullValue >> 32ULL);
+			this->nLength = (this->arrBlocks[1] != 0U ? 2U : (this->arrBlocks[0] != 0U ? 1U : 0U));
+		}
+
+		Q_INLINE void ShiftLeft(const std::uint32_t nCount)
+		{
+			if (this->nLength == 0U)
+				return;
+
+			const std::size_t nBlockShift = nCount / 32U;
+			const std::uint32_t nBitShift = nCount % 32U;
+
+			if (nBitShift == 0U)
+			{
+				for (std::size_t i = this->nLength; i-- > 0U;)
+					this->arrBlocks[i + nBlockShift] = this->arrBlocks[i];
+			}
+			else
+			{
+				const std::uint32_t uHighBlock = this->arrBlocks[this->nLength - 1U] >> (32U - nBitShift);
+				for (std::size_t i = this->nLength - 1U; i > 0U; --i)
+					this->arrBlocks[i + nBlockShift] = (this->arrBlocks[i] << nBitShift) | (this->arrBlocks[i - 1U] >> (32U - nBitShift));
+				this->arrBlocks[nBlockShift] = this->arrBlocks[0] << nBitShift;
+
+				if (uHighBlock != 0U)
+					this->arrBlocks[this->nLength++ + nBlockShift] = uHighBlock;
+			}
 
-			const char* szTwoDigits = &arrDigitPairHexLUT[(uValue & 0xFF) * 2U];
-			tszDestinationEnd[0] = szTwoDigits[0];
-			tszDestinationEnd[1] = szTwoDigits[1];
+			for (std::size_t i = 0U; i < nBlockShift; ++i)
+				this->arrBlocks[i] = 0U;
 
-			uValue >>= 8U;
+			this->nLength += nBlockShift;
 		}
 
-		if (uValue < 0x10)
-			*--tszDestinationEnd = arrAlphanumericLUT[uValue];
-		else
+		/// @param[in] uAddend value to add to the product
+		Q_INLINE void Multiply(const std::uint32_t uMultiplier, const std::uint32_t uAddend = 0U)
 		{
-			tszDestinationEnd -= 2;
+			std::uint64_t ullCarry = uAddend;
+			for (std::size_t i = 0U; i < this->nLength; ++i)
+			{
+				const std::uint64_t ullProduct = static_cast<std::uint64_t>(this->arrBlocks[i]) * uMultiplier + ullCarry;
+				this->arrBlocks[i] = static_cast<std::uint32_t>(ullProduct);
+				ullCarry = ullProduct >> 32ULL;
+			}
 
-			const char* szTwoDigits = &arrDigitPairHexLUT[uValue * 2U];
-			tszDestinationEnd[0] = szTwoDigits[0];
-			tszDestinationEnd[1] = szTwoDigits[1];
+			if (ullCarry != 0ULL)
+				this->arrBlocks[this->nLength++] = static_cast<std::uint32_t>(ullCarry);
 		}
-	}
-	else
-	{
-		// for other bases perform write by single digit
-		while (uValue != 0U)
+
+		Q_INLINE void MultiplyPow10(int nExponent)
 		{
-			*--tszDestinationEnd = arrAlphanumericLUT[uValue % iBase];
-			uValue /= iBase;
+			for (; nExponent >= 9; nExponent -= 9)
+				this->Multiply(1000000000U);
+
+			if (nExponent > 0)
+				this->Multiply(static_cast<std::uint32_t>(arrPowersOf10[nExponent]));
 		}
-	}
 
-	return tszDestinationEnd;
-}
+		Q_INLINE void MultiplyPow5(int nExponent)
+		{
+			// 5^13 is the greatest power that fits the multiplier
+			for (; nExponent >= 13; nExponent -= 13)
+				this->Multiply(1220703125U);
 
-// @todo: rework sprintf like, with specific format flags right here
-/// convert a floating-point number to a string, alternative of 'to_string()', 'to_chars()'
-/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
-/// @param[in] iPrecision number of fractional digits to print
-/// @remarks: converts the digits of the given floating-point @a`value` to a null-terminated string and store the result in @a`tszDestination` buffer. can write either from begin of the buffer or from the end, or past the bounds of a buffer that is too small, to ensure that buffer is large enough, use 310 + @a`iPrecision`
-/// @returns: pointer to the beginning of the converted floating-point number in the buffer
-template <typename V, typename T> requires (std::is_floating_point_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
-T* RealToString(const V value, T* tszDestination, const std::size_t nDestinationSize, int iPrecision = 6)
-{
-	using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
-	auto uBits = std::bit_cast<UIntType_t>(value);
-	auto uExponent = static_cast<std::uint16_t>((uBits & RealTraits_t<V>::kExponentMask) >> RealTraits_t<V>::kMantissaWidth);
-	auto uMantissa = uBits & RealTraits_t<V>::kMantissaMask;
-	const bool bIsNegative = (uBits & RealTraits_t<V>::kSignMask) != 0U;
+			if (nExponent > 0)
+				this->Multiply(static_cast<std::uint32_t>(arrPowersOf10[nExponent] >> nExponent));
+		}
 
-	T* tszDestinationEnd = tszDestination;
+		/// subtract the product of the other number and the multiplier, that must not be greater than this number
+		Q_INLINE void SubtractMultiple(const BigNumber_t& other, const std::uint32_t uMultiplier)
+		{
+			std::uint64_t ullBorrow = 0ULL;
+			std::size_t i = 0U;
+			for (; i < other.nLength; ++i)
+			{
+				const std::uint64_t ullProduct = static_cast<std::uint64_t>(other.arrBlocks[i]) * uMultiplier + ullBorrow;
+				const auto uProductLow = static_cast<std::uint32_t>(ullProduct);
+				ullBorrow = (ullProduct >> 32ULL) + (this->arrBlocks[i] < uProductLow ? 1ULL : 0ULL);
+				this->arrBlocks[i] -= uProductLow;
+			}
 
-	// check if the all bits of the exponent is set
-	if (uExponent == (1U << RealTraits_t<V>::kExponentWidth) - 1U)
-	{
-		if (bIsNegative)
-			*tszDestinationEnd++ = '-';
+			for (; ullBorrow != 0ULL; ++i)
+			{
+				ullBorrow = (this->arrBlocks[i] == 0U ? 1ULL : 0ULL);
+				--this->arrBlocks[i];
+			}
 
-		// check if any of the mantissa bits is set, indicating that value is NaN
-		if (uMantissa != 0U)
-		{
-			// a double argument representing a NaN is converted in one of the styles [-]nan or [-]nan(n-wchar-sequence) - which style, and the meaning of any n-wchar-sequence, is implementation-defined (C standard 7.21.6.1)
-			*tszDestinationEnd++ = 'n';
-			*tszDestinationEnd++ = 'a';
-			*tszDestinationEnd++ = 'n';
-			*tszDestinationEnd = '\0';
-		}
-		else
-		{
-			// a double argument representing an infinity is converted in one of the styles [-]inf or [-]infinity - which style is implementation-defined (C standard 7.21.6.1)
-			*tszDestinationEnd++ = 'i';
-			*tszDestinationEnd++ = 'n';
-			*tszDestinationEnd++ = 'f';
-			*tszDestinationEnd = '\0';
+			// remove leading zero blocks
+			while (this->nLength > 0U && this->arrBlocks[this->nLength - 1U] == 0U)
+				--this->nLength;
 		}
 
-		return tszDestination;
-	}
-
-	std::int16_t iExponentUnbiased;
-	if (uExponent == 0U)
-	{
-		// check if the value is zero
-		if (uMantissa == 0U)
+		/// @returns: <0 - if this number is less than other, 0 - if they're equal, >0 - if this number is greater than other
+		[[nodiscard]] Q_INLINE int Compare(const BigNumber_t& other) const
 		{
-			if (bIsNegative)
-				*tszDestinationEnd++ = '-';
-
-			*tszDestinationEnd++ = '0';
+			if (this->nLength != other.nLength)
+				return (this->nLength < other.nLength ? -1 : 1);
 
-			if (iPrecision > 0)
+			for (std::size_t i = this->nLength; i-- > 0U;)
 			{
-				*tszDestinationEnd++ = '.';
-				do
-				{
-					*tszDestinationEnd++ = '0';
-				} while (--iPrecision > 0);
+				if (this->arrBlocks[i] != other.arrBlocks[i])
+					return (this->arrBlocks[i] < other.arrBlocks[i] ? -1 : 1);
 			}
 
-			*tszDestinationEnd = '\0';
-			return tszDestination;
+			return 0;
 		}
 
-		// set minimum exponent for denormalized numbers
-		iExponentUnbiased = RealTraits_t<V>::kExponentDenormalMin;
-	}
-	else
-	{
-		// calculate unbiased exponent
-		iExponentUnbiased = uExponent - RealTraits_t<V>::kExponentBias;
-		// add implicit bit for normalized numbers
-		uMantissa |= static_cast<UIntType_t>(1U) << RealTraits_t<V>::kMantissaWidth;
-	}
+		std::uint32_t arrBlocks[nCapacity];
+		std::size_t nLength;
+	};
 
-	// check if the number has large value
-	const int iExponentShift = iExponentUnbiased - RealTraits_t<V>::kMantissaWidth;
-	if (iExponentShift >= 0)
+	/// generate the given count of significant decimal digits of the finite positive floating-point number 'ullSignificand * 2^iBinaryExponent', correctly rounded half to even
+	/// @param[out] szDigits buffer for the digits, must be large enough for the @a`nDigitCount` digits or for all digits of the exact value, whichever is less
+	/// @param[out] piDecimalExponent decimal exponent of the first digit
+	/// @remarks: implements the fixed-precision variant of Dragon4 algorithm by G. Steele and J. White, the digits are produced by the long division of the big numbers, where each quotient digit is estimated from their leading blocks
+	/// @returns: count of the written digits without trailing zeros, the remaining digits up to the @a`nDigitCount` are zeros
+	Q_INLINE inline int GenerateExactDecimalDigits(const std::uint64_t ullSignificand, const int iBinaryExponent, const int nDigitCount, char* szDigits, int* piDecimalExponent)
 	{
-		tszDestinationEnd += nDestinationSize;
-		*--tszDestinationEnd = '\0';
-
-		if (iPrecision > 0)
-		{
-			do
-			{
-				*--tszDestinationEnd = '0';
-			} while (--iPrecision > 0);
+		BigNumber_t<kBigNumberCapacity> numerator, denominator;
+		numerator.Assign(ullSignificand);
+		denominator.Assign(1ULL);
 
-			*--tszDestinationEnd = '.';
-		}
+		if (iBinaryExponent >= 0)
+			numerator.ShiftLeft(static_cast<std::uint32_t>(iBinaryExponent));
+		else
+			denominator.ShiftLeft(static_cast<std::uint32_t>(-iBinaryExponent));
 
-		// @todo: fast path for 64/128 bits? should also fully cover float range (39 digits)
-		const int nTotalBits = iExponentUnbiased + 1;
-		const int nTotalChunks = (nTotalBits + 31) / 32;
+		// estimate the decimal exponent from the binary one, it's either exact or one less
+		int iDecimalExponent = FloorLog10Pow2(iBinaryExponent + static_cast<int>(std::bit_width(ullSignificand)) - 1);
+		if (iDecimalExponent >= 0)
+			denominator.MultiplyPow10(iDecimalExponent);
+		else
+			numerator.MultiplyPow10(-iDecimalExponent);
 
-		const std::uint32_t nChunkIndex = iExponentShift / 32U;
-		const std::uint32_t uBitShift = iExponentShift % 32U;
-		std::uint64_t ullIntegerPart = static_cast<std::uint64_t>(uMantissa) << uBitShift;
+		// fix the estimation, so the value is scaled to the [1 .. 10) range
+		BigNumber_t<kBigNumberCapacity> denominatorNext = denominator;
+		denominatorNext.Multiply(10U);
+		if (numerator.Compare(denominatorNext) >= 0)
+		{
+			denominator = denominatorNext;
+			++iDecimalExponent;
+		}
 
-		std::uint32_t arrChunks[32] = { };
-		arrChunks[nChunkIndex] = static_cast<std::uint32_t>(ullIntegerPart); // low chunk
-		ullIntegerPart >>= 32ULL;
-		arrChunks[nChunkIndex + 1U] = static_cast<std::uint32_t>(ullIntegerPart); // middle chunk
-		// keep it conditional to not write past the end of chunks buffer
-		if (const std::uint32_t uHighChunk = static_cast<std::uint32_t>(uMantissa >> (64U - uBitShift)); uHighChunk != 0U)
-			arrChunks[nChunkIndex + 2U] = uHighChunk; // high chunk
+		// shift both numbers so the leading block of the denominator is in [2^27 .. 2^28) range, then the quotient digit estimated from the leading blocks is either exact or one less
+		const std::uint32_t nLeadingWidth = static_cast<std::uint32_t>(std::bit_width(denominator.arrBlocks[denominator.nLength - 1U]));
+		const std::uint32_t nNormalizeShift = (nLeadingWidth <= 28U ? 28U - nLeadingWidth : 60U - nLeadingWidth);
+		numerator.ShiftLeft(nNormalizeShift);
+		denominator.ShiftLeft(nNormalizeShift);
 
-		std::uint32_t uQuotient = 0U;
-		do
+		const std::uint32_t uDenominatorLeading = denominator.arrBlocks[denominator.nLength - 1U] + 1U;
+		int nWrittenCount = 0;
+		while (true)
 		{
-			std::uint32_t uRemainder = 0U;
-			for (int i = nTotalChunks - 1; i >= 0; --i)
+			std::uint32_t uDigit = (numerator.nLength < denominator.nLength ? 0U : numerator.arrBlocks[denominator.nLength - 1U] / uDenominatorLeading);
+			if (uDigit != 0U)
+				numerator.SubtractMultiple(denominator, uDigit);
+
+			if (numerator.Compare(denominator) >= 0)
 			{
-				const std::uint64_t ullChunkValue = (static_cast<std::uint64_t>(uRemainder) << 32ULL | arrChunks[i]);
-				uQuotient = static_cast<std::uint32_t>(ullChunkValue / 1000000000U);
-				uRemainder = static_cast<std::uint32_t>(ullChunkValue % 1000000000U);
-				arrChunks[i] = uQuotient;
+				numerator.SubtractMultiple(denominator, 1U);
+				++uDigit;
 			}
 
-			// faster than unrolling and printing the whole chunk at time
-			T* szDestinationChunkEnd = tszDestinationEnd - 8;
-			while (tszDestinationEnd != szDestinationChunkEnd)
+			szDigits[nWrittenCount++] = static_cast<char>('0' + uDigit);
+
+			// check if the value is exhausted, so no rounding is needed
+			if (numerator.nLength == 0U)
+				break;
+
+			if (nWrittenCount == nDigitCount)
 			{
-				tszDestinationEnd -= 2;
+				// round half to even by comparison of the doubled remainder with the denominator
+				numerator.ShiftLeft(1U);
+				if (const int iComparison = numerator.Compare(denominator); iComparison > 0 || (iComparison == 0 && (uDigit & 1U) != 0U))
+				{
+					while (nWrittenCount > 0 && szDigits[nWrittenCount - 1] == '9')
+						--nWrittenCount;
 
-				const char* szTwoDigits = &arrDigitPairLUT[(uRemainder % 100U) * 2U];
-				tszDestinationEnd[0] = szTwoDigits[0];
-				tszDestinationEnd[1] = szTwoDigits[1];
+					// check if the carry is propagated through all digits
+					if (nWrittenCount == 0)
+					{
+						szDigits[nWrittenCount++] = '1';
+						++iDecimalExponent;
+					}
+					else
+						++szDigits[nWrittenCount - 1];
+				}
 
-				uRemainder /= 100U;
+				break;
 			}
-			*--tszDestinationEnd = static_cast<T>('0' + uRemainder);
-		} while (uQuotient != 0U);
 
-		// skip leading zeros
-		while (*tszDestinationEnd == '0')
-			++tszDestinationEnd;
+			numerator.Multiply(10U);
+		}
 
-		// insert negative sign
-		if (bIsNegative)
-			*--tszDestinationEnd = '-';
+		// remove trailing zeros
+		while (szDigits[nWrittenCount - 1] == '0')
+			--nWrittenCount;
 
-		return tszDestinationEnd;
+		*piDecimalExponent = iDecimalExponent;
+		return nWrittenCount;
 	}
 
-	// extract integer and fractional parts
-	std::uint64_t ullIntegerPart = 0U;
-	std::uint64_t ullFractionalPart = uMantissa;
-	if (const std::uint32_t uShift = -iExponentShift; uShift <= RealTraits_t<V>::kMantissaWidth + 1U)
+	/// convert the number 'ullSignificand * 10^iExponent * 2^iBinaryExponent' to the bits of the nearest floating-point number
+	/// @remarks: implements Eisel-Lemire algorithm, which multiplies the normalized significand by the 128-bit significand of the power of 10 and gives up when the truncated product can't determine the rounding. single-precision uses only the high 64 bits of the power
+	/// @returns: true if the number was converted, including underflow to zero and overflow to infinity, false if it's ambiguous and must be converted by the exact path
+	template <typename V> requires (std::is_same_v<V, float> || std::is_same_v<V, double>)
+	Q_INLINE inline bool ConvertDecimalToRealFast(std::uint64_t ullSignificand, const int iExponent, const int iBinaryExponent, typename RealTraits_t<V>::BitEquivalent_t* puBits)
 	{
-		ullIntegerPart = (uMantissa >> uShift);
-		ullFractionalPart &= ((1ULL << uShift) - 1ULL);
-	}
+		using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
 
-	// reserve space for the integer part
-	tszDestinationEnd += IntegerToString_t<UIntType_t, 10U>::MaxCount(); // 64-bit maximum is 20 digits and 1 for rounding carry
-	T* tszIntegerEnd = tszDestinationEnd;
+		// count of the product bits below the mantissa, its implicit bit and the rounding bit
+		constexpr std::uint32_t kShift = 64U - RealTraits_t<V>::kMantissaWidth - 3U;
+		constexpr std::uint64_t ullShiftMask = (1ULL << kShift) - 1ULL;
 
-	// insert decimal point
-	if (iPrecision > 0)
-		*tszDestinationEnd++ = '.';
+		if (ullSignificand == 0ULL || iExponent < kPowersOf10SignificandMin || iExponent > kPowersOf10SignificandMax)
+			return false;
 
-	// adjust fixed-point representation of fractional part based on exponent
-	std::uint64_t ullStateLow = ullFractionalPart;
-	std::uint64_t ullStateHigh = 0ULL;
-	if (const int iStateShift = 128 + iExponentShift; iStateShift >= 128)
-	{
-		ullStateHigh = ullStateLow << (iStateShift - 128);
-		ullStateLow = 0ULL;
-	}
-	else if (iStateShift >= 64)
-	{
-		ullStateHigh = ullStateLow << (iStateShift - 64);
-		ullStateLow = 0ULL;
-	}
-	else if (iStateShift >= 0)
-	{
-		ullStateHigh = ullStateLow >> (64 - iStateShift);
-		ullStateLow = ullStateLow << iStateShift;
-	}
-	else
-	{
-		if (const int iRightShift = -iStateShift; iRightShift >= 128)
+		const std::uint64_t(&arrSignificand)[2] = arrPowersOf10Significand[iExponent - kPowersOf10SignificandMin];
+
+		const int nLeadingZerosCount = std::countl_zero(ullSignificand);
+		ullSignificand <<= nLeadingZerosCount;
+
+		// product of the significands is in range [2^190 .. 2^192), keep its high 128 bits
+		std::uint64_t ullProductHigh;
+		std::uint64_t ullProductLow = Multiply64To128(ullSignificand, arrSignificand[0], &ullProductHigh);
+
+		// take the low half of the power into account when the carry from it may change the rounding, which is unlikely enough for single-precision to leave it to the exact path
+		if ((ullProductHigh & ullShiftMask) == ullShiftMask && ullProductLow + ullSignificand < ullProductLow)
 		{
-			ullStateLow = 0ULL;
-			ullStateHigh = 0ULL;
+			if constexpr (std::is_same_v<V, float>)
+				return false;
+
+			std::uint64_t ullCarryHigh;
+			const std::uint64_t ullCarryLow = Multiply64To128(ullSignificand, arrSignificand[1], &ullCarryHigh);
+
+			ullProductLow += ullCarryHigh;
+			ullProductHigh += (ullProductLow < ullCarryHigh ? 1ULL : 0ULL);
+
+			if ((ullProductHigh & ullShiftMask) == ullShiftMask && ullProductLow + 1ULL == 0ULL && ullCarryLow + ullSignificand < ullCarryLow)
+				return false;
 		}
-		else if (iRightShift >= 64)
+
+		const std::uint32_t uUpperBit = static_cast<std::uint32_t>(ullProductHigh >> 63ULL);
+		std::uint64_t ullMantissa = ullProductHigh >> (uUpperBit + kShift);
+		int iBiasedExponent = FloorLog2Pow10(iExponent) + iBinaryExponent + 63 + static_cast<int>(uUpperBit) - nLeadingZerosCount + RealTraits_t<V>::kExponentBias;
+
+		// the product is exactly halfway between two floating-point numbers only if it's not truncated, which is the case when the power is exact
+		if (ullProductLow == 0ULL && (ullMantissa & 3ULL) == 1ULL && (ullMantissa << (uUpperBit + kShift)) == ullProductHigh)
 		{
-			ullStateLow = ullStateHigh >> (iRightShift - 64);
-			ullStateHigh = 0ULL;
+			if (iExponent < 0 || arrSignificand[1] != 0ULL)
+				return false;
+
+			// round half to even
+			ullMantissa &= ~1ULL;
 		}
-		else
+
+		// check for subnormal result, that loses additional bits of the mantissa
+		// @note: decimal number can't be exactly halfway between two subnormal numbers, because it would require a significand divisible by a power of 5 that doesn't fit 64 bits
+		if (iBiasedExponent <= 0)
 		{
-			ullStateLow = (ullStateHigh << (64 - iRightShift)) | (ullStateLow >> iRightShift);
-			ullStateHigh = ullStateHigh >> iRightShift;
+			const int iSubnormalShift = 1 - iBiasedExponent;
+			ullMantissa = (iSubnormalShift < 64 ? ullMantissa >> iSubnormalShift : 0ULL);
+			ullMantissa += ullMantissa & 1ULL;
+			ullMantissa >>= 1ULL;
+
+			// mantissa that is rounded up to the implicit bit sets the lowest exponent of the normalized numbers
+			*puBits = static_cast<UIntType_t>(ullMantissa);
+			return true;
 		}
+
+		ullMantissa += ullMantissa & 1ULL;
+		ullMantissa >>= 1ULL;
+
+		// check for mantissa overflow after rounding
+		if ((ullMantissa >> (RealTraits_t<V>::kMantissaWidth + 1U)) != 0ULL)
+		{
+			ullMantissa >>= 1ULL;
+			++iBiasedExponent;
+		}
+
+		// check for overflow to infinity
+		if (iBiasedExponent >= static_cast<int>((1U << RealTraits_t<V>::kExponentWidth) - 1U))
+		{
+			*puBits = RealTraits_t<V>::kExponentMask;
+			return true;
+		}
+
+		*puBits = (static_cast<UIntType_t>(iBiasedExponent) << RealTraits_t<V>::kMantissaWidth) | (static_cast<UIntType_t>(ullMantissa) & RealTraits_t<V>::kMantissaMask);
+		return true;
 	}
 
-	// calculate fractional part
-	// @note: we need to do this even if the specified precision is zero, to round the integer part correctly
-	std::uint32_t uCarry = 0U;
-	while (true)
+	/// convert the number 'ullSignificand * 2^iExponent' to the bits of the nearest floating-point number, rounded half to even
+	/// @param[in] bSticky true if the significand was truncated and the discarded bits are non-zero
+	/// @returns: ERANGE if the number overflows to infinity or underflows to zero, 0 otherwise
+	template <typename V> requires (std::is_same_v<V, float> || std::is_same_v<V, double>)
+	constexpr int ConvertBinaryToReal(std::uint64_t ullSignificand, const int iExponent, const bool bSticky, typename RealTraits_t<V>::BitEquivalent_t* puBits)
 	{
-		// early exit if fractional part exhausted
-		if ((ullStateHigh | ullStateLow) == 0ULL)
-		{
-			while (iPrecision-- > 0)
-				*tszDestinationEnd++ = '0';
+		using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
 
-			uCarry = 0U;
-			break;
+		if (ullSignificand == 0ULL)
+		{
+			*puBits = 0U;
+			return 0;
 		}
 
-		// 128-bit multiply of the state by 100
-		std::uint64_t ullLowProduct;
-		std::uint64_t ullHighProduct;
-		ullStateLow = DETAIL::Multiply64To128(ullStateLow, 100ULL, &ullLowProduct);
-		ullStateHigh = DETAIL::Multiply64To128(ullStateHigh, 100ULL, &ullHighProduct) + ullLowProduct;
-		uCarry = static_cast<std::uint32_t>(ullHighProduct);
+		const int nLeadingZerosCount = std::countl_zero(ullSignificand);
+		ullSignificand <<= nLeadingZerosCount;
 
-		if (iPrecision >= 2)
+		// biased exponent of the normalized significand in range [2^63 .. 2^64)
+		int iBiasedExponent = iExponent - nLeadingZerosCount + 63 + RealTraits_t<V>::kExponentBias;
+
+		// count of the significand bits below the mantissa, subnormal numbers lose additional bits
+		int iShift = 63 - static_cast<int>(RealTraits_t<V>::kMantissaWidth);
+		if (iBiasedExponent <= 0)
 		{
-			const char* szTwoDigits = &arrDigitPairLUT[uCarry * 2U];
-			*tszDestinationEnd++ = szTwoDigits[0];
-			*tszDestinationEnd++ = szTwoDigits[1];
-			iPrecision -= 2;
+			iShift += 1 - iBiasedExponent;
+			iBiasedExponent = 0;
 
-			// store excess digit for rounding decision
-			uCarry %= 10U;
+			// the number is less than half of the smallest subnormal
+			if (iShift > 64)
+			{
+				*puBits = 0U;
+				return ERANGE;
+			}
 		}
-		else if (iPrecision > 0)
-		{
-			*tszDestinationEnd++ = static_cast<char>('0' + uCarry / 10U);
 
-			// store excess digit for rounding decision
-			uCarry %= 10U;
-			break;
+		std::uint64_t ullMantissa = (iShift < 64 ? ullSignificand >> iShift : 0ULL);
+		const bool bHalf = ((ullSignificand >> (iShift - 1)) & 1ULL) != 0ULL;
+		const bool bBelowHalf = bSticky || (ullSignificand & ((1ULL << (iShift - 1)) - 1ULL)) != 0ULL;
+
+		if (bHalf && (bBelowHalf || (ullMantissa & 1ULL) != 0ULL))
+			++ullMantissa;
+
+		// check for mantissa overflow after rounding, subnormal number becomes normal when its mantissa reaches the implicit bit
+		if (iBiasedExponent == 0)
+		{
+			if ((ullMantissa >> RealTraits_t<V>::kMantissaWidth) != 0ULL)
+				iBiasedExponent = 1;
 		}
-		else
+		else if ((ullMantissa >> (RealTraits_t<V>::kMantissaWidth + 1U)) != 0ULL)
 		{
-			// store excess digit for rounding decision
-			uCarry /= 10U;
-			break;
+			ullMantissa >>= 1ULL;
+			++iBiasedExponent;
+		}
+
+		if (iBiasedExponent >= static_cast<int>((1U << RealTraits_t<V>::kExponentWidth) - 1U))
+		{
+			*puBits = RealTraits_t<V>::kExponentMask;
+			return ERANGE;
 		}
+
+		*puBits = (static_cast<UIntType_t>(iBiasedExponent) << RealTraits_t<V>::kMantissaWidth) | (static_cast<UIntType_t>(ullMantissa) & RealTraits_t<V>::kMantissaMask);
+		return (*puBits == 0U ? ERANGE : 0);
 	}
 
-	// check if we must round the value (if the number falls midway, it is rounded to the nearest value with an even least significant digit)
-	if (T* tszPropagateDigit = tszDestinationEnd - 1; uCarry > 5U || (uCarry == 5U && ((ullStateHigh | ullStateLow) != 0ULL || (tszPropagateDigit != tszIntegerEnd && (*tszPropagateDigit - '0') & 1))))
+	/// @returns: mask with the high bit set in each byte of the 8 packed characters that is a digit of the given base
+	template <std::uint32_t uBase> requires (uBase == 10U || uBase == 16U)
+	[[nodiscard]] constexpr std::uint64_t GetPackedDigitMask(const std::uint64_t ullChars)
 	{
-		bool bCarryPropagation = true;
-		while (bCarryPropagation && tszPropagateDigit > tszIntegerEnd)
+		constexpr std::uint64_t ullHighBits = 0x8080808080808080ULL;
+
+		// clear high bits to compare bytes by addition without carry between them, characters above 0x7F are excluded by the final mask
+		const std::uint64_t ullLowChars = ullChars & ~ullHighBits;
+		const std::uint64_t ullAsciiMask = ~ullChars & ullHighBits;
+
+		// '0' <= character <= '9'
+		std::uint64_t ullDigitMask = (ullLowChars + 0x5050505050505050ULL) & ~(ullLowChars + 0x4646464646464646ULL);
+
+		if constexpr (uBase == 16U)
 		{
-			if (*tszPropagateDigit == '9')
+			// 'a' <= lowercase character <= 'f'
+			const std::uint64_t ullLowerChars = ullLowChars | 0x2020202020202020ULL;
+			ullDigitMask |= (ullLowerChars + 0x1F1F1F1F1F1F1F1FULL) & ~(ullLowerChars + 0x1919191919191919ULL);
+		}
+
+		return ullDigitMask & ullAsciiMask;
+	}
+
+	/// convert the given count of leading digits of the 8 packed characters to the number
+	/// @param[in] nDigitCount count of the digits, in range [1 .. 8]
+	/// @remarks: digits are aligned to the highest bytes, then adjacent digits, pairs and quads are merged by multiply-add, two lanes at a time
+	template <std::uint32_t uBase> requires (uBase == 10U || uBase == 16U)
+	[[nodiscard]] constexpr std::uint32_t ParsePackedDigits(const std::uint64_t ullChars, const int nDigitCount)
+	{
+		// value of the digit character is in its low nibble, letters additionally have 0x40 bit set
+		std::uint64_t ullDigits = ullChars & 0x0F0F0F0F0F0F0F0FULL;
+		if constexpr (uBase == 16U)
+			ullDigits += ((ullChars >> 6U) & 0x0101010101010101ULL) * 9U;
+
+		// first character is in the lowest byte, so the shift puts the leading zeros before it
+		ullDigits <<= static_cast<std::uint32_t>(8 - nDigitCount) * 8U;
+
+		ullDigits = (ullDigits * uBase + (ullDigits >> 8U)) & 0x00FF00FF00FF00FFULL;
+		ullDigits = (ullDigits * (uBase * uBase) + (ullDigits >> 16U)) & 0x0000FFFF0000FFFFULL;
+		ullDigits = (ullDigits * (uBase * uBase * uBase * uBase) + (ullDigits >> 32U)) & 0xFFFFFFFFULL;
+		return static_cast<std::uint32_t>(ullDigits);
+	}
+
+	/// @param[in] szSourceLast end of the string when @a`bBounded` is true, ignored otherwise
+	/// @returns: true if 8 packed characters can be read from the given position, i.e. they are inside the bounded string, or don't cross the page boundary for the unbounded string
+	template <bool bBounded>
+	[[nodiscard]] Q_INLINE inline bool CanReadPackedChars(const char* szSource, [[maybe_unused]] const char* szSourceLast)
+	{
+		if constexpr (bBounded)
+			return (szSourceLast - szSource >= static_cast<std::ptrdiff_t>(sizeof(std::uint64_t)));
+		else
+		{
+			constexpr std::uintptr_t uPageMask = 0xFFF;
+			return ((reinterpret_cast<std::uintptr_t>(szSource) & uPageMask) <= uPageMask + 1U - sizeof(std::uint64_t));
+		}
+	}
+
+	/// accumulate the leading decimal or hexadecimal digits of the string to the number by 8 characters at a time, while the number doesn't exceed the given maximum
+	/// @param[in] szSourceLast end of the string when @a`bBounded` is true, ignored otherwise
+	/// @remarks: may read past the terminating null character of the unbounded string, but never crosses the page boundaries. the number wider than 64 bits is multiplied by its 64-bit halves
+	/// @returns: pointer past the last accumulated digit
+	template <bool bBounded, typename U>
+	Q_CRT_NO_SANITIZE Q_INLINE inline const char* ParseDigitChunks(const char* szSource, [[maybe_unused]] const char* szSourceLast, const int iBase, const U uMaximum, U& uResult, bool& bIsNumber)
+	{
+		while (CanReadPackedChars<bBounded>(szSource, szSourceLast))
+		{
+			const std::uint64_t ullChars = *reinterpret_cast<const std::uint64_t*>(szSource);
+			const std::uint64_t ullDigitMask = (iBase == 10 ? GetPackedDigitMask<10U>(ullChars) : GetPackedDigitMask<16U>(ullChars));
+
+			// count of the leading digits is the index of the first byte without the high bit of the mask
+			const int nDigitCount = std::countr_zero(~ullDigitMask & 0x8080808080808080ULL) >> 3;
+			if (nDigitCount == 0)
+				break;
+
+			const std::uint32_t uChunk = (iBase == 10 ? ParsePackedDigits<10U>(ullChars, nDigitCount) : ParsePackedDigits<16U>(ullChars, nDigitCount));
+			const std::uint64_t ullMultiplier = (iBase == 10 ? arrPowersOf10[nDigitCount] : 1ULL << (nDigitCount * 4));
+
+			// check for overflow once per chunk
+			U uNext;
+			if constexpr (sizeof(U) > sizeof(std::uint64_t))
 			{
-				*tszPropagateDigit = '0';
-				bCarryPropagation = true;
+				std::uint64_t ullLowProductHigh, ullHighProductHigh;
+				const std::uint64_t ullLowProduct = Multiply64To128(static_cast<std::uint64_t>(uResult), ullMultiplier, &ullLowProductHigh);
+				const std::uint64_t ullHighProduct = Multiply64To128(static_cast<std::uint64_t>(uResult >> 64U), ullMultiplier, &ullHighProductHigh) + ullLowProductHigh;
+				if (ullHighProductHigh != 0ULL || ullHighProduct < ullLowProductHigh)
+					break;
+
+				uNext = ((static_cast<U>(ullHighProduct) << 64U) | ullLowProduct) + uChunk;
 			}
 			else
 			{
-				*tszPropagateDigit += 1;
-				bCarryPropagation = false;
-				break;
+				std::uint64_t ullProductHigh;
+				uNext = Multiply64To128(uResult, ullMultiplier, &ullProductHigh) + uChunk;
+				if (ullProductHigh != 0ULL)
+					break;
 			}
 
-			--tszPropagateDigit;
+			if (uNext < uChunk || uNext > uMaximum)
+				break;
+
+			uResult = uNext;
+			bIsNumber = true;
+			szSource += nDigitCount;
+
+			if (nDigitCount < 8)
+				break;
 		}
 
-		// handle carry propagating to integer part
-		if (bCarryPropagation)
-			++ullIntegerPart;
+		return szSource;
 	}
 
-	// insert integer part
-	if (ullIntegerPart == 0ULL)
-		*--tszIntegerEnd = '0';
-	else
+	/// accumulate the leading decimal digits of the string to the number by 8 characters at a time, while the total count of the accumulated digits doesn't exceed the given maximum
+	/// @param[in] szSourceLast end of the string when @a`bBounded` is true, ignored otherwise
+	/// @remarks: may read past the terminating null character of the unbounded string, but never crosses the page boundaries
+	/// @returns: pointer past the last accumulated digit
+	template <bool bBounded>
+	Q_CRT_NO_SANITIZE Q_INLINE inline const char* ParseDecimalDigitChunks(const char* szSource, [[maybe_unused]] const char* szSourceLast, std::uint64_t& ullResult, int& nTotalDigitCount, const int nMaxDigitCount)
 	{
-		while (ullIntegerPart >= 10ULL)
+		while (CanReadPackedChars<bBounded>(szSource, szSourceLast))
 		{
-			tszIntegerEnd -= 2;
+			const std::uint64_t ullChars = *reinterpret_cast<const std::uint64_t*>(szSource);
+			const int nDigitCount = std::countr_zero(~GetPackedDigitMask<10U>(ullChars) & 0x8080808080808080ULL) >> 3;
+			if (nDigitCount == 0 || nTotalDigitCount + nDigitCount > nMaxDigitCount)
+				break;
 
-			const char* szTwoDigits = &arrDigitPairLUT[(ullIntegerPart % 100U) * 2U];
-			tszIntegerEnd[0] = szTwoDigits[0];
-			tszIntegerEnd[1] = szTwoDigits[1];
+			ullResult = ullResult * arrPowersOf10[nDigitCount] + ParsePackedDigits<10U>(ullChars, nDigitCount);
+			nTotalDigitCount += nDigitCount;
+			szSource += nDigitCount;
 
-			ullIntegerPart /= 100ULL;
+			if (nDigitCount < 8)
+				break;
 		}
 
-		if (ullIntegerPart != 0U)
-			*--tszIntegerEnd = static_cast<char>('0' + ullIntegerPart);
+		return szSource;
 	}
+}
 
-	// insert negative sign
-	if (bIsNegative)
-		*--tszIntegerEnd = '-';
+template <typename T>
+concept HasTmZone_t = requires { T::tm_zone; };
+template <typename T>
+concept HasTmGmtOff_t = requires { T::tm_gmtoff; };
 
-	*tszDestinationEnd = '\0';
-	return tszIntegerEnd;
+/// reverse every character in the string, alternative of '_strrev()', '_wcsrev()'
+/// @returns: pointer to the @a`tszSource`
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+constexpr T* StringReverse(T* tszSource)
+{
+	T* tszSourceCurrent = tszSource, *tszSourceEnd = tszSource + StringLength(tszSource);
+	while (tszSourceCurrent < tszSourceEnd)
+	{
+		// @test: is xor would be really faster than temporary store?
+		T tchCurrent = *tszSourceCurrent++, tchEnd = *--tszSourceEnd;
+		tchCurrent ^= tchEnd;
+		tchEnd ^= tchCurrent;
+		*tszSourceCurrent = tchCurrent ^ tchEnd;
+		*tszSourceEnd = tchEnd;
+	}
+
+	return tszSource;
 }
 
-/**
- * convert the time point to a string, alternative of 'strftime()', 'wcsftime()'
- * @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
- * @param[in] tszFormat string specifying the format of conversion. formatting codes are:
- * - '%a' abbreviated weekday name
- * - '%A' full weekday name
- * - '%b' abbreviated month name
- * - '%B' full month name
- * - '%c' date and time representation appropriate for the locale
- * - '%C' century as a decimal number [0 .. 99]
- * - '%d' day of the month as a decimal number [01 .. 31]
- * - '%D' equivalent to "%m/%d/%y"
- * - '%e' day of the month as a decimal number [1 .. 31], where single digits are preceded by a space
- * - '%F' equivalent to "%Y-%m-%d", the ISO-8601 date format, when the year is between [1000 .. 9999] inclusive
- * - '%g' week-based year without century as a decimal number, the ISO-8601 time format [00 .. 99]
- * - '%G' week-based year as a decimal number, the ISO-8601 time format [0000 .. 9999]
- * - '%h' abbreviated month name (equivalent to "%b")
- * - '%H' hour in 24-hour format as a decimal number [00 .. 23]
- * - '%I' hour in 12-hour format as a decimal number [01 .. 12]
- * - '%j' day of the year as a decimal number [001 .. 366]
- * - '%m' month as a decimal number [01 .. 12]
- * - '%M' minute as a decimal number [00 .. 59]
- * - '%n' new line character escape
- * - '%p' the locale's AM/PM designations associated with a 12-hour clock
- * - '%r' the locale's 12-hour clock time
- * - '%R' equivalent to "%H:%M"
- * - '%S' second as decimal number [00 .. 59]
- * - '%t' tab character escape
- * - '%T' equivalent to "%H:%M:%S", the ISO-8601 time format
- * - '%u' weekday as a decimal number, the ISO-8601 time format [1 .. 7]
- * - '%U' week number of the year as a decimal number, where the first Sunday is the first day of week 1 [00 .. 53]
- * - '%V' week number as a decimal number, the ISO-8601 time format [01 .. 53]
- * - '%w' weekday as a decimal number [0 .. 6]
- * - '%W' week number of the year as a decimal number, where the first Monday is the first day of week 1 [00 .. 53]
- * - '%x' date representation appropriate for the locale
- * - '%X' time representation appropriate for the locale
- * - '%y' year without century, as decimal number [00 .. 99]
- * - '%Y' year with century, as decimal number [1900 .. 9999]
- * - '%z' the offset from UTC, the ISO-8601 format, or no characters if no time zone is determinable
- * - '%Z' time zone name or abbreviation, or no characters if no time zone is determinable
- * - '%%' percent character escape
- * @param[in] pTime pointer to the time data structure
- * @remarks: format the @a`pTime` time point according to the @a`tszFormat` and store the result in the buffer @a`tszDestination`. can write past the end of the buffer that is too small
- * @returns: the number of characters placed in @a`szDestination` not including the terminating null, if the total number of characters, including the terminating null, is more than @a`nDestinationSize`, returns 0 and the contents of @a`szDestination` are indeterminate
- **/
+/// convert every character in the string to uppercase, alternative of '_strupr()', '_wcsupr()'
+/// @remarks: ASCII characters are converted by the blocks
+/// @returns: pointer to the @a`tszDestination`
 template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
-std::size_t TimeToString(T* tszDestination, std::size_t nDestinationSize, const T* tszFormat, const std::tm* pTime)
+constexpr T* StringToUpper(T* tszDestination)
 {
-	// full names of weekdays
-	constexpr const char* arrWeekdayNames[7] = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
-	// full names of months
-	constexpr const char* arrMonthNames[12] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+	const std::size_t nLength = StringLength(tszDestination);
 
-	T* tszDestinationEnd = tszDestination;
-	std::size_t nRemainingSize = nDestinationSize;
+	if (std::is_constant_evaluated())
+		DETAIL::ConvertCaseScalar<true>(tszDestination, tszDestination, nLength);
+	else
+		DETAIL::ConvertCase<true>(tszDestination, tszDestination, nLength);
 
-	while (*tszFormat != '\0' && nRemainingSize != 0U)
+	return tszDestination;
+}
+
+/// convert the given count of characters of one string to uppercase and copy them to another
+/// @remarks: converts exactly @a`nCount` characters, regardless of null characters, the terminating null character isn't appended. the source and destination may be the same buffer, otherwise the behavior is undefined if they overlap
+/// @returns: pointer to the @a`tszDestination` advanced by @a`nCount`
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+constexpr T* StringToUpper(T* tszDestination, const T* tszSource, const std::size_t nCount)
+{
+	if (std::is_constant_evaluated())
+		return DETAIL::ConvertCaseScalar<true>(tszDestination, tszSource, nCount);
+
+	return DETAIL::ConvertCase<true>(tszDestination, tszSource, nCount);
+}
+
+/// convert every character in the string to lowercase, alternative of '_strlwr()', '_wcslwr()'
+/// @remarks: ASCII characters are converted by the blocks
+/// @returns: pointer to the @a`tszDestination`
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+constexpr T* StringToLower(T* tszDestination)
+{
+	const std::size_t nLength = StringLength(tszDestination);
+
+	if (std::is_constant_evaluated())
+		DETAIL::ConvertCaseScalar<false>(tszDestination, tszDestination, nLength);
+	else
+		DETAIL::ConvertCase<false>(tszDestination, tszDestination, nLength);
+
+	return tszDestination;
+}
+
+/// convert the given count of characters of one string to lowercase and copy them to another
+/// @remarks: converts exactly @a`nCount` characters, regardless of null characters, the terminating null character isn't appended. the source and destination may be the same buffer, otherwise the behavior is undefined if they overlap
+/// @returns: pointer to the @a`tszDestination` advanced by @a`nCount`
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+constexpr T* StringToLower(T* tszDestination, const T* tszSource, const std::size_t nCount)
+{
+	if (std::is_constant_evaluated())
+		return DETAIL::ConvertCaseScalar<false>(tszDestination, tszSource, nCount);
+
+	return DETAIL::ConvertCase<false>(tszDestination, tszSource, nCount);
+}
+
+/// convert an integer to a string, alternative of 'to_string()', 'to_chars()', '_itoa()', '_ltoa()', '_ultoa()', '_i64toa()', '_ui64toa()'
+/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+/// @param[in] iBase numeric base in range [2 .. 36] to use to represent the number
+/// @remarks: converts the digits of the given value argument to a null-terminated character string and store the result in @a`tszDestination` buffer. all writes begin from the end of the buffer and may overrun past the bounds of a buffer that is too small, to ensure that buffer is large enough, use @code CRT::IntegerToString_t<T, iBase>::MaxCount() @endcode. when the base is known at compile time, prefer the overload with the base as template argument
+/// @returns: pointer to the beginning of the converted integer in the buffer
+template <typename V, typename T> requires (DETAIL::IsIntegral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+constexpr T* IntegerToString(const V value, T* tszDestination, const std::size_t nDestinationSize, int iBase = 10)
+{
+	if (iBase < 0 || iBase == 1 || iBase > kMaxNumberBase)
 	{
-		// check for the format token
-		if (*tszFormat == '%')
+		Q_ASSERT(false); // given number base is out of range
+		return tszDestination;
+	}
+
+	const bool bIsPositive = (value >= 0);
+	DETAIL::MakeUnsigned_t<V> uValue = (bIsPositive ? static_cast<DETAIL::MakeUnsigned_t<V>>(value) : static_cast<DETAIL::MakeUnsigned_t<V>>(0U - static_cast<DETAIL::MakeUnsigned_t<V>>(value))); // @test: how it actually compiles, can avoid branch at compile time
+
+	T* tszDestinationEnd = tszDestination + nDestinationSize;
+	*--tszDestinationEnd = '\0';
+
+	switch (iBase)
+	{
+	case 10:
+		tszDestinationEnd = DETAIL::WriteDigitsBackward<10U>(uValue, tszDestinationEnd);
+
+		// insert negative sign, only decimal base can have it
+		if (!bIsPositive)
+			*--tszDestinationEnd = '-';
+		break;
+	case 16:
+		tszDestinationEnd = DETAIL::WriteDigitsBackward<16U>(uValue, tszDestinationEnd);
+		break;
+	case 2:
+		tszDestinationEnd = DETAIL::WriteDigitsBackward<2U>(uValue, tszDestinationEnd);
+		break;
+	case 8:
+		tszDestinationEnd = DETAIL::WriteDigitsBackward<8U>(uValue, tszDestinationEnd);
+		break;
+	default:
+		// for other bases perform write by single digit
+		do
 		{
-			++tszFormat;
+			*--tszDestinationEnd = arrAlphanumericLUT[uValue % iBase];
+			uValue /= iBase;
+		} while (uValue != 0U);
+		break;
+	}
 
-			// @note: we don't support any locale (as of default C locale) and non-standard modifiers
-			if (*tszFormat == '#' || *tszFormat == 'E' || *tszFormat == 'O')
-				++tszFormat;
+	return tszDestinationEnd;
+}
+
+/// convert an integer to a string in the numeric base that is known at compile time, alternative of 'to_string()', 'to_chars()', '_itoa()', '_ltoa()', '_ultoa()', '_i64toa()', '_ui64toa()'
+/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+/// @remarks: same as the runtime base overload, but the digit extraction loop is specialized for the @a`uBase` at compile time
+/// @returns: pointer to the beginning of the converted integer in the buffer
+template <std::size_t uBase, typename V, typename T> requires (DETAIL::IsIntegral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>) && uBase >= 2U && uBase <= kMaxNumberBase)
+constexpr T* IntegerToString(const V value, T* tszDestination, const std::size_t nDestinationSize)
+{
+	const bool bIsPositive = (value >= 0);
+	const auto uValue = (bIsPositive ? static_cast<DETAIL::MakeUnsigned_t<V>>(value) : static_cast<DETAIL::MakeUnsigned_t<V>>(0U - static_cast<DETAIL::MakeUnsigned_t<V>>(value)));
+
+	T* tszDestinationEnd = tszDestination + nDestinationSize;
+	*--tszDestinationEnd = '\0';
+	tszDestinationEnd = DETAIL::WriteDigitsBackward<uBase>(uValue, tszDestinationEnd);
+
+	// insert negative sign, only decimal base can have it
+	if constexpr (uBase == 10U)
+	{
+		if (!bIsPositive)
+			*--tszDestinationEnd = '-';
+	}
+
+	return tszDestinationEnd;
+}
+
+/// convert an integer to a string in the numeric base that is known at compile time, alternative of 'to_string()', 'to_chars()', '_itoa()', '_ltoa()', '_ultoa()', '_i64toa()', '_ui64toa()'
+/// @remarks: same as the overload with explicit destination size, but the size of the destination array is checked at compile time to be large enough for any value of the given type
+/// @returns: pointer to the beginning of the converted integer in the array
+template <std::size_t uBase = 10U, typename V, typename T, std::size_t nDestinationSize> requires (DETAIL::IsIntegral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>) && uBase >= 2U && uBase <= kMaxNumberBase)
+constexpr T* IntegerToString(const V value, T(&tszDestination)[nDestinationSize])
+{
+	static_assert(nDestinationSize >= IntegerToString_t<V, uBase>::MaxCount(), "destination array is too small to hold any value of the given type");
+	return IntegerToString<uBase>(value, tszDestination, nDestinationSize);
+}
+
+/// convert an integer to a decimal string written forward from the beginning of the buffer, alternative of 'to_chars()'
+/// @remarks: computes the count of digits first and writes them in place with multiplication-based digit extraction, the terminating null character isn't appended. the destination buffer must have space for at least @code CRT::IntegerToString_t<V, 10U>::MaxCount() - 1U @endcode characters
+/// @returns: pointer past the last written character, to chain the next writes
+template <typename V, typename T> requires (DETAIL::IsIntegral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+constexpr T* IntegerToChars(const V value, T* tszDestination)
+{
+	using UnsignedType_t = DETAIL::MakeUnsigned_t<V>;
+	auto uValue = static_cast<UnsignedType_t>(value);
+
+	if constexpr (DETAIL::IsSigned_v<V>)
+	{
+		if (value < 0)
+		{
+			*tszDestination++ = '-';
+			uValue = static_cast<UnsignedType_t>(0U - uValue);
+		}
+	}
+
+	// split the value wider than 64 bits into the limbs of 19 digits, so only the limb division is done with the wide arithmetic
+	if constexpr (sizeof(V) > sizeof(std::uint64_t))
+	{
+		if (uValue > (std::numeric_limits<std::uint64_t>::max)())
+		{
+			// leading digits may still not fit into 64 bits, but at most one more limb
+			const UnsignedType_t uHigh = uValue / arrPowersOf10[19];
+			if (uHigh > (std::numeric_limits<std::uint64_t>::max)())
+			{
+				tszDestination = IntegerToChars(static_cast<std::uint64_t>(uHigh / arrPowersOf10[19]), tszDestination);
+				tszDestination = DETAIL::WriteDecimalLimb(tszDestination, static_cast<std::uint64_t>(uHigh % arrPowersOf10[19]));
+			}
+			else
+				tszDestination = IntegerToChars(static_cast<std::uint64_t>(uHigh), tszDestination);
+
+			return DETAIL::WriteDecimalLimb(tszDestination, static_cast<std::uint64_t>(uValue % arrPowersOf10[19]));
+		}
+
+		return IntegerToChars(static_cast<std::uint64_t>(uValue), tszDestination);
+	}
+
+	const int nDigitCount = DETAIL::CountDecimalDigits(uValue);
+	if (nDigitCount <= 8)
+		return DETAIL::WriteDecimalDigits(tszDestination, static_cast<std::uint32_t>(uValue), nDigitCount);
+
+	// split the value into the groups of 8 digits, division by the constant is compiled into multiplication
+	const auto uLowGroup = static_cast<std::uint32_t>(uValue % 100000000U);
+	uValue /= 100000000U;
+
+	if (nDigitCount <= 16)
+		tszDestination = DETAIL::WriteDecimalDigits(tszDestination, static_cast<std::uint32_t>(uValue), nDigitCount - 8);
+	else
+	{
+		tszDestination = DETAIL::WriteDecimalDigits(tszDestination, static_cast<std::uint32_t>(uValue / 100000000U), nDigitCount - 16);
+		tszDestination = DETAIL::WriteDecimalDigits(tszDestination, static_cast<std::uint32_t>(uValue % 100000000U), 8);
+	}
+
+	return DETAIL::WriteDecimalDigits(tszDestination, uLowGroup, 8);
+}
+
+/// get the length of the string of integers separated by the delimiter, as written by 'IntegerArrayToString()'
+/// @returns: count of characters needed for the conversion, not including the terminating null
+template <typename V> requires (DETAIL::IsIntegral_v<V>)
+constexpr std::size_t IntegerArrayToStringLength(const V* pBegin, const V* pEnd)
+{
+	if (pBegin == pEnd)
+		return 0U;
+
+	// delimiters between the values
+	std::size_t nLength = static_cast<std::size_t>(pEnd - pBegin) - 1U;
+	for (; pBegin < pEnd; ++pBegin)
+	{
+		const V value = *pBegin;
+		auto uValue = static_cast<DETAIL::MakeUnsigned_t<V>>(value);
+
+		if constexpr (DETAIL::IsSigned_v<V>)
+		{
+			if (value < 0)
+			{
+				uValue = static_cast<DETAIL::MakeUnsigned_t<V>>(0U - uValue);
+				++nLength;
+			}
+		}
+
+		nLength += static_cast<std::size_t>(DETAIL::CountDecimalDigits(uValue));
+	}
+
+	return nLength;
+}
+
+/// convert an array of integers to a string of decimal values separated by the delimiter, e.g. to export a column to CSV or JSON
+/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+/// @remarks: when the buffer can't fit the longest possible values, the required length is computed first with 'IntegerArrayToStringLength()' and nothing is written if the buffer is too small. digits are written forward from the beginning of the buffer, for the multibyte strings the last 8 digits of two successive values are converted at once with SIMD, without divisions and lookups per digit pair. wider batches of 8 values aren't used, because the variable-length write of each value outweighs the shared digit extraction, so they were faster only for the short 32-bit values and slower for the others
+/// @returns: pointer to the terminating null character in @a`tszDestination`, or null if the buffer is too small
+template <typename V, typename T> requires (DETAIL::IsIntegral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+T* IntegerArrayToString(const V* pBegin, const V* pEnd, T* tszDestination, const std::size_t nDestinationSize, const T tchDelimiter = ',')
+{
+	if (pBegin == pEnd)
+	{
+		if (nDestinationSize == 0U)
+			return nullptr;
+
+		*tszDestination = '\0';
+		return tszDestination;
+	}
+
+	// maximal length of the value with the delimiter
+	constexpr std::size_t nMaxValueLength = IntegerToString_t<V, 10U>::MaxCount();
+	const std::size_t nCount = static_cast<std::size_t>(pEnd - pBegin);
+
+	// size the output exactly only when the buffer can't fit the worst case
+	T* tszDestinationEnd;
+	if (nCount <= nDestinationSize / nMaxValueLength)
+		tszDestinationEnd = tszDestination + nDestinationSize;
+	else if (const std::size_t nLength = IntegerArrayToStringLength(pBegin, pEnd); nLength < nDestinationSize)
+		tszDestinationEnd = tszDestination + nLength + 1U;
+	else
+		return nullptr;
+
+#ifdef Q_ISA_SSE2
+	if constexpr (std::is_same_v<T, char> && sizeof(V) <= sizeof(std::uint64_t))
+	{
+		const auto GetAbsolute = [](const V value)
+		{
+			auto uValue = static_cast<DETAIL::MakeUnsigned_t<V>>(value);
+
+			if constexpr (DETAIL::IsSigned_v<V>)
+			{
+				if (value < 0)
+					uValue = static_cast<DETAIL::MakeUnsigned_t<V>>(0U - uValue);
+			}
+
+			return static_cast<std::uint64_t>(uValue);
+		};
+
+		// @returns: absolute value, the sign is written to the destination
+		const auto WriteSign = [&tszDestination, &GetAbsolute](const V value)
+		{
+			if constexpr (DETAIL::IsSigned_v<V>)
+			{
+				if (value < 0)
+					*tszDestination++ = '-';
+			}
+
+			return GetAbsolute(value);
+		};
+
+		// vector writes may overrun the digits by up to 8 characters, that are overwritten by the next values, so reserve the space for them at the end
+		for (; pBegin < pEnd && tszDestinationEnd - tszDestination >= static_cast<std::ptrdiff_t>(nMaxValueLength * 2U + 8U); ++pBegin)
+		{
+			const std::uint64_t ullFirst = WriteSign(*pBegin);
+			const int nFirstDigitCount = DETAIL::CountDecimalDigits(ullFirst);
+
+			// convert the last 8 digits of two successive values at once, when both of them have at most 10 digits
+			if (nFirstDigitCount <= 10 && pBegin + 1 < pEnd)
+			{
+				if (const std::uint64_t ullSecondAbsolute = GetAbsolute(pBegin[1]); ullSecondAbsolute < 10000000000ULL)
+				{
+					const __m128i vecDigits = DETAIL::ConvertDecimalDigitGroups(static_cast<std::uint32_t>(ullFirst % 100000000U), static_cast<std::uint32_t>(ullSecondAbsolute % 100000000U));
+					tszDestination = DETAIL::WriteDecimalDigitGroup(tszDestination, ullFirst, nFirstDigitCount, vecDigits);
+					*tszDestination++ = tchDelimiter;
+
+					const std::uint64_t ullSecond = WriteSign(pBegin[1]);
+					tszDestination = DETAIL::WriteDecimalDigitGroup(tszDestination, ullSecond, DETAIL::CountDecimalDigits(ullSecond), ::_mm_unpackhi_epi64(vecDigits, vecDigits));
+					*tszDestination++ = tchDelimiter;
+
+					++pBegin;
+					continue;
+				}
+			}
+
+			tszDestination = DETAIL::WriteDecimalDigitsVector(tszDestination, ullFirst, nFirstDigitCount);
+			*tszDestination++ = tchDelimiter;
+		}
+	}
+#endif
+
+	for (; pBegin < pEnd; ++pBegin)
+	{
+		tszDestination = IntegerToChars(*pBegin, tszDestination);
+		*tszDestination++ = tchDelimiter;
+	}
+
+	// replace the trailing delimiter
+	*--tszDestination = '\0';
+	return tszDestination;
+}
+
+// notation of the floating-point number to string conversion
+enum ERealFormat : std::uint8_t
+{
+	REAL_FORMAT_FIXED = 0U, // positional notation with the given count of fractional digits, alternative of '%f'
+	REAL_FORMAT_SCIENTIFIC, // scientific notation with the given count of fractional digits, alternative of '%e'
+	REAL_FORMAT_GENERAL, // either positional or scientific notation depending on the exponent, with the given count of significant digits and without trailing zeros, alternative of '%g'
+	REAL_FORMAT_SHORTEST // the shortest representation that converts back to the same value, in either positional or scientific notation, whichever is shorter
+};
+
+/// convert a floating-point number to a string, alternative of 'to_string()', 'to_chars()'
+/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+/// @param[in] iPrecision number of fractional digits to print
+/// @remarks: converts the digits of the given floating-point @a`value` to a null-terminated string and store the result in @a`tszDestination` buffer. can write either from begin of the buffer or from the end, or past the bounds of a buffer that is too small, to ensure that buffer is large enough, use 310 + @a`iPrecision`
+/// @returns: pointer to the beginning of the converted floating-point number in the buffer
+template <typename V, typename T> requires (std::is_floating_point_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+T* RealToString(const V value, T* tszDestination, const std::size_t nDestinationSize, int iPrecision = 6)
+{
+	using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
+	auto uBits = std::bit_cast<UIntType_t>(value);
+	auto uExponent = static_cast<std::uint16_t>((uBits & RealTraits_t<V>::kExponentMask) >> RealTraits_t<V>::kMantissaWidth);
+	auto uMantissa = uBits & RealTraits_t<V>::kMantissaMask;
+	const bool bIsNegative = (uBits & RealTraits_t<V>::kSignMask) != 0U;
+
+	T* tszDestinationEnd = tszDestination;
+
+	// check if the all bits of the exponent is set
+	if (uExponent == (1U << RealTraits_t<V>::kExponentWidth) - 1U)
+	{
+		if (bIsNegative)
+			*tszDestinationEnd++ = '-';
+
+		// check if any of the mantissa bits is set, indicating that value is NaN
+		if (uMantissa != 0U)
+		{
+			// a double argument representing a NaN is converted in one of the styles [-]nan or [-]nan(n-wchar-sequence) - which style, and the meaning of any n-wchar-sequence, is implementation-defined (C standard 7.21.6.1)
+			*tszDestinationEnd++ = 'n';
+			*tszDestinationEnd++ = 'a';
+			*tszDestinationEnd++ = 'n';
+			*tszDestinationEnd = '\0';
+		}
+		else
+		{
+			// a double argument representing an infinity is converted in one of the styles [-]inf or [-]infinity - which style is implementation-defined (C standard 7.21.6.1)
+			*tszDestinationEnd++ = 'i';
+			*tszDestinationEnd++ = 'n';
+			*tszDestinationEnd++ = 'f';
+			*tszDestinationEnd = '\0';
+		}
+
+		return tszDestination;
+	}
+
+	std::int16_t iExponentUnbiased;
+	if (uExponent == 0U)
+	{
+		// check if the value is zero
+		if (uMantissa == 0U)
+		{
+			if (bIsNegative)
+				*tszDestinationEnd++ = '-';
+
+			*tszDestinationEnd++ = '0';
+
+			if (iPrecision > 0)
+			{
+				*tszDestinationEnd++ = '.';
+				do
+				{
+					*tszDestinationEnd++ = '0';
+				} while (--iPrecision > 0);
+			}
+
+			*tszDestinationEnd = '\0';
+			return tszDestination;
+		}
+
+		// set minimum exponent for denormalized numbers
+		iExponentUnbiased = RealTraits_t<V>::kExponentDenormalMin;
+	}
+	else
+	{
+		// calculate unbiased exponent
+		iExponentUnbiased = uExponent - RealTraits_t<V>::kExponentBias;
+		// add implicit bit for normalized numbers
+		uMantissa |= static_cast<UIntType_t>(1U) << RealTraits_t<V>::kMantissaWidth;
+	}
+
+	const int iExponentShift = iExponentUnbiased - RealTraits_t<V>::kMantissaWidth;
+
+	// fast path for the small precision and the integer part that fits into 64 bits, scale the fractional part by the power of 10 and round it half to even in the 128-bit integer arithmetic
+	if (iPrecision <= 9 && iExponentShift <= 63 - static_cast<int>(RealTraits_t<V>::kMantissaWidth))
+	{
+		const int nFractionalDigitCount = Max(iPrecision, 0);
+		std::uint64_t ullIntegerPart = 0ULL;
+		std::uint64_t ullFractionalDigits = 0ULL;
+
+		if (iExponentShift >= 0)
+			ullIntegerPart = static_cast<std::uint64_t>(uMantissa) << iExponentShift;
+		// fractional part scaled by 10^9 is less than 2^83, so with larger shift it's always rounded to zero
+		else if (const std::uint32_t uShift = -iExponentShift; uShift <= 84U)
+		{
+			std::uint64_t ullFractionalPart = uMantissa;
+			if (uShift < 64U)
+			{
+				ullIntegerPart = ullFractionalPart >> uShift;
+				ullFractionalPart &= (1ULL << uShift) - 1ULL;
+			}
+
+			// split the scaled fractional part by the binary point into the digits and the remainder, compared with the half of the divisor for rounding
+			std::uint64_t ullScaledHigh;
+			const std::uint64_t ullScaledLow = DETAIL::Multiply64To128(ullFractionalPart, arrPowersOf10[nFractionalDigitCount], &ullScaledHigh);
+			int iRemainderComparison;
+			if (uShift < 64U)
+			{
+				ullFractionalDigits = (ullScaledHigh << (63U - uShift) << 1U) | (ullScaledLow >> uShift);
+				const std::uint64_t ullRemainder = ullScaledLow & ((1ULL << uShift) - 1ULL);
+				const std::uint64_t ullHalf = 1ULL << (uShift - 1U);
+				iRemainderComparison = (ullRemainder > ullHalf) - (ullRemainder < ullHalf);
+			}
+			else
+			{
+				ullFractionalDigits = ullScaledHigh >> (uShift - 64U);
+				const std::uint64_t ullRemainderHigh = ullScaledHigh & ((1ULL << (uShift - 64U)) - 1ULL);
+				const std::uint64_t ullHalfHigh = (uShift > 64U ? 1ULL << (uShift - 65U) : 0ULL);
+				const std::uint64_t ullHalfLow = (uShift > 64U ? 0ULL : 1ULL << 63U);
+				iRemainderComparison = (ullRemainderHigh != ullHalfHigh ? (ullRemainderHigh > ullHalfHigh ? 1 : -1) : (ullScaledLow > ullHalfLow) - (ullScaledLow < ullHalfLow));
+			}
+
+			// round half to even, by the parity of the last printed digit
+			if (iRemainderComparison > 0 || (iRemainderComparison == 0 && ((nFractionalDigitCount > 0 ? ullFractionalDigits : ullIntegerPart) & 1ULL) != 0ULL))
+			{
+				// handle carry propagating to integer part
+				if (++ullFractionalDigits == arrPowersOf10[nFractionalDigitCount])
+				{
+					ullFractionalDigits = 0ULL;
+					++ullIntegerPart;
+				}
+			}
+		}
+
+		if (bIsNegative)
+			*tszDestinationEnd++ = '-';
+
+	#ifdef Q_ISA_SSE2
+		// convert both parts at once when they fit into 8 digits each, and the buffer has space for the 8-byte stores of them
+		if constexpr (std::is_same_v<T, char>)
+		{
+			if (const int nIntegerDigitCount = DETAIL::CountDecimalDigits(ullIntegerPart); nIntegerDigitCount <= 8 && nFractionalDigitCount <= 8 && static_cast<std::size_t>(tszDestinationEnd - tszDestination + nIntegerDigitCount + 9) <= nDestinationSize)
+			{
+				// fractional digits are aligned to the left of their group, so the digits following them are overwritten by the terminating null
+				const __m128i vecDigits = DETAIL::ConvertDecimalDigitGroups(static_cast<std::uint32_t>(ullIntegerPart), static_cast<std::uint32_t>(ullFractionalDigits * arrPowersOf10[8 - nFractionalDigitCount]));
+				::_mm_storel_epi64(reinterpret_cast<__m128i*>(tszDestinationEnd), ::_mm_srl_epi64(vecDigits, ::_mm_cvtsi32_si128((8 - nIntegerDigitCount) * 8)));
+				tszDestinationEnd += nIntegerDigitCount;
+
+				if (nFractionalDigitCount > 0)
+				{
+					*tszDestinationEnd++ = '.';
+					::_mm_storel_epi64(reinterpret_cast<__m128i*>(tszDestinationEnd), ::_mm_unpackhi_epi64(vecDigits, vecDigits));
+					tszDestinationEnd += nFractionalDigitCount;
+				}
+
+				*tszDestinationEnd = '\0';
+				return tszDestination;
+			}
+		}
+	#endif
+
+		tszDestinationEnd = IntegerToChars(ullIntegerPart, tszDestinationEnd);
+
+		if (nFractionalDigitCount > 0)
+		{
+			*tszDestinationEnd++ = '.';
+
+			if (nFractionalDigitCount > 8)
+			{
+				*tszDestinationEnd++ = static_cast<T>('0' + ullFractionalDigits / 100000000ULL);
+				ullFractionalDigits %= 100000000ULL;
+			}
+
+			tszDestinationEnd = DETAIL::WriteDecimalDigits(tszDestinationEnd, static_cast<std::uint32_t>(ullFractionalDigits), Min(nFractionalDigitCount, 8));
+		}
+
+		*tszDestinationEnd = '\0';
+		return tszDestination;
+	}
+
+	// check if the number has large value
+	if (iExponentShift >= 0)
+	{
+		tszDestinationEnd += nDestinationSize;
+		*--tszDestinationEnd = '\0';
+
+		if (iPrecision > 0)
+		{
+			do
+			{
+				*--tszDestinationEnd = '0';
+			} while (--iPrecision > 0);
+
+			*--tszDestinationEnd = '.';
+		}
+
+		// @todo: fast path for 64/128 bits? should also fully cover float range (39 digits)
+		const int nTotalBits = iExponentUnbiased + 1;
+		const int nTotalChunks = (nTotalBits + 31) / 32;
+
+		const std::uint32_t nChunkIndex = iExponentShift / 32U;
+		const std::uint32_t uBitShift = iExponentShift % 32U;
+		std::uint64_t ullIntegerPart = static_cast<std::uint64_t>(uMantissa) << uBitShift;
+
+		std::uint32_t arrChunks[32] = { };
+		arrChunks[nChunkIndex] = static_cast<std::uint32_t>(ullIntegerPart); // low chunk
+		ullIntegerPart >>= 32ULL;
+		arrChunks[nChunkIndex + 1U] = static_cast<std::uint32_t>(ullIntegerPart); // middle chunk
+		// keep it conditional to not write past the end of chunks buffer
+		if (const std::uint32_t uHighChunk = static_cast<std::uint32_t>(uMantissa >> (64U - uBitShift)); uHighChunk != 0U)
+			arrChunks[nChunkIndex + 2U] = uHighChunk; // high chunk
+
+		std::uint32_t uQuotient = 0U;
+		do
+		{
+			std::uint32_t uRemainder = 0U;
+			for (int i = nTotalChunks - 1; i >= 0; --i)
+			{
+				const std::uint64_t ullChunkValue = (static_cast<std::uint64_t>(uRemainder) << 32ULL | arrChunks[i]);
+				uQuotient = static_cast<std::uint32_t>(ullChunkValue / 1000000000U);
+				uRemainder = static_cast<std::uint32_t>(ullChunkValue % 1000000000U);
+				arrChunks[i] = uQuotient;
+			}
+
+			// faster than unrolling and printing the whole chunk at time
+			T* szDestinationChunkEnd = tszDestinationEnd - 8;
+			while (tszDestinationEnd != szDestinationChunkEnd)
+			{
+				tszDestinationEnd -= 2;
+
+				const char* szTwoDigits = &arrDigitPairLUT[(uRemainder % 100U) * 2U];
+				tszDestinationEnd[0] = szTwoDigits[0];
+				tszDestinationEnd[1] = szTwoDigits[1];
+
+				uRemainder /= 100U;
+			}
+			*--tszDestinationEnd = static_cast<T>('0' + uRemainder);
+		} while (uQuotient != 0U);
+
+		// skip leading zeros
+		while (*tszDestinationEnd == '0')
+			++tszDestinationEnd;
+
+		// insert negative sign
+		if (bIsNegative)
+			*--tszDestinationEnd = '-';
+
+		return tszDestinationEnd;
+	}
+
+	// extract integer and fractional parts
+	std::uint64_t ullIntegerPart = 0U;
+	std::uint64_t ullFractionalPart = uMantissa;
+	if (const std::uint32_t uShift = -iExponentShift; uShift <= RealTraits_t<V>::kMantissaWidth + 1U)
+	{
+		ullIntegerPart = (uMantissa >> uShift);
+		ullFractionalPart &= ((1ULL << uShift) - 1ULL);
+	}
+
+	// reserve space for the integer part
+	tszDestinationEnd += IntegerToString_t<UIntType_t, 10U>::MaxCount(); // 64-bit maximum is 20 digits and 1 for rounding carry
+	T* tszIntegerEnd = tszDestinationEnd;
+
+	// insert decimal point
+	if (iPrecision > 0)
+		*tszDestinationEnd++ = '.';
+
+	// adjust fixed-point representation of fractional part based on exponent
+	std::uint64_t ullStateLow = ullFractionalPart;
+	std::uint64_t ullStateHigh = 0ULL;
+	if (const int iStateShift = 128 + iExponentShift; iStateShift >= 128)
+	{
+		ullStateHigh = ullStateLow << (iStateShift - 128);
+		ullStateLow = 0ULL;
+	}
+	else if (iStateShift >= 64)
+	{
+		ullStateHigh = ullStateLow << (iStateShift - 64);
+		ullStateLow = 0ULL;
+	}
+	else if (iStateShift > 0)
+	{
+		ullStateHigh = ullStateLow >> (64 - iStateShift);
+		ullStateLow = ullStateLow << iStateShift;
+	}
+	// zero shift leaves the state as is, and would otherwise shift by the full width
+	else if (iStateShift < 0)
+	{
+		if (const int iRightShift = -iStateShift; iRightShift >= 128)
+		{
+			ullStateLow = 0ULL;
+			ullStateHigh = 0ULL;
+		}
+		else if (iRightShift >= 64)
+		{
+			ullStateLow = ullStateHigh >> (iRightShift - 64);
+			ullStateHigh = 0ULL;
+		}
+		else
+		{
+			ullStateLow = (ullStateHigh << (64 - iRightShift)) | (ullStateLow >> iRightShift);
+			ullStateHigh = ullStateHigh >> iRightShift;
+		}
+	}
+
+	// calculate fractional part
+	// @note: we need to do this even if the specified precision is zero, to round the integer part correctly
+	std::uint32_t uCarry = 0U;
+	while (true)
+	{
+		// early exit if fractional part exhausted
+		if ((ullStateHigh | ullStateLow) == 0ULL)
+		{
+			while (iPrecision-- > 0)
+				*tszDestinationEnd++ = '0';
+
+			uCarry = 0U;
+			break;
+		}
+
+		// 128-bit multiply of the state by 100
+		std::uint64_t ullLowProduct;
+		std::uint64_t ullHighProduct;
+		ullStateLow = DETAIL::Multiply64To128(ullStateLow, 100ULL, &ullLowProduct);
+		ullStateHigh = DETAIL::Multiply64To128(ullStateHigh, 100ULL, &ullHighProduct) + ullLowProduct;
+		uCarry = static_cast<std::uint32_t>(ullHighProduct);
+
+		if (iPrecision >= 2)
+		{
+			const char* szTwoDigits = &arrDigitPairLUT[uCarry * 2U];
+			*tszDestinationEnd++ = szTwoDigits[0];
+			*tszDestinationEnd++ = szTwoDigits[1];
+			iPrecision -= 2;
+
+			// store excess digit for rounding decision
+			uCarry %= 10U;
+		}
+		else if (iPrecision > 0)
+		{
+			*tszDestinationEnd++ = static_cast<char>('0' + uCarry / 10U);
+
+			// store excess digit for rounding decision
+			uCarry %= 10U;
+			break;
+		}
+		else
+		{
+			// store excess digit for rounding decision
+			uCarry /= 10U;
+			break;
+		}
+	}
+
+	// check if we must round the value (if the number falls midway, it is rounded to the nearest value with an even least significant digit)
+	if (T* tszPropagateDigit = tszDestinationEnd - 1; uCarry > 5U || (uCarry == 5U && ((ullStateHigh | ullStateLow) != 0ULL || (tszPropagateDigit != tszIntegerEnd && (*tszPropagateDigit - '0') & 1))))
+	{
+		bool bCarryPropagation = true;
+		while (bCarryPropagation && tszPropagateDigit > tszIntegerEnd)
+		{
+			if (*tszPropagateDigit == '9')
+			{
+				*tszPropagateDigit = '0';
+				bCarryPropagation = true;
+			}
+			else
+			{
+				*tszPropagateDigit += 1;
+				bCarryPropagation = false;
+				break;
+			}
+
+			--tszPropagateDigit;
+		}
+
+		// handle carry propagating to integer part
+		if (bCarryPropagation)
+			++ullIntegerPart;
+	}
+
+	// insert integer part
+	if (ullIntegerPart == 0ULL)
+		*--tszIntegerEnd = '0';
+	else
+	{
+		while (ullIntegerPart >= 10ULL)
+		{
+			tszIntegerEnd -= 2;
+
+			const char* szTwoDigits = &arrDigitPairLUT[(ullIntegerPart % 100U) * 2U];
+			tszIntegerEnd[0] = szTwoDigits[0];
+			tszIntegerEnd[1] = szTwoDigits[1];
+
+			ullIntegerPart /= 100ULL;
+		}
+
+		if (ullIntegerPart != 0U)
+			*--tszIntegerEnd = static_cast<char>('0' + ullIntegerPart);
+	}
+
+	// insert negative sign
+	if (bIsNegative)
+		*--tszIntegerEnd = '-';
+
+	*tszDestinationEnd = '\0';
+	return tszIntegerEnd;
+}
+
+/// convert a floating-point number to a string with the given notation, alternative of 'to_chars()'
+/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+/// @param[in] nFormat notation of the conversion
+/// @param[in] iPrecision number of fractional digits to print for the fixed and scientific notations, number of significant digits to print for the general notation, ignored for the shortest notation. negative precision is treated as 6
+/// @remarks: converts the digits of the given floating-point @a`value` to a null-terminated string and store the result in @a`tszDestination` buffer. with other than fixed notation, buffer is always written from the beginning and is never overrun, to ensure that buffer is large enough, use 25 for the shortest notation and 9 + @a`iPrecision` for the scientific and general notations. output of the scientific and general notations is the same as of '%.*e' and '%.*g' of 'printf()', and output of the shortest notation is the same as of 'to_chars()' without format, except that integers larger than mantissa precision are padded with zeros after their shortest digits
+/// @returns: pointer to the beginning of the converted floating-point number in the buffer, or null if the buffer is too small for other than fixed notation
+template <typename V, typename T> requires ((std::is_same_v<V, float> || std::is_same_v<V, double>) && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+T* RealToString(const V value, T* tszDestination, const std::size_t nDestinationSize, const ERealFormat nFormat, const int iPrecision = 6)
+{
+	if (nFormat == REAL_FORMAT_FIXED)
+		return RealToString(value, tszDestination, nDestinationSize, iPrecision);
+
+	using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
+	const auto uBits = std::bit_cast<UIntType_t>(value);
+	const auto uExponent = static_cast<std::uint32_t>((uBits & RealTraits_t<V>::kExponentMask) >> RealTraits_t<V>::kMantissaWidth);
+	const auto uMantissa = uBits & RealTraits_t<V>::kMantissaMask;
+	const bool bIsNegative = (uBits & RealTraits_t<V>::kSignMask) != 0U;
+
+	T* tszDestinationEnd = tszDestination;
+
+	// check if the all bits of the exponent is set, indicating that value is infinity or NaN
+	if (uExponent == (1U << RealTraits_t<V>::kExponentWidth) - 1U)
+	{
+		if (nDestinationSize < (bIsNegative ? 5U : 4U))
+			return nullptr;
+
+		if (bIsNegative)
+			*tszDestinationEnd++ = '-';
+
+		const char* szSpecial = (uMantissa != 0U ? "nan" : "inf");
+		*tszDestinationEnd++ = szSpecial[0];
+		*tszDestinationEnd++ = szSpecial[1];
+		*tszDestinationEnd++ = szSpecial[2];
+		*tszDestinationEnd = '\0';
+		return tszDestination;
+	}
+
+	// count of the significant digits to print, including trailing zeros, the shortest notation prints only the digits it needs
+	const std::size_t nPrecision = static_cast<std::size_t>(iPrecision < 0 ? 6 : iPrecision);
+	const std::size_t nRequiredCount = (nFormat == REAL_FORMAT_SCIENTIFIC ? nPrecision + 1U : (nFormat == REAL_FORMAT_GENERAL ? (nPrecision == 0U ? 1U : nPrecision) : 0U));
+
+	// significant digits of the value without trailing zeros, zero value has no digits
+	char szDigits[RealTraits_t<V>::kMaxSignificantDigits + 1U];
+	std::size_t nDigitCount = 0U;
+	// decimal exponent of the first significant digit
+	int iDecimalExponent = 0;
+
+	if ((uExponent | uMantissa) != 0U)
+	{
+		auto [ullSignificand, iExponent] = DETAIL::ConvertRealToShortestDecimal<V>(uMantissa, uExponent);
+		bool bIsShortestUsable = true;
+
+		if (nFormat != REAL_FORMAT_SHORTEST)
+		{
+			const auto nShortestCount = static_cast<std::size_t>(DETAIL::CountDecimalDigits(ullSignificand));
+
+			if (nShortestCount <= nRequiredCount)
+				// shortest digits padded with zeros are correctly rounded only when the rounding interval of the value is narrower than the half unit of the last requested digit, that's never the case for denormalized values
+				bIsShortestUsable = (uExponent != 0U && nRequiredCount <= static_cast<std::size_t>(std::numeric_limits<V>::digits10));
+			else
+			{
+				// shortest digits rounded to the requested count are correctly rounded, unless they fall exactly midway, since otherwise the rounding boundary between them and the value would be the shorter or closer representation
+				const std::uint64_t ullDivisor = arrPowersOf10[nShortestCount - nRequiredCount];
+				const std::uint64_t ullRemainder = ullSignificand % ullDivisor;
+
+				bIsShortestUsable = (ullRemainder != ullDivisor / 2U);
+				if (bIsShortestUsable)
+				{
+					ullSignificand = ullSignificand / ullDivisor + (ullRemainder > ullDivisor / 2U ? 1U : 0U);
+					iExponent += static_cast<int>(nShortestCount - nRequiredCount);
+				}
+			}
+		}
+
+		if (bIsShortestUsable)
+		{
+			// remove trailing zeros of the significand
+			while (ullSignificand % 10ULL == 0ULL)
+			{
+				ullSignificand /= 10ULL;
+				++iExponent;
+			}
+
+			nDigitCount = static_cast<std::size_t>(DETAIL::CountDecimalDigits(ullSignificand));
+			iDecimalExponent = iExponent + static_cast<int>(nDigitCount) - 1;
+
+		#ifdef Q_ISA_SSE2
+			DETAIL::WriteDecimalDigitsVector(szDigits, ullSignificand, static_cast<int>(nDigitCount));
+		#else
+			IntegerToChars(ullSignificand, szDigits);
+		#endif
+		}
+		else
+		{
+			// exact value never has more significant digits, so they don't need rounding
+			const int nGenerateCount = static_cast<int>(Min<std::size_t>(nRequiredCount, RealTraits_t<V>::kMaxSignificantDigits));
+
+			if (uExponent == 0U)
+				nDigitCount = static_cast<std::size_t>(DETAIL::GenerateExactDecimalDigits(uMantissa, RealTraits_t<V>::kExponentDenormalMin, nGenerateCount, szDigits, &iDecimalExponent));
+			else
+				nDigitCount = static_cast<std::size_t>(DETAIL::GenerateExactDecimalDigits(uMantissa | (static_cast<UIntType_t>(1U) << RealTraits_t<V>::kMantissaWidth), static_cast<int>(uExponent) - RealTraits_t<V>::kExponentBias - static_cast<int>(RealTraits_t<V>::kMantissaWidth), nGenerateCount, szDigits, &iDecimalExponent));
+		}
+	}
+
+	// count of the digits to print, scientific notation keeps trailing zeros
+	const std::size_t nPrintCount = (nFormat == REAL_FORMAT_SCIENTIFIC ? nRequiredCount : (nDigitCount == 0U ? 1U : nDigitCount));
+	const std::size_t nDecimalExponentAbsolute = static_cast<std::size_t>(iDecimalExponent < 0 ? -iDecimalExponent : iDecimalExponent);
+
+	const std::size_t nIntegerCount = (iDecimalExponent >= 0 ? nDecimalExponentAbsolute + 1U : 0U);
+	const std::size_t nPositionalLength = (iDecimalExponent >= 0 ? Max(nPrintCount, nIntegerCount) + (nPrintCount > nIntegerCount ? 1U : 0U) : nPrintCount + nDecimalExponentAbsolute + 1U);
+	const std::size_t nScientificLength = nPrintCount + (nPrintCount > 1U ? 1U : 0U) + (nDecimalExponentAbsolute >= 100U ? 5U : 4U);
+
+	bool bIsPositional = false;
+	if (nFormat == REAL_FORMAT_GENERAL)
+		bIsPositional = (iDecimalExponent >= -4 && iDecimalExponent < static_cast<int>(nRequiredCount));
+	// select the notation with less characters for the shortest, prefer positional one when they're equal
+	else if (nFormat == REAL_FORMAT_SHORTEST)
+		bIsPositional = (nPositionalLength <= nScientificLength);
+
+	if ((bIsPositional ? nPositionalLength : nScientificLength) + (bIsNegative ? 2U : 1U) > nDestinationSize)
+		return nullptr;
+
+	const char* szDigitsCurrent = szDigits;
+	const char* szDigitsEnd = szDigits + nDigitCount;
+	const auto CopyDigits = [&szDigitsCurrent, szDigitsEnd](T* tszDestinationCurrent, std::size_t nCount)
+	{
+		const std::size_t nSignificantCount = Min(nCount, static_cast<std::size_t>(szDigitsEnd - szDigitsCurrent));
+		for (std::size_t i = 0U; i < nSignificantCount; ++i)
+			*tszDestinationCurrent++ = static_cast<T>(*szDigitsCurrent++);
+
+		// digits past the significant ones are zeros
+		for (std::size_t i = nSignificantCount; i < nCount; ++i)
+			*tszDestinationCurrent++ = '0';
+
+		return tszDestinationCurrent;
+	};
+
+	if (bIsNegative)
+		*tszDestinationEnd++ = '-';
+
+	if (bIsPositional)
+	{
+		if (iDecimalExponent >= 0)
+		{
+			tszDestinationEnd = CopyDigits(tszDestinationEnd, nIntegerCount);
+			if (nPrintCount > nIntegerCount)
+			{
+				*tszDestinationEnd++ = '.';
+				tszDestinationEnd = CopyDigits(tszDestinationEnd, nPrintCount - nIntegerCount);
+			}
+		}
+		else
+		{
+			*tszDestinationEnd++ = '0';
+			*tszDestinationEnd++ = '.';
+			for (std::size_t i = 1U; i < nDecimalExponentAbsolute; ++i)
+				*tszDestinationEnd++ = '0';
+			tszDestinationEnd = CopyDigits(tszDestinationEnd, nPrintCount);
+		}
+	}
+	else
+	{
+		tszDestinationEnd = CopyDigits(tszDestinationEnd, 1U);
+		if (nPrintCount > 1U)
+		{
+			*tszDestinationEnd++ = '.';
+			tszDestinationEnd = CopyDigits(tszDestinationEnd, nPrintCount - 1U);
+		}
+
+		*tszDestinationEnd++ = 'e';
+		*tszDestinationEnd++ = (iDecimalExponent < 0 ? '-' : '+');
+
+		std::size_t nExponent = nDecimalExponentAbsolute;
+		if (nExponent >= 100U)
+		{
+			*tszDestinationEnd++ = static_cast<T>('0' + nExponent / 100U);
+			nExponent %= 100U;
+		}
+
+		*tszDestinationEnd++ = static_cast<T>(arrDigitPairLUT[nExponent * 2U]);
+		*tszDestinationEnd++ = static_cast<T>(arrDigitPairLUT[nExponent * 2U + 1U]);
+	}
+
+	*tszDestinationEnd = '\0';
+	return tszDestination;
+}
+
+/**
+ * convert the time point to a string, alternative of 'strftime()', 'wcsftime()'
+ * @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+ * @param[in] tszFormat string specifying the format of conversion. formatting codes are:
+ * - '%a' abbreviated weekday name
+ * - '%A' full weekday name
+ * - '%b' abbreviated month name
+ * - '%B' full month name
+ * - '%c' date and time representation appropriate for the locale
+ * - '%C' century as a decimal number [0 .. 99]
+ * - '%d' day of the month as a decimal number [01 .. 31]
+ * - '%D' equivalent to "%m/%d/%y"
+ * - '%e' day of the month as a decimal number [1 .. 31], where single digits are preceded by a space
+ * - '%F' equivalent to "%Y-%m-%d", the ISO-8601 date format, when the year is between [1000 .. 9999] inclusive
+ * - '%g' week-based year without century as a decimal number, the ISO-8601 time format [00 .. 99]
+ * - '%G' week-based year as a decimal number, the ISO-8601 time format [0000 .. 9999]
+ * - '%h' abbreviated month name (equivalent to "%b")
+ * - '%H' hour in 24-hour format as a decimal number [00 .. 23]
+ * - '%I' hour in 12-hour format as a decimal number [01 .. 12]
+ * - '%j' day of the year as a decimal number [001 .. 366]
+ * - '%m' month as a decimal number [01 .. 12]
+ * - '%M' minute as a decimal number [00 .. 59]
+ * - '%n' new line character escape
+ * - '%p' the locale's AM/PM designations associated with a 12-hour clock
+ * - '%r' the locale's 12-hour clock time
+ * - '%R' equivalent to "%H:%M"
+ * - '%S' second as decimal number [00 .. 59]
+ * - '%t' tab character escape
+ * - '%T' equivalent to "%H:%M:%S", the ISO-8601 time format
+ * - '%u' weekday as a decimal number, the ISO-8601 time format [1 .. 7]
+ * - '%U' week number of the year as a decimal number, where the first Sunday is the first day of week 1 [00 .. 53]
+ * - '%V' week number as a decimal number, the ISO-8601 time format [01 .. 53]
+ * - '%w' weekday as a decimal number [0 .. 6]
+ * - '%W' week number of the year as a decimal number, where the first Monday is the first day of week 1 [00 .. 53]
+ * - '%x' date representation appropriate for the locale
+ * - '%X' time representation appropriate for the locale
+ * - '%y' year without century, as decimal number [00 .. 99]
+ * - '%Y' year with century, as decimal number [1900 .. 9999]
+ * - '%z' the offset from UTC, the ISO-8601 format, or no characters if no time zone is determinable
+ * - '%Z' time zone name or abbreviation, or no characters if no time zone is determinable
+ * - '%%' percent character escape
+ * @param[in] pTime pointer to the time data structure
+ * @remarks: format the @a`pTime` time point according to the @a`tszFormat` and store the result in the buffer @a`tszDestination`. can write past the end of the buffer that is too small
+ * @returns: the number of characters placed in @a`szDestination` not including the terminating null, if the total number of characters, including the terminating null, is more than @a`nDestinationSize`, returns 0 and the contents of @a`szDestination` are indeterminate
+ **/
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+std::size_t TimeToString(T* tszDestination, std::size_t nDestinationSize, const T* tszFormat, const std::tm* pTime)
+{
+	// full names of weekdays
+	constexpr const char* arrWeekdayNames[7] = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
+	// full names of months
+	constexpr const char* arrMonthNames[12] = { "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December" };
+
+	T* tszDestinationEnd = tszDestination;
+	std::size_t nRemainingSize = nDestinationSize;
+
+	while (*tszFormat != '\0' && nRemainingSize != 0U)
+	{
+		// check for the format token
+		if (*tszFormat == '%')
+		{
+			++tszFormat;
+
+			// @note: we don't support any locale (as of default C locale) and non-standard modifiers
+			if (*tszFormat == '#' || *tszFormat == 'E' || *tszFormat == 'O')
+				++tszFormat;
+
+			const T* tszPreviousEnd = tszDestinationEnd;
+
+			/*
+			 * handle format token
+			 * valid for default C locale (C standard 7.29.3.5)
+			 * @test: C standard and POSIX are very unclear and don't explicitly specify the behaviour when time components are negative
+			 */
+			switch (*tszFormat)
+			{
+			case 'a':
+			{
+				if (nRemainingSize <= 3U)
+					return 0U;
+
+				const char* szWeekdayName = arrWeekdayNames[pTime->tm_wday];
+				std::size_t nCharacter = 0U;
+				do
+				{
+					*tszDestinationEnd++ = static_cast<T>(szWeekdayName[nCharacter]);
+				} while (++nCharacter < 3U);
+
+				break;
+			}
+			case 'A':
+			{
+				const char* szWeekdayName = arrWeekdayNames[pTime->tm_wday];
+				if (nRemainingSize <= StringLength(szWeekdayName))
+					return 0U;
+
+				while (*szWeekdayName != '\0')
+					*tszDestinationEnd++ = static_cast<T>(*szWeekdayName++);
+
+				break;
+			}
+			case 'b':
+				[[fallthrough]];
+			case 'h': // equivalent to "%b"
+			{
+				if (nRemainingSize <= 3U)
+					return 0U;
+
+				const char* szMonthName = arrMonthNames[pTime->tm_mon];
+				std::size_t nCharacter = 0U;
+				do
+				{
+					*tszDestinationEnd++ = static_cast<T>(szMonthName[nCharacter]);
+				} while (++nCharacter < 3U);
+
+				break;
+			}
+			case 'B':
+			{
+				const char* szMonthName = arrMonthNames[pTime->tm_mon];
+				if (nRemainingSize <= StringLength(szMonthName))
+					return 0U;
+
+				while (*szMonthName != '\0')
+					*tszDestinationEnd++ = static_cast<T>(*szMonthName++);
+
+				break;
+			}
+			case 'c':
+			{
+				if (nRemainingSize <= 24U)
+					return 0U;
+
+				// default locale equivalent to "%a %b %e %H:%M:%S %Y"
+				if constexpr (std::is_same_v<T, wchar_t>)
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%a %b %e %H:%M:%S %Y"), pTime);
+				else
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%a %b %e %H:%M:%S %Y"), pTime);
+
+				break;
+			}
+			case 'C':
+			{
+				const int iYear = pTime->tm_year + 1900;
+				const int iCentury = iYear / 100;
+
+				if (iYear >= -99 && iYear < 0)
+				{
+					*tszDestinationEnd++ = '-';
+					*tszDestinationEnd++ = '0';
+				}
+				else if (iCentury >= 0 && iCentury < 100)
+				{
+					const char* szCenturyNumber = &arrDigitPairLUT[static_cast<unsigned int>(iCentury) * 2U];
+					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber++);
+					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber);
+				}
+				else
+					*tszDestinationEnd++ = static_cast<T>(iCentury % 10U + '0');
+
+				break;
+			}
+			case 'd':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szMonthDayNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_mday) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szMonthDayNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szMonthDayNumber);
+				break;
+			}
+			case 'D':
+				[[fallthrough]];
+			case 'x':
+			{
+				if (nRemainingSize <= 8U)
+					return 0U;
+
+				// default locale equivalent to "%m/%d/%y"
+				if constexpr (std::is_same_v<T, wchar_t>)
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%m/%d/%y"), pTime);
+				else
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%m/%d/%y"), pTime);
+
+				break;
+			}
+			case 'e':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				unsigned int uMonthDay = pTime->tm_mday;
+				const char* szMonthDayNumber = &arrDigitPairLUT[uMonthDay * 2U];
+				*tszDestinationEnd++ = static_cast<T>(uMonthDay < 10U ? ' ' : *szMonthDayNumber);
+				*tszDestinationEnd++ = static_cast<T>(szMonthDayNumber[1]);
+				break;
+			}
+			case 'F':
+			{
+				if (nRemainingSize <= 10U)
+					return 0U;
+
+				// equivalent to "%Y-%m-%d"
+				if constexpr (std::is_same_v<T, wchar_t>)
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%Y-%m-%d"), pTime);
+				else
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%Y-%m-%d"), pTime);
+
+				break;
+			}
+			case 'g':
+				[[fallthrough]];
+			case 'G':
+				[[fallthrough]];
+			case 'V':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				unsigned int uYear = pTime->tm_year + 1900U;
+				int iDays = (pTime->tm_yday - (pTime->tm_yday - pTime->tm_wday + 382) % 7 + 3);
+
+				// check if it's a leap year
+				if (iDays < 0)
+				{
+					uYear -= 1U;
+
+					const int iPreviousYearEndDay = pTime->tm_yday + (365 + ((uYear & 3U) == 0U && (uYear % 100U != 0U || uYear % 400U == 0U)));
+					iDays = (iPreviousYearEndDay - (iPreviousYearEndDay - pTime->tm_wday + 382) % 7 + 3);
+				}
+				else
+				{
+					const int iCurrentYearEndDay = pTime->tm_yday - (365 + ((uYear & 3U) == 0U && (uYear % 100U != 0U || uYear % 400U == 0U)));
+					const int iNextDays = (iCurrentYearEndDay - (iCurrentYearEndDay - pTime->tm_wday + 382) % 7 + 3);
+
+					if (iNextDays >= 0)
+					{
+						uYear += 1U;
+						iDays = iNextDays;
+					}
+				}
+
+				switch (*tszFormat)
+				{
+				case 'G':
+				{
+					const char* szCenturyNumber = &arrDigitPairLUT[(uYear / 100U) * 2U];
+					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber++);
+					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber);
+					[[fallthrough]];
+				}
+				case 'g':
+				{
+					const char* szYearNumber = &arrDigitPairLUT[(uYear % 100U) * 2U];
+					*tszDestinationEnd++ = static_cast<T>(*szYearNumber++);
+					*tszDestinationEnd++ = static_cast<T>(*szYearNumber);
+					break;
+				}
+				default:
+				{
+					const char* szWeekNumber = &arrDigitPairLUT[(iDays / 7U + 1U) * 2U];
+					*tszDestinationEnd++ = static_cast<T>(*szWeekNumber++);
+					*tszDestinationEnd++ = static_cast<T>(*szWeekNumber);
+					break;
+				}
+				}
+
+				break;
+			}
+			case 'H':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szHourNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_hour) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szHourNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szHourNumber);
+				break;
+			}
+			case 'I':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				unsigned int uHourFormat = pTime->tm_hour % 12U;
+				uHourFormat = ((uHourFormat == 0U) ? 12U : uHourFormat);
+
+				const char* szHourNumber = &arrDigitPairLUT[uHourFormat * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szHourNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szHourNumber);
+				break;
+			}
+			case 'j':
+			{
+				if (nRemainingSize <= 3U)
+					return 0U;
+
+				unsigned int uYearDay = pTime->tm_yday + 1U;
+				*tszDestinationEnd++ = static_cast<T>((uYearDay / 100U) % 10U + '0');
+
+				const char* szYearDayNumber = &arrDigitPairLUT[(uYearDay % 100U) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szYearDayNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szYearDayNumber);
+				break;
+			}
+			case 'm':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szMonthNumber = &arrDigitPairLUT[(pTime->tm_mon + 1U) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szMonthNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szMonthNumber);
+				break;
+			}
+			case 'M':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szMinuteNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_min) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber);
+				break;
+			}
+			case 'n':
+			{
+				*tszDestinationEnd++ = '\n';
+				break;
+			}
+			case 'p':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				*tszDestinationEnd++ = ((pTime->tm_hour < 12) ? 'A' : 'P');
+				*tszDestinationEnd++ = 'M';
+				break;
+			}
+			case 'r':
+			{
+				if (nRemainingSize <= 11U)
+					return 0U;
+
+				// default locale equivalent to "%I:%M:%S %p"
+				if constexpr (std::is_same_v<T, wchar_t>)
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%I:%M:%S %p"), pTime);
+				else
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%I:%M:%S %p"), pTime);
+
+				break;
+			}
+			case 'R':
+			{
+				if (nRemainingSize <= 5U)
+					return 0U;
+
+				const char* szHourNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_hour) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szHourNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szHourNumber);
+
+				*tszDestinationEnd++ = ':';
+
+				const char* szMinuteNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_min) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber);
+				break;
+			}
+			case 'S':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szSecondNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_sec) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szSecondNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szSecondNumber);
+				break;
+			}
+			case 't':
+			{
+				*tszDestinationEnd++ = '\t';
+				break;
+			}
+			case 'T':
+				[[fallthrough]];
+			case 'X':
+			{
+				if (nRemainingSize <= 8U)
+					return 0U;
+
+				// default locale equivalent to "%H:%M:%S"
+				if constexpr (std::is_same_v<T, wchar_t>)
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%H:%M:%S"), pTime);
+				else
+					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%H:%M:%S"), pTime);
+
+				break;
+			}
+			case 'u':
+			{
+				*tszDestinationEnd++ = static_cast<T>(((pTime->tm_wday + 6U) % 7U + 1U) + '0');
+				break;
+			}
+			case 'U':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szWeekNumber = &arrDigitPairLUT[((pTime->tm_yday + 7U - pTime->tm_wday) / 7U) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber);
+				break;
+			}
+			case 'w':
+			{
+				*tszDestinationEnd++ = static_cast<T>(pTime->tm_wday + '0');
+				break;
+			}
+			case 'W':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szWeekNumber = &arrDigitPairLUT[((pTime->tm_yday + 7U - ((pTime->tm_wday + 6U) % 7U)) / 7U) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber);
+				break;
+			}
+			case 'y':
+			{
+				if (nRemainingSize <= 2U)
+					return 0U;
+
+				const char* szYearNumber = &arrDigitPairLUT[((pTime->tm_year + 1900U) % 100U) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szYearNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szYearNumber);
+				break;
+			}
+			case 'Y':
+			{
+				if (nRemainingSize <= 4U)
+					return 0U;
+
+				unsigned int uYear = pTime->tm_year + 1900U;
+
+				const char* szCenturyNumber = &arrDigitPairLUT[(uYear / 100U) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber);
+
+				const char* szYearNumber = &arrDigitPairLUT[(uYear % 100U) * 2U];
+				*tszDestinationEnd++ = static_cast<T>(*szYearNumber++);
+				*tszDestinationEnd++ = static_cast<T>(*szYearNumber);
+				break;
+			}
+			case 'z':
+			{
+				// check if the time zone extension member is present
+				if constexpr (HasTmGmtOff_t<std::tm>)
+				{
+					auto GetTimeZoneOffset = []<HasTmGmtOff_t Tm_t>(const Tm_t* pTimeEx)
+					{
+						return pTimeEx->tm_gmtoff;
+					};
+
+					// check if time zone information is available
+					if (pTime->tm_isdst < 0)
+						break;
+
+					if (nRemainingSize <= 5U)
+						return 0U;
+
+					std::int64_t llOffset = GetTimeZoneOffset(pTime) / 60LL;
+					if (llOffset < 0LL)
+					{
+						*tszDestinationEnd++ = '-';
+						llOffset = -llOffset;
+					}
+					else
+						*tszDestinationEnd++ = '+';
+
+					const char* szDigitPair = &arrDigitPairLUT[(llOffset / 60U) * 2U];
+					*tszDestinationEnd++ = static_cast<T>(*szDigitPair++);
+					*tszDestinationEnd++ = static_cast<T>(*szDigitPair);
+					szDigitPair = &arrDigitPairLUT[(llOffset % 60U) * 2U];
+					*tszDestinationEnd++ = static_cast<T>(*szDigitPair++);
+					*tszDestinationEnd++ = static_cast<T>(*szDigitPair);
+				}
+
+				// @test: do we have other ways to get it on windows other than winapi calls?
+
+				break;
+			}
+			case 'Z':
+			{
+				// check if the time zone extension member is present
+				if constexpr (HasTmZone_t<std::tm>)
+				{
+					auto GetTimeZoneName = []<HasTmZone_t Tm_t>(const Tm_t* pTimeEx)
+					{
+						return pTimeEx->tm_zone;
+					};
+
+					const char* szTimeZoneName = GetTimeZoneName(pTime);
+					if (nRemainingSize <= StringLength(szTimeZoneName))
+						return 0U;
+
+					while (*szTimeZoneName != '\0')
+						*tszDestinationEnd++ = static_cast<T>(*szTimeZoneName++);
+				}
+				// otherwise print the time zone name
+				else
+				{
+					if (nRemainingSize <= 3U)
+						return 0U;
+
+					*tszDestinationEnd++ = 'P';
+					*tszDestinationEnd++ = pTime->tm_isdst ? 'D' : 'S';
+					*tszDestinationEnd++ = 'T';
+				}
+				// @test: do we have other ways to get it on windows other than winapi calls?
+
+				break;
+			}
+			case '%': // percent escape
+			{
+				*tszDestinationEnd++ = *tszFormat;
+				break;
+			}
+			default:
+				Q_ASSERT(false); // unknown token!
+				break;
+			}
+
+			nRemainingSize -= tszDestinationEnd - tszPreviousEnd;
+			++tszFormat;
+			continue;
+		}
+
+		*tszDestinationEnd++ = *tszFormat++;
+		--nRemainingSize;
+	}
+
+	// check if the limit was reached before the entire string could be stored
+	if (nRemainingSize == 0U)
+		return 0U;
+
+	*tszDestinationEnd = '\0';
+	return nDestinationSize - nRemainingSize;
+}
+
+/*
+ * time format that is compiled once to convert many time points with the same pattern, e.g. timestamps of the log
+ * - format is expanded and split at the seconds tokens on construction, including the ones of composite tokens '%c', '%r', '%T', '%X'
+ * - everything except the seconds depends only on the minute, so the runs between the seconds are converted with 'TimeToString()' once per minute to the cache,
+ *   and each conversion within the same minute copies the cached runs and writes the seconds between them
+ * - when the cache is too small for the converted runs, they're converted directly to the destination on each call
+ * - when the expanded format itself doesn't fit the capacity, the object is invalid and every conversion fails, check it with 'IsValid()' after construction
+ */
+template <typename T, std::size_t nCapacity = 128U> requires ((std::is_same_v<T, char> || std::is_same_v<T, wchar_t>) && nCapacity > 0U)
+class TimeFormat_t
+{
+public:
+	/// @param[in] tszFormat string specifying the format of conversion, with the same formatting codes as 'TimeToString()'. expanded format with the terminating null of each run should fit @a`nCapacity` characters, otherwise the object is invalid
+	explicit TimeFormat_t(const T* tszFormat)
+	{
+		T* tszRunsEnd = this->arrRuns;
+		this->bIsValid = this->Compile(tszFormat, tszRunsEnd);
+
+		*tszRunsEnd = '\0';
+	}
+
+	/// @returns: true if the expanded format fits the capacity and the time points can be converted, false otherwise
+	[[nodiscard]] bool IsValid() const
+	{
+		return this->bIsValid;
+	}
+
+	/// convert the time point to a string, alternative of 'strftime()', 'wcsftime()'
+	/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+	/// @param[in] pTime pointer to the time data structure
+	/// @remarks: unlike 'TimeToString()' never writes past the end of the buffer
+	/// @returns: the number of characters placed in @a`szDestination` not including the terminating null, if the total number of characters, including the terminating null, is more than @a`nDestinationSize` or the object is invalid, returns 0 and the contents of @a`szDestination` are indeterminate
+	std::size_t Format(T* tszDestination, std::size_t nDestinationSize, const std::tm* pTime)
+	{
+		// truncated format would silently produce the wrong result
+		if (!this->bIsValid)
+			return 0U;
 
-			const T* tszPreviousEnd = tszDestinationEnd;
+		if (!this->bIsCacheValid || !IsSameMinute(pTime, &this->timeCached))
+		{
+			this->bIsCacheValid = this->UpdateCache(pTime);
+			this->timeCached = *pTime;
+		}
 
-			/*
-			 * handle format token
-			 * valid for default C locale (C standard 7.29.3.5)
-			 * @test: C standard and POSIX are very unclear and don't explicitly specify the behaviour when time components are negative
-			 */
-			switch (*tszFormat)
-			{
-			case 'a':
+		T* tszDestinationEnd = tszDestination;
+		std::size_t nRemainingSize = nDestinationSize;
+		const T* tszRun = (this->bIsCacheValid ? this->arrCache : this->arrRuns);
+
+		for (std::size_t nRun = 0U; ; )
+		{
+			std::size_t nRunLength;
+			if (this->bIsCacheValid)
 			{
-				if (nRemainingSize <= 3U)
+				nRunLength = StringLength(tszRun);
+				if (nRemainingSize <= nRunLength)
 					return 0U;
 
-				const char* szWeekdayName = arrWeekdayNames[pTime->tm_wday];
-				std::size_t nCharacter = 0U;
-				do
-				{
-					*tszDestinationEnd++ = static_cast<T>(szWeekdayName[nCharacter]);
-				} while (++nCharacter < 3U);
+				if constexpr (std::is_same_v<T, char>)
+					MemoryCopy(tszDestinationEnd, tszRun, nRunLength);
+				else
+					MemoryCopyW(tszDestinationEnd, tszRun, nRunLength);
 
-				break;
+				tszRun += nRunLength + 1U;
 			}
-			case 'A':
+			else
 			{
-				const char* szWeekdayName = arrWeekdayNames[pTime->tm_wday];
-				if (nRemainingSize <= StringLength(szWeekdayName))
+				nRunLength = ConvertRun(tszDestinationEnd, nRemainingSize, tszRun, pTime);
+				if (nRunLength == kRunOverflow)
 					return 0U;
 
-				while (*szWeekdayName != '\0')
-					*tszDestinationEnd++ = static_cast<T>(*szWeekdayName++);
-
-				break;
+				tszRun += StringLength(tszRun) + 1U;
 			}
-			case 'b':
-				[[fallthrough]];
-			case 'h': // equivalent to "%b"
-			{
-				if (nRemainingSize <= 3U)
-					return 0U;
 
-				const char* szMonthName = arrMonthNames[pTime->tm_mon];
-				std::size_t nCharacter = 0U;
-				do
-				{
-					*tszDestinationEnd++ = static_cast<T>(szMonthName[nCharacter]);
-				} while (++nCharacter < 3U);
+			tszDestinationEnd += nRunLength;
+			nRemainingSize -= nRunLength;
 
+			if (++nRun == this->nRunCount)
 				break;
-			}
-			case 'B':
-			{
-				const char* szMonthName = arrMonthNames[pTime->tm_mon];
-				if (nRemainingSize <= StringLength(szMonthName))
-					return 0U;
 
-				while (*szMonthName != '\0')
-					*tszDestinationEnd++ = static_cast<T>(*szMonthName++);
+			if (nRemainingSize <= 2U)
+				return 0U;
 
-				break;
-			}
-			case 'c':
-			{
-				if (nRemainingSize <= 24U)
-					return 0U;
+			const char* szSecondNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_sec) * 2U];
+			*tszDestinationEnd++ = static_cast<T>(*szSecondNumber++);
+			*tszDestinationEnd++ = static_cast<T>(*szSecondNumber);
+			nRemainingSize -= 2U;
+		}
 
-				// default locale equivalent to "%a %b %e %H:%M:%S %Y"
-				if constexpr (std::is_same_v<T, wchar_t>)
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%a %b %e %H:%M:%S %Y"), pTime);
-				else
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%a %b %e %H:%M:%S %Y"), pTime);
+		*tszDestinationEnd = '\0';
+		return static_cast<std::size_t>(tszDestinationEnd - tszDestination);
+	}
 
-				break;
-			}
-			case 'C':
+	/// discard the cached runs, e.g. when the time zone data has been changed without changing the time point
+	void Reset()
+	{
+		this->bIsCacheValid = false;
+	}
+
+private:
+	// length of the converted run that doesn't fit the destination
+	static constexpr std::size_t kRunOverflow = static_cast<std::size_t>(-1);
+
+	/// append the format expanded and split at the seconds tokens to the runs
+	/// @returns: true if the expanded format fits the capacity, false otherwise
+	bool Compile(const T* tszFormat, T*& tszRunsEnd)
+	{
+		// reserve the terminating null of the last run
+		const T* const tszRunsLast = this->arrRuns + nCapacity - 1U;
+
+		while (*tszFormat != '\0')
+		{
+			const T* tszToken = tszFormat;
+
+			if (*tszFormat == '%')
 			{
-				const int iYear = pTime->tm_year + 1900;
-				const int iCentury = iYear / 100;
+				++tszFormat;
 
-				if (iYear >= -99 && iYear < 0)
+				if (*tszFormat == '#' || *tszFormat == 'E' || *tszFormat == 'O')
+					++tszFormat;
+
+				switch (*tszFormat)
 				{
-					*tszDestinationEnd++ = '-';
-					*tszDestinationEnd++ = '0';
+				case '\0': // incomplete token at the end
+					return true;
+				case 'S':
+				{
+					if (tszRunsEnd == tszRunsLast)
+						return false;
+
+					// terminate the current run, seconds are written between the runs
+					*tszRunsEnd++ = '\0';
+					++this->nRunCount;
+					++tszFormat;
+					continue;
 				}
-				else if (iCentury >= 0 && iCentury < 100)
+				// expand composite tokens that include seconds, equivalents for the default locale are the same as of 'TimeToString()'
+				case 'c':
 				{
-					const char* szCenturyNumber = &arrDigitPairLUT[static_cast<unsigned int>(iCentury) * 2U];
-					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber++);
-					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber);
+					++tszFormat;
+					if constexpr (std::is_same_v<T, wchar_t>)
+					{
+						if (!this->Compile(Q_STR(L"%a %b %e %H:%M:%S %Y"), tszRunsEnd))
+							return false;
+					}
+					else if (!this->Compile(Q_STR("%a %b %e %H:%M:%S %Y"), tszRunsEnd))
+						return false;
+
+					continue;
 				}
-				else
-					*tszDestinationEnd++ = static_cast<T>(iCentury % 10U + '0');
+				case 'r':
+				{
+					++tszFormat;
+					if constexpr (std::is_same_v<T, wchar_t>)
+					{
+						if (!this->Compile(Q_STR(L"%I:%M:%S %p"), tszRunsEnd))
+							return false;
+					}
+					else if (!this->Compile(Q_STR("%I:%M:%S %p"), tszRunsEnd))
+						return false;
 
-				break;
+					continue;
+				}
+				case 'T':
+					[[fallthrough]];
+				case 'X':
+				{
+					++tszFormat;
+					if constexpr (std::is_same_v<T, wchar_t>)
+					{
+						if (!this->Compile(Q_STR(L"%H:%M:%S"), tszRunsEnd))
+							return false;
+					}
+					else if (!this->Compile(Q_STR("%H:%M:%S"), tszRunsEnd))
+						return false;
+
+					continue;
+				}
+				default:
+					break;
+				}
 			}
-			case 'd':
+
+			// copy literal character or the whole token that doesn't depend on seconds
+			++tszFormat;
+			if (static_cast<std::size_t>(tszRunsLast - tszRunsEnd) < static_cast<std::size_t>(tszFormat - tszToken))
+				return false;
+
+			while (tszToken < tszFormat)
+				*tszRunsEnd++ = *tszToken++;
+		}
+
+		return true;
+	}
+
+	/// convert the runs of the format to the cache, each terminated with null
+	/// @returns: true if all converted runs fit the cache, false otherwise
+	bool UpdateCache(const std::tm* pTime)
+	{
+		T* tszCacheEnd = this->arrCache;
+		std::size_t nRemainingSize = nCapacity;
+		const T* tszRun = this->arrRuns;
+
+		for (std::size_t nRun = 0U; nRun < this->nRunCount; ++nRun)
+		{
+			const std::size_t nRunLength = ConvertRun(tszCacheEnd, nRemainingSize, tszRun, pTime);
+			if (nRunLength == kRunOverflow)
+				return false;
+
+			// include the terminating null
+			tszCacheEnd += nRunLength + 1U;
+			nRemainingSize -= nRunLength + 1U;
+			tszRun += StringLength(tszRun) + 1U;
+		}
+
+		return true;
+	}
+
+	/// convert the single run of the format that doesn't have the seconds tokens
+	/// @returns: the number of characters placed in @a`tszDestination` not including the terminating null, or 'kRunOverflow' if the converted run doesn't fit it
+	static std::size_t ConvertRun(T* tszDestination, const std::size_t nDestinationSize, const T* tszRun, const std::tm* pTime)
+	{
+		if (nDestinationSize == 0U)
+			return kRunOverflow;
+
+		// 'TimeToString()' returns zero both for the empty result and for the overflow, but only the former places null at the beginning
+		*tszDestination = '%';
+		const std::size_t nRunLength = TimeToString(tszDestination, nDestinationSize, tszRun, pTime);
+		return ((nRunLength != 0U || *tszDestination == '\0') ? nRunLength : kRunOverflow);
+	}
+
+	/// @returns: true if both time points are within the same minute and have the same time zone, false otherwise
+	static bool IsSameMinute(const std::tm* pTime, const std::tm* pOtherTime)
+	{
+		if (pTime->tm_min != pOtherTime->tm_min || pTime->tm_hour != pOtherTime->tm_hour || pTime->tm_mday != pOtherTime->tm_mday || pTime->tm_mon != pOtherTime->tm_mon || pTime->tm_year != pOtherTime->tm_year ||
+			pTime->tm_wday != pOtherTime->tm_wday || pTime->tm_yday != pOtherTime->tm_yday || pTime->tm_isdst != pOtherTime->tm_isdst)
+			return false;
+
+		// check if the time zone extension members are present
+		if constexpr (HasTmGmtOff_t<std::tm>)
+		{
+			auto GetTimeZoneOffset = []<HasTmGmtOff_t Tm_t>(const Tm_t* pTimeEx)
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+				return pTimeEx->tm_gmtoff;
+			};
 
-				const char* szMonthDayNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_mday) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szMonthDayNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szMonthDayNumber);
-				break;
-			}
-			case 'D':
-				[[fallthrough]];
-			case 'x':
+			if (GetTimeZoneOffset(pTime) != GetTimeZoneOffset(pOtherTime))
+				return false;
+		}
+
+		if constexpr (HasTmZone_t<std::tm>)
+		{
+			auto GetTimeZoneName = []<HasTmZone_t Tm_t>(const Tm_t* pTimeEx)
 			{
-				if (nRemainingSize <= 8U)
-					return 0U;
+				return pTimeEx->tm_zone;
+			};
 
-				// default locale equivalent to "%m/%d/%y"
-				if constexpr (std::is_same_v<T, wchar_t>)
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%m/%d/%y"), pTime);
-				else
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%m/%d/%y"), pTime);
+			if (GetTimeZoneName(pTime) != GetTimeZoneName(pOtherTime))
+				return false;
+		}
 
-				break;
-			}
-			case 'e':
+		return true;
+	}
+
+	// format split at the seconds tokens to the runs, each terminated with null
+	T arrRuns[nCapacity];
+	// count of the runs, that is one more than the count of the seconds tokens
+	std::size_t nRunCount = 1U;
+	// runs converted for the cached minute, each terminated with null
+	T arrCache[nCapacity];
+	// time point of the cached minute
+	std::tm timeCached = { };
+	bool bIsCacheValid = false;
+	// whether the expanded format fits the capacity
+	bool bIsValid = false;
+};
+
+namespace DETAIL
+{
+	/// @returns: character at the given position of the string, or null character if the position is past the end of the bounded string
+	template <bool bBounded, typename T>
+	[[nodiscard]] Q_INLINE constexpr T GetBoundedChar(const T* tszCurrent, [[maybe_unused]] const T* tszLast)
+	{
+		if constexpr (bBounded)
+			return (tszCurrent < tszLast ? *tszCurrent : T('\0'));
+		else
+			return *tszCurrent;
+	}
+
+	/// round the decimal number to the nearest floating-point number, rounded half to even, by comparing all of its significant digits with the halfway points between the floating-point numbers
+	/// @param[in] tszDigits digits of the number, that may contain leading zeros and a single decimal point
+	/// @param[in] tszSourceLast end of the string when @a`bBounded` is true, ignored otherwise
+	/// @param[in] iExponent decimal exponent of the last digit
+	/// @param[in] uBits bits of the positive floating-point number close to the decimal number, that are moved to the nearest one
+	/// @remarks: digits past the count that the halfway point can have only tell whether the number is above the point
+	/// @returns: bits of the nearest positive floating-point number
+	template <typename V, bool bBounded, typename T> requires (std::is_same_v<V, float> || std::is_same_v<V, double>)
+	typename RealTraits_t<V>::BitEquivalent_t RoundDecimalToReal(const T* tszDigits, const T* tszSourceLast, int iExponent, typename RealTraits_t<V>::BitEquivalent_t uBits)
+	{
+		using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
+
+		// max count of the significant digits to compare, the halfway point has at most one more digit than the exact value of the floating-point number
+		constexpr int kMaxExactDigits = static_cast<int>(RealTraits_t<V>::kMaxSignificantDigits) + 2;
+
+		BigNumber_t<kBigNumberDecimalCapacity> number;
+		number.Assign(0ULL);
+
+		int nDigitCount = 0;
+		bool bSticky = false;
+		bool bHasPoint = false;
+
+		// collect the digits by 9 at a time, that fit the multiplier
+		std::uint32_t uChunk = 0U;
+		int nChunkDigitCount = 0;
+		for (;; ++tszDigits)
+		{
+			const T chCurrent = GetBoundedChar<bBounded>(tszDigits, tszSourceLast);
+			if (chCurrent == '.' && !bHasPoint)
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+				bHasPoint = true;
+				continue;
+			}
 
-				unsigned int uMonthDay = pTime->tm_mday;
-				const char* szMonthDayNumber = &arrDigitPairLUT[uMonthDay * 2U];
-				*tszDestinationEnd++ = static_cast<T>(uMonthDay < 10U ? ' ' : *szMonthDayNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szMonthDayNumber);
+			if (!IsDigit(static_cast<int>(chCurrent)))
 				break;
-			}
-			case 'F':
-			{
-				if (nRemainingSize <= 10U)
-					return 0U;
 
-				// equivalent to "%Y-%m-%d"
-				if constexpr (std::is_same_v<T, wchar_t>)
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%Y-%m-%d"), pTime);
-				else
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%Y-%m-%d"), pTime);
+			// skip leading zeros
+			if (nDigitCount == 0 && chCurrent == '0')
+				continue;
 
-				break;
+			if (nDigitCount == kMaxExactDigits)
+			{
+				++iExponent;
+				bSticky |= (chCurrent != '0');
+				continue;
 			}
-			case 'g':
-				[[fallthrough]];
-			case 'G':
-				[[fallthrough]];
-			case 'V':
+
+			uChunk = uChunk * 10U + static_cast<std::uint32_t>(chCurrent - '0');
+			++nDigitCount;
+
+			if (++nChunkDigitCount == 9)
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+				number.Multiply(1000000000U, uChunk);
+				uChunk = 0U;
+				nChunkDigitCount = 0;
+			}
+		}
 
-				unsigned int uYear = pTime->tm_year + 1900U;
-				int iDays = (pTime->tm_yday - (pTime->tm_yday - pTime->tm_wday + 382) % 7 + 3);
+		if (nChunkDigitCount > 0)
+			number.Multiply(static_cast<std::uint32_t>(arrPowersOf10[nChunkDigitCount]), uChunk);
 
-				// check if it's a leap year
-				if (iDays < 0)
-				{
-					uYear -= 1U;
+		// check if the number is certainly zero or infinity, which also bounds the size of the scaled numbers
+		if (nDigitCount == 0 || iExponent + nDigitCount < RealTraits_t<V>::kExponentDecimalMin - 1)
+			return 0U;
 
-					const int iPreviousYearEndDay = pTime->tm_yday + (365 + ((uYear & 3U) == 0U && (uYear % 100U != 0U || uYear % 400U == 0U)));
-					iDays = (iPreviousYearEndDay - (iPreviousYearEndDay - pTime->tm_wday + 382) % 7 + 3);
-				}
-				else
-				{
-					const int iCurrentYearEndDay = pTime->tm_yday - (365 + ((uYear & 3U) == 0U && (uYear % 100U != 0U || uYear % 400U == 0U)));
-					const int iNextDays = (iCurrentYearEndDay - (iCurrentYearEndDay - pTime->tm_wday + 382) % 7 + 3);
+		if (iExponent + nDigitCount > RealTraits_t<V>::kExponentDecimalMax + 2)
+			return RealTraits_t<V>::kExponentMask;
 
-					if (iNextDays >= 0)
-					{
-						uYear += 1U;
-						iDays = iNextDays;
-					}
-				}
+		// compare the number with the halfway point between the floating-point number of the given bits and the next one, that is '(2 * mantissa + 1) * 2^(exponent - 1)'
+		const auto CompareHalfway = [&number, iExponent, bSticky](const UIntType_t uLowerBits) -> int
+		{
+			const UIntType_t uBiasedExponent = uLowerBits >> RealTraits_t<V>::kMantissaWidth;
+			UIntType_t uMantissa = uLowerBits & RealTraits_t<V>::kMantissaMask;
+			if (uBiasedExponent != 0U)
+				uMantissa |= RealTraits_t<V>::kMantissaMask + 1U;
 
-				switch (*tszFormat)
-				{
-				case 'G':
-				{
-					const char* szCenturyNumber = &arrDigitPairLUT[(uYear / 100U) * 2U];
-					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber++);
-					*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber);
-					[[fallthrough]];
-				}
-				case 'g':
+			const int iHalfwayExponent = (uBiasedExponent != 0U ? static_cast<int>(uBiasedExponent) : 1) - RealTraits_t<V>::kExponentBias - static_cast<int>(RealTraits_t<V>::kMantissaWidth) - 1;
+
+			BigNumber_t<kBigNumberDecimalCapacity> scaledNumber = number;
+			BigNumber_t<kBigNumberDecimalCapacity> halfway;
+			halfway.Assign(static_cast<std::uint64_t>(uMantissa) * 2ULL + 1ULL);
+
+			// 10^exponent = 5^exponent * 2^exponent, where the power of 5 is moved to the other side when the exponent is negative
+			if (iExponent >= 0)
+				scaledNumber.MultiplyPow5(iExponent);
+			else
+				halfway.MultiplyPow5(-iExponent);
+
+			// scale both to the common power of 2
+			const int iCommonExponent = Min(iExponent, iHalfwayExponent);
+			scaledNumber.ShiftLeft(static_cast<std::uint32_t>(iExponent - iCommonExponent));
+			halfway.ShiftLeft(static_cast<std::uint32_t>(iHalfwayExponent - iCommonExponent));
+
+			const int iComparison = scaledNumber.Compare(halfway);
+			return ((iComparison == 0 && bSticky) ? 1 : iComparison);
+		};
+
+		// move to the next floating-point number while the number is above its halfway point, or to the previous one while the number is below it, ties to even
+		while (true)
+		{
+			if (uBits != RealTraits_t<V>::kExponentMask)
+			{
+				if (const int iComparison = CompareHalfway(uBits); iComparison > 0 || (iComparison == 0 && (uBits & 1U) != 0U))
 				{
-					const char* szYearNumber = &arrDigitPairLUT[(uYear % 100U) * 2U];
-					*tszDestinationEnd++ = static_cast<T>(*szYearNumber++);
-					*tszDestinationEnd++ = static_cast<T>(*szYearNumber);
-					break;
+					++uBits;
+					continue;
 				}
-				default:
+			}
+
+			if (uBits != 0U)
+			{
+				if (const int iComparison = CompareHalfway(uBits - 1U); iComparison < 0 || (iComparison == 0 && (uBits & 1U) != 0U))
 				{
-					const char* szWeekNumber = &arrDigitPairLUT[(iDays / 7U + 1U) * 2U];
-					*tszDestinationEnd++ = static_cast<T>(*szWeekNumber++);
-					*tszDestinationEnd++ = static_cast<T>(*szWeekNumber);
-					break;
-				}
+					--uBits;
+					continue;
 				}
+			}
+
+			return uBits;
+		}
+	}
+
+	/// common implementation of the null-terminated and bounded string to integer number conversions
+	/// @param[in] tszSourceLast end of the string when @a`bBounded` is true, ignored otherwise
+	/// @param[out] ptszSourceEnd pointer past the last parsed character, or @a`tszSourceBegin` if no conversion could be performed
+	template <typename V, bool bBounded, typename T>
+	constexpr V ParseInteger(const T* tszSourceBegin, const T* tszSourceLast, const T** ptszSourceEnd, int iBase, int* pnError)
+	{
+		if (iBase < 0 || iBase == 1 || iBase > kMaxNumberBase)
+		{
+			*ptszSourceEnd = tszSourceBegin;
+			*pnError = EINVAL; // given number base is out of range
+			return 0;
+		}
 
-				break;
+		const T* tszSourceCurrent = tszSourceBegin;
+
+		// strip off the leading blanks
+		while (IsSpace(static_cast<int>(GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast))))
+			++tszSourceCurrent;
+
+		// check for a sign
+		const T chSign = GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast);
+		const bool bPositive = ((chSign == '+' || chSign == '-') ? (*tszSourceCurrent++ == '+') : true);
+		constexpr bool bUnsigned = !IsSigned_v<V>;
+
+		// the zero of the base prefix is the number itself when no digits follow the prefix
+		bool bIsNumber = false;
+		const T* tszPrefixZeroEnd = tszSourceBegin;
+
+		// check if user provided exact number base
+		if (iBase > 0)
+		{
+			// strip 0x or 0X
+			if (iBase == 16 && GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '0' && (GetBoundedChar<bBounded>(tszSourceCurrent + 1, tszSourceLast) | ('a' ^ 'A')) == 'x')
+			{
+				tszPrefixZeroEnd = tszSourceCurrent + 1;
+				tszSourceCurrent += 2;
 			}
-			case 'H':
+		}
+		// otherwise try to determine base automatically
+		else if (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '0')
+		{
+			if ((GetBoundedChar<bBounded>(++tszSourceCurrent, tszSourceLast) | ('a' ^ 'A')) == 'x')
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
-
-				const char* szHourNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_hour) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szHourNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szHourNumber);
-				break;
+				// a hexadecimal constant consists of the prefix 0x or 0X followed by a sequence of the decimal digits and the letters a (or A) through f (or F) with values 10 through 15 respectively (C standard 6.4.4.1)
+				iBase = 16;
+				tszPrefixZeroEnd = tszSourceCurrent++;
 			}
-			case 'I':
+			else
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+				// an octal constant consists of the prefix 0 optionally followed by a sequence of the digits 0 through 7 only (C standard 6.4.4.1)
+				iBase = 8;
+				bIsNumber = true;
+			}
+		}
+		else
+			// a decimal constant begins with a nonzero digit and consists of a sequence of decimal digits (C standard 6.4.4.1)
+			iBase = 10;
 
-				unsigned int uHourFormat = pTime->tm_hour % 12U;
-				uHourFormat = ((uHourFormat == 0U) ? 12U : uHourFormat);
+		// accumulate the number in 64 bits, unless the type is wider
+		using UnsignedType_t = std::conditional_t<(sizeof(V) > sizeof(std::uint64_t)), MakeUnsigned_t<V>, std::uint64_t>;
+		constexpr UnsignedType_t uNegativeMax = (bUnsigned ? GetIntegerMax<V>() : (static_cast<UnsignedType_t>(GetIntegerMax<V>()) + 1U));
+		const UnsignedType_t uAbsoluteMax = (bPositive ? GetIntegerMax<V>() : uNegativeMax);
+		const UnsignedType_t uAbsoluteMaxOfBase = uAbsoluteMax / static_cast<UnsignedType_t>(iBase);
 
-				const char* szHourNumber = &arrDigitPairLUT[uHourFormat * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szHourNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szHourNumber);
-				break;
-			}
-			case 'j':
-			{
-				if (nRemainingSize <= 3U)
-					return 0U;
+		UnsignedType_t uResult = 0U;
 
-				unsigned int uYearDay = pTime->tm_yday + 1U;
-				*tszDestinationEnd++ = static_cast<T>((uYearDay / 100U) % 10U + '0');
+		// parse decimal and hexadecimal digits by 8 characters at a time, the chunk that may overflow and the characters near the end of the string or the page boundary are left for the loop below
+		if constexpr (sizeof(T) == 1U)
+		{
+			if (!std::is_constant_evaluated() && (iBase == 10 || iBase == 16))
+				tszSourceCurrent = ParseDigitChunks<bBounded>(tszSourceCurrent, tszSourceLast, iBase, uAbsoluteMax, uResult, bIsNumber);
+		}
 
-				const char* szYearDayNumber = &arrDigitPairLUT[(uYearDay % 100U) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szYearDayNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szYearDayNumber);
-				break;
-			}
-			case 'm':
-			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+		for (bool bIsDigit, bIsAlpha = false; ((bIsDigit = IsDigit(static_cast<int>(GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast))))) || ((bIsAlpha = IsAlpha(static_cast<int>(GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast))))); ) // @note: double parenthesis to suppress warnings
+		{
+			int iCurrentDigit = 0;
 
-				const char* szMonthNumber = &arrDigitPairLUT[(pTime->tm_mon + 1U) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szMonthNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szMonthNumber);
-				break;
-			}
-			case 'M':
-			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+			if (bIsDigit)
+				iCurrentDigit = *tszSourceCurrent - '0';
+			else if (bIsAlpha)
+				iCurrentDigit = (*tszSourceCurrent | ('a' ^ 'A')) - 'a' + 0xA;
 
-				const char* szMinuteNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_min) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber);
+			if (iCurrentDigit >= iBase)
 				break;
-			}
-			case 'n':
+
+			bIsNumber = true;
+			++tszSourceCurrent;
+
+			// if the number has already hit the maximum value for the current type then the result cannot change, but we still need to advance source to the end of the number
+			if (uResult == uAbsoluteMax)
 			{
-				*tszDestinationEnd++ = '\n';
-				break;
+				*pnError = ERANGE; // numeric overflow
+				continue;
 			}
-			case 'p':
+
+			if (uResult <= uAbsoluteMaxOfBase)
+				uResult *= iBase;
+			else
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+				uResult = uAbsoluteMax;
+				*pnError = ERANGE; // numeric overflow
+			}
 
-				*tszDestinationEnd++ = ((pTime->tm_hour < 12) ? 'A' : 'P');
-				*tszDestinationEnd++ = 'M';
-				break;
+			if (uResult <= uAbsoluteMax - iCurrentDigit)
+				uResult += iCurrentDigit;
+			else
+			{
+				uResult = uAbsoluteMax;
+				*pnError = ERANGE; // numeric overflow
 			}
-			case 'r':
+		}
+
+		*ptszSourceEnd = (bIsNumber ? tszSourceCurrent : tszPrefixZeroEnd);
+
+		// clamp on overflow
+		if (*pnError == ERANGE)
+			return ((bPositive || bUnsigned) ? GetIntegerMax<V>() : GetIntegerMin<V>());
+
+		// negate in the unsigned type, since the magnitude of the minimal value doesn't fit into the signed one
+		return static_cast<V>(bPositive ? uResult : static_cast<UnsignedType_t>(0U - uResult));
+	}
+
+	/// common implementation of the null-terminated and bounded string to floating-point number conversions
+	/// @param[in] tszSourceLast end of the string when @a`bBounded` is true, ignored otherwise
+	/// @param[out] ptszSourceEnd pointer past the last parsed character, or @a`tszSourceBegin` if no conversion could be performed
+	template <typename V, bool bBounded, typename T>
+	constexpr V ParseReal(const T* tszSourceBegin, const T* tszSourceLast, const T** ptszSourceEnd, int* pnError)
+	{
+		using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
+		UIntType_t uBits;
+
+		const T* tszSourceCurrent = tszSourceBegin;
+
+		// skip leading whitespaces
+		while (IsSpace(static_cast<int>(GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast))))
+			++tszSourceCurrent;
+
+		// extract the sign
+		UIntType_t uSign = 0U;
+		if (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '+')
+			++tszSourceCurrent;
+		else if (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '-')
+		{
+			uSign = RealTraits_t<V>::kSignMask;
+			++tszSourceCurrent;
+		}
+
+		// check for NaN value
+		if ((GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) | ('a' ^ 'A')) == 'n' && (GetBoundedChar<bBounded>(tszSourceCurrent + 1, tszSourceLast) | ('a' ^ 'A')) == 'a' && (GetBoundedChar<bBounded>(tszSourceCurrent + 2, tszSourceLast) | ('a' ^ 'A')) == 'n')
+		{
+			tszSourceCurrent += 3;
+			uBits = (uSign | RealTraits_t<V>::kExponentMask | RealTraits_t<V>::kQuietNanMask);
+
+			// check for nan(n-char-sequence), where the sequence of digits, letters and underscores is the payload of NaN in the form of integer number
+			if (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '(')
 			{
-				if (nRemainingSize <= 11U)
-					return 0U;
+				const T* tszSequenceBegin = tszSourceCurrent + 1;
+				const T* tszSequenceEnd = tszSequenceBegin;
+				while (IsAlphaNum(static_cast<int>(GetBoundedChar<bBounded>(tszSequenceEnd, tszSourceLast))) || GetBoundedChar<bBounded>(tszSequenceEnd, tszSourceLast) == '_')
+					++tszSequenceEnd;
 
-				// default locale equivalent to "%I:%M:%S %p"
-				if constexpr (std::is_same_v<T, wchar_t>)
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%I:%M:%S %p"), pTime);
-				else
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%I:%M:%S %p"), pTime);
+				if (GetBoundedChar<bBounded>(tszSequenceEnd, tszSourceLast) == ')')
+				{
+					const T* tszPayloadEnd;
+					int nPayloadError = 0;
+					const UIntType_t uPayload = ParseInteger<UIntType_t, true>(tszSequenceBegin, tszSequenceEnd, &tszPayloadEnd, 0, &nPayloadError);
+					if (tszPayloadEnd == tszSequenceEnd && nPayloadError == 0)
+						uBits |= (uPayload & (RealTraits_t<V>::kQuietNanMask - 1U));
 
-				break;
+					tszSourceCurrent = tszSequenceEnd + 1;
+				}
 			}
-			case 'R':
-			{
-				if (nRemainingSize <= 5U)
-					return 0U;
 
-				const char* szHourNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_hour) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szHourNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szHourNumber);
+			*ptszSourceEnd = tszSourceCurrent;
+			return std::bit_cast<V>(uBits);
+		}
 
-				*tszDestinationEnd++ = ':';
+		// check for infinity value
+		if ((GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) | ('a' ^ 'A')) == 'i' && (GetBoundedChar<bBounded>(tszSourceCurrent + 1, tszSourceLast) | ('a' ^ 'A')) == 'n' && (GetBoundedChar<bBounded>(tszSourceCurrent + 2, tszSourceLast) | ('a' ^ 'A')) == 'f')
+		{
+			// @test: tho C standard states that pointer to "inite" should be stored, we do also account it
+			tszSourceCurrent += 3;
+			if ((GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) | ('a' ^ 'A')) == 'i' && (GetBoundedChar<bBounded>(tszSourceCurrent + 1, tszSourceLast) | ('a' ^ 'A')) == 'n' && (GetBoundedChar<bBounded>(tszSourceCurrent + 2, tszSourceLast) | ('a' ^ 'A')) == 'i' && (GetBoundedChar<bBounded>(tszSourceCurrent + 3, tszSourceLast) | ('a' ^ 'A')) == 't' && (GetBoundedChar<bBounded>(tszSourceCurrent + 4, tszSourceLast) | ('a' ^ 'A')) == 'y')
+				tszSourceCurrent += 5;
+
+			*ptszSourceEnd = tszSourceCurrent;
+			uBits = (uSign | RealTraits_t<V>::kExponentMask);
+			return std::bit_cast<V>(uBits);
+		}
 
-				const char* szMinuteNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_min) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szMinuteNumber);
-				break;
+		// extract exponent value, clamped to the range that is guaranteed to overflow or underflow any representable number
+		const auto ParseExponent = [tszSourceLast](const T*& tszCurrent) -> int
+		{
+			const T* tszExponent = tszCurrent + 1;
+
+			// extract exponent sign
+			bool bExponentSign = false;
+			if (GetBoundedChar<bBounded>(tszExponent, tszSourceLast) == '+')
+				++tszExponent;
+			else if (GetBoundedChar<bBounded>(tszExponent, tszSourceLast) == '-')
+			{
+				bExponentSign = true;
+				++tszExponent;
 			}
-			case 'S':
+
+			// exponent marker without digits is not part of the number
+			if (!IsDigit(static_cast<int>(GetBoundedChar<bBounded>(tszExponent, tszSourceLast))))
+				return 0;
+
+			int iExponentValue = 0;
+			while (IsDigit(static_cast<int>(GetBoundedChar<bBounded>(tszExponent, tszSourceLast))))
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+				if (iExponentValue < 100000)
+					iExponentValue = iExponentValue * 10 + (*tszExponent - '0');
 
-				const char* szSecondNumber = &arrDigitPairLUT[static_cast<unsigned int>(pTime->tm_sec) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szSecondNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szSecondNumber);
-				break;
+				++tszExponent;
 			}
-			case 't':
+
+			tszCurrent = tszExponent;
+			return (bExponentSign ? -iExponentValue : iExponentValue);
+		};
+
+		// check for hexadecimal form, that is converted exactly
+		if constexpr (std::is_same_v<V, float> || std::is_same_v<V, double>)
+		{
+			const auto GetHexDigitValue = [](const T chCurrent) -> int
 			{
-				*tszDestinationEnd++ = '\t';
-				break;
-			}
-			case 'T':
-				[[fallthrough]];
-			case 'X':
+				if (IsDigit(static_cast<int>(chCurrent)))
+					return chCurrent - '0';
+
+				const int iLowerChar = (static_cast<int>(chCurrent) | ('a' ^ 'A'));
+				return ((iLowerChar >= 'a' && iLowerChar <= 'f') ? iLowerChar - 'a' + 0xA : -1);
+			};
+
+			if (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '0' && (GetBoundedChar<bBounded>(tszSourceCurrent + 1, tszSourceLast) | ('a' ^ 'A')) == 'x')
 			{
-				if (nRemainingSize <= 8U)
-					return 0U;
+				const T* tszHexCurrent = tszSourceCurrent + 2;
 
-				// default locale equivalent to "%H:%M:%S"
-				if constexpr (std::is_same_v<T, wchar_t>)
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR(L"%H:%M:%S"), pTime);
-				else
-					tszDestinationEnd += TimeToString(tszDestinationEnd, nRemainingSize, Q_STR("%H:%M:%S"), pTime);
+				// the prefix must be followed by at least one digit, otherwise only its zero is parsed as decimal number
+				if (GetHexDigitValue(GetBoundedChar<bBounded>(tszHexCurrent, tszSourceLast)) >= 0 || (GetBoundedChar<bBounded>(tszHexCurrent, tszSourceLast) == '.' && GetHexDigitValue(GetBoundedChar<bBounded>(tszHexCurrent + 1, tszSourceLast)) >= 0))
+				{
+					std::uint64_t ullSignificand = 0ULL;
+					int iExponentBinary = 0;
+					bool bSticky = false;
 
-				break;
+					// extract integer part, digits that don't fit the significand only scale it
+					for (int iDigit; (iDigit = GetHexDigitValue(GetBoundedChar<bBounded>(tszHexCurrent, tszSourceLast))) >= 0; ++tszHexCurrent)
+					{
+						if ((ullSignificand >> 60ULL) == 0ULL)
+							ullSignificand = (ullSignificand << 4ULL) | static_cast<std::uint64_t>(iDigit);
+						else
+						{
+							iExponentBinary += 4;
+							bSticky |= (iDigit != 0);
+						}
+					}
+
+					// extract fractional part
+					if (GetBoundedChar<bBounded>(tszHexCurrent, tszSourceLast) == '.')
+					{
+						++tszHexCurrent;
+
+						for (int iDigit; (iDigit = GetHexDigitValue(GetBoundedChar<bBounded>(tszHexCurrent, tszSourceLast))) >= 0; ++tszHexCurrent)
+						{
+							if ((ullSignificand >> 60ULL) == 0ULL)
+							{
+								ullSignificand = (ullSignificand << 4ULL) | static_cast<std::uint64_t>(iDigit);
+								iExponentBinary -= 4;
+							}
+							else
+								bSticky |= (iDigit != 0);
+						}
+					}
+
+					// check if binary exponent is present
+					if ((GetBoundedChar<bBounded>(tszHexCurrent, tszSourceLast) | ('a' ^ 'A')) == 'p')
+						iExponentBinary += ParseExponent(tszHexCurrent);
+
+					*ptszSourceEnd = tszHexCurrent;
+
+					const int nError = ConvertBinaryToReal<V>(ullSignificand, iExponentBinary, bSticky, &uBits);
+					if (nError != 0)
+						*pnError = nError;
+
+					return std::bit_cast<V>(static_cast<UIntType_t>(uSign | uBits));
+				}
 			}
-			case 'u':
+		}
+
+		const T* tszDigitsBegin = tszSourceCurrent;
+
+		// skip leading zeros
+		bool bHasDigits = false;
+		while (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '0')
+		{
+			bHasDigits = true;
+			++tszSourceCurrent;
+		}
+
+		// max count of digits to parse, including excess digit for correct rounding
+		constexpr int kMaxPrecisionDigits = std::numeric_limits<double>::max_digits10 + 1;
+
+		int nDigitCount = 0;
+		int iExponentDecimal = 0;
+		BigInteger_t mantissaDecimal = { };
+
+		// extract integer part, by 8 digits at a time while they fit the significand
+		// @note: integer parts of single-precision numbers are usually too short to benefit from it
+		if constexpr (sizeof(T) == 1U && !std::is_same_v<V, float>)
+		{
+			if (!std::is_constant_evaluated())
+				tszSourceCurrent = ParseDecimalDigitChunks<bBounded>(tszSourceCurrent, tszSourceLast, mantissaDecimal.ullLow, nDigitCount, kMaxPrecisionDigits);
+		}
+
+		while (IsDigit(static_cast<int>(GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast))))
+		{
+			if (++nDigitCount <= kMaxPrecisionDigits)
+				mantissaDecimal.ullLow = mantissaDecimal.ullLow * 10U + (*tszSourceCurrent - '0');
+			else
+				++iExponentDecimal;
+
+			++tszSourceCurrent;
+		}
+
+		// extract fractional part
+		if (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '.')
+		{
+			// the point must be adjacent to at least one digit
+			if (nDigitCount > 0 || bHasDigits || IsDigit(static_cast<int>(GetBoundedChar<bBounded>(tszSourceCurrent + 1, tszSourceLast))))
+				++tszSourceCurrent;
+
+			// skip leading zeros of the fractional part, so they don't take place of the significant digits
+			if (nDigitCount == 0)
 			{
-				*tszDestinationEnd++ = static_cast<T>(((pTime->tm_wday + 6U) % 7U + 1U) + '0');
-				break;
+				while (GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) == '0')
+				{
+					bHasDigits = true;
+					--iExponentDecimal;
+					++tszSourceCurrent;
+				}
 			}
-			case 'U':
-			{
-				if (nRemainingSize <= 2U)
-					return 0U;
 
-				const char* szWeekNumber = &arrDigitPairLUT[((pTime->tm_yday + 7U - pTime->tm_wday) / 7U) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber);
-				break;
-			}
-			case 'w':
+			// extract fractional part digits by 8 at a time while they fit the significand
+			if constexpr (sizeof(T) == 1U)
 			{
-				*tszDestinationEnd++ = static_cast<T>(pTime->tm_wday + '0');
-				break;
+				if (!std::is_constant_evaluated())
+				{
+					const int nPreviousDigitCount = nDigitCount;
+					tszSourceCurrent = ParseDecimalDigitChunks<bBounded>(tszSourceCurrent, tszSourceLast, mantissaDecimal.ullLow, nDigitCount, kMaxPrecisionDigits);
+					iExponentDecimal -= nDigitCount - nPreviousDigitCount;
+				}
 			}
-			case 'W':
-			{
-				if (nRemainingSize <= 2U)
-					return 0U;
 
-				const char* szWeekNumber = &arrDigitPairLUT[((pTime->tm_yday + 7U - ((pTime->tm_wday + 6U) % 7U)) / 7U) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szWeekNumber);
-				break;
-			}
-			case 'y':
+			while (IsDigit(static_cast<int>(GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast))))
 			{
-				if (nRemainingSize <= 2U)
-					return 0U;
+				bHasDigits = true;
 
-				const char* szYearNumber = &arrDigitPairLUT[((pTime->tm_year + 1900U) % 100U) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szYearNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szYearNumber);
-				break;
+				if (++nDigitCount <= kMaxPrecisionDigits)
+				{
+					mantissaDecimal.ullLow = mantissaDecimal.ullLow * 10U + (*tszSourceCurrent - '0');
+					--iExponentDecimal;
+				}
+
+				++tszSourceCurrent;
 			}
-			case 'Y':
-			{
-				if (nRemainingSize <= 4U)
-					return 0U;
+		}
 
-				unsigned int uYear = pTime->tm_year + 1900U;
+		// check if no conversion could be performed
+		if (nDigitCount == 0 && !bHasDigits)
+		{
+			*ptszSourceEnd = tszSourceBegin;
+			return V(0);
+		}
 
-				const char* szCenturyNumber = &arrDigitPairLUT[(uYear / 100U) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szCenturyNumber);
+		// check if exponent is present
+		if ((GetBoundedChar<bBounded>(tszSourceCurrent, tszSourceLast) | ('a' ^ 'A')) == 'e')
+			iExponentDecimal += ParseExponent(tszSourceCurrent);
 
-				const char* szYearNumber = &arrDigitPairLUT[(uYear % 100U) * 2U];
-				*tszDestinationEnd++ = static_cast<T>(*szYearNumber++);
-				*tszDestinationEnd++ = static_cast<T>(*szYearNumber);
-				break;
-			}
-			case 'z':
+		*ptszSourceEnd = tszSourceCurrent;
+
+		// check for exponent underflow
+		if (nDigitCount > 0 && iExponentDecimal + nDigitCount < RealTraits_t<V>::kExponentDecimalMin)
+		{
+			*pnError = ERANGE;
+
+			// signed zero
+			uBits = uSign;
+			return std::bit_cast<V>(uBits);
+		}
+
+		// check for exponent overflow
+		if (nDigitCount > 0 && iExponentDecimal > (RealTraits_t<V>::kExponentDecimalMax + kMaxPrecisionDigits))
+		{
+			*pnError = ERANGE;
+
+			// signed infinity
+			uBits = uSign | RealTraits_t<V>::kExponentMask;
+			return std::bit_cast<V>(uBits);
+		}
+
+		// try the fast conversion first
+		if constexpr (std::is_same_v<V, float> || std::is_same_v<V, double>)
+		{
+			if (!std::is_constant_evaluated())
 			{
-				// check if the time zone extension member is present
-				if constexpr (HasTmGmtOff_t<std::tm>)
+			#if Q_ARCH_BIT == 64
+				// both the significand and the power of 10 are exactly representable, so the single rounding of their product or quotient is correct (W. Clinger)
+				// @note: requires single-precision arithmetic without extended intermediate precision, which 64-bit targets guarantee
+				if constexpr (std::is_same_v<V, float>)
 				{
-					auto GetTimeZoneOffset = []<HasTmGmtOff_t Tm_t>(const Tm_t* pTimeEx)
+					if (nDigitCount <= kMaxPrecisionDigits && mantissaDecimal.ullLow <= (1ULL << 24ULL) && iExponentDecimal >= -10 && iExponentDecimal <= 10)
 					{
-						return pTimeEx->tm_gmtoff;
-					};
-
-					// check if time zone information is available
-					if (pTime->tm_isdst < 0)
-						break;
+						const float flSignificand = static_cast<float>(mantissaDecimal.ullLow);
+						uBits = std::bit_cast<UIntType_t>(iExponentDecimal < 0 ? flSignificand / arrPowersOf10Float[-iExponentDecimal] : flSignificand * arrPowersOf10Float[iExponentDecimal]);
+						return std::bit_cast<V>(static_cast<UIntType_t>(uSign | uBits));
+					}
+				}
+			#endif
 
-					if (nRemainingSize <= 5U)
-						return 0U;
+				bool bIsConverted;
+				if (nDigitCount <= kMaxPrecisionDigits)
+				{
+					bIsConverted = DETAIL::ConvertDecimalToRealFast<V>(mantissaDecimal.ullLow, iExponentDecimal, 0, &uBits);
 
-					std::int64_t llOffset = GetTimeZoneOffset(pTime) / 60LL;
-					if (llOffset < 0LL)
+					// the number may be exactly halfway between two floating-point numbers only if it's a binary fraction, i.e. the significand is divisible by 5^-iExponentDecimal, then it can be converted with the exact power
+					if (!bIsConverted && iExponentDecimal < 0 && iExponentDecimal >= -19)
 					{
-						*tszDestinationEnd++ = '-';
-						llOffset = -llOffset;
+						const std::uint64_t ullPowerOf5 = arrPowersOf10[-iExponentDecimal] >> -iExponentDecimal;
+						bIsConverted = (mantissaDecimal.ullLow % ullPowerOf5 == 0ULL && DETAIL::ConvertDecimalToRealFast<V>(mantissaDecimal.ullLow / ullPowerOf5, 0, iExponentDecimal, &uBits));
 					}
-					else
-						*tszDestinationEnd++ = '+';
+				}
+				// otherwise the excess digits were truncated and the number is in range [significand .. significand + 1) * 10^iExponentDecimal, which is converted when both of its bounds round to the same floating-point number
+				else
+				{
+					UIntType_t uUpperBits;
+					bIsConverted = (DETAIL::ConvertDecimalToRealFast<V>(mantissaDecimal.ullLow, iExponentDecimal, 0, &uBits) && DETAIL::ConvertDecimalToRealFast<V>(mantissaDecimal.ullLow + 1ULL, iExponentDecimal, 0, &uUpperBits) && uBits == uUpperBits);
+				}
 
-					const char* szDigitPair = &arrDigitPairLUT[(llOffset / 60U) * 2U];
-					*tszDestinationEnd++ = static_cast<T>(*szDigitPair++);
-					*tszDestinationEnd++ = static_cast<T>(*szDigitPair);
-					szDigitPair = &arrDigitPairLUT[(llOffset % 60U) * 2U];
-					*tszDestinationEnd++ = static_cast<T>(*szDigitPair++);
-					*tszDestinationEnd++ = static_cast<T>(*szDigitPair);
+				if (bIsConverted)
+				{
+					// check for underflow to zero or overflow to infinity of the non-zero number
+					if (uBits == 0U || uBits == RealTraits_t<V>::kExponentMask)
+						*pnError = ERANGE;
+
+					return std::bit_cast<V>(static_cast<UIntType_t>(uSign | uBits));
 				}
+			}
+		}
 
-				// @test: do we have other ways to get it on windows other than winapi calls?
+		// decimal exponent of the last digit, including the ones that don't fit the significand, and the error before the slow conversion reports its own range error
+		[[maybe_unused]] const int iExponentLast = iExponentDecimal - (nDigitCount > kMaxPrecisionDigits ? nDigitCount - kMaxPrecisionDigits : 0);
+		[[maybe_unused]] const bool bIsZero = (mantissaDecimal.ullLow == 0ULL);
+		[[maybe_unused]] const int nPreviousError = *pnError;
 
-				break;
+		// convert decimal exponent into binary
+		int iExponent = 0;
+
+		// check if the number is true zero
+		if (mantissaDecimal.ullLow == 0ULL)
+		{
+			iExponent = RealTraits_t<V>::kExponentMin - 1;
+			mantissaDecimal.ullLow = 0ULL;
+		}
+		else
+		{
+			// normalize mantissa
+			// keep high 4 bits non-zero
+			std::uint8_t nLeadingZerosCount;
+			if (mantissaDecimal.ullHigh != 0ULL)
+				nLeadingZerosCount = static_cast<std::uint8_t>(std::countl_zero(mantissaDecimal.ullHigh)) - 4U;
+			else
+				nLeadingZerosCount = static_cast<std::uint8_t>(std::countl_zero(mantissaDecimal.ullLow)) + 60U;
+
+			mantissaDecimal.ShiftLeft(nLeadingZerosCount);
+			iExponent -= nLeadingZerosCount;
+
+			// take performed shift into account
+			iExponent += 123;
+
+			// @todo: normalization approach is robust but quite slow
+			// check for positive exponent
+			if (iExponentDecimal > 0)
+			{
+				do
+				{
+					mantissaDecimal.Multiply(10ULL);
+
+					// keep high 4 bits all zero
+					while ((mantissaDecimal.ullHigh >> 60ULL) != 0ULL)
+					{
+						mantissaDecimal.ShiftRight(1U);
+						++iExponent;
+					}
+				} while (--iExponentDecimal > 0);
 			}
-			case 'Z':
+			// otherwise check for negative exponent
+			else if (iExponentDecimal < 0)
 			{
-				// check if the time zone extension member is present
-				if constexpr (HasTmZone_t<std::tm>)
+				do
 				{
-					auto GetTimeZoneName = []<HasTmZone_t Tm_t>(const Tm_t* pTimeEx)
+					mantissaDecimal.Divide10();
+
+					if ((mantissaDecimal.ullHigh | mantissaDecimal.ullLow) != 0ULL)
 					{
-						return pTimeEx->tm_zone;
-					};
+						// @todo: do use bsr/clz only when it's guaranteed to compile into appropriate instructions otherwise it will be less efficient
+						// keep high 4 bits non-zero
+	#if 0
+						int nLeadingZerosCount;
+						if (mantissaDecimal.ullHigh != 0ULL)
+							nLeadingZerosCount = std::countl_zero(mantissaDecimal.ullHigh) - 4;
+						else
+							nLeadingZerosCount = std::countl_zero(mantissaDecimal.ullLow) + 60;
+
+						mantissaDecimal.ShiftLeft(nLeadingZerosCount);
+						iExponent -= nLeadingZerosCount;
+	#else
+						while ((mantissaDecimal.ullHigh >> 60ULL) == 0ULL)
+						{
+							mantissaDecimal.ShiftLeft(1U);
+							--iExponent;
+						}
+
+						mantissaDecimal.ShiftRight(1U);
+						++iExponent;
+	#endif
+					}
+				} while (++iExponentDecimal < 0);
+			}
 
-					const char* szTimeZoneName = GetTimeZoneName(pTime);
-					if (nRemainingSize <= StringLength(szTimeZoneName))
-						return 0U;
+			mantissaDecimal.ShiftLeft(4U);
+		}
 
-					while (*szTimeZoneName != '\0')
-						*tszDestinationEnd++ = static_cast<T>(*szTimeZoneName++);
+		// convert decimal mantissa into binary
+		UIntType_t uMantissa;
+		if (iExponent > RealTraits_t<V>::kExponentMax)
+		{
+			// infinity
+			iExponent = (1 << RealTraits_t<V>::kExponentWidth) - 1;
+			uMantissa = 0U;
+
+			*pnError = ERANGE;
+		}
+		else
+		{
+			// check if value is denormalized
+			if (iExponent < RealTraits_t<V>::kExponentMin)
+			{
+				// check for true zero
+				if ((mantissaDecimal.ullHigh | mantissaDecimal.ullLow) == 0ULL)
+					uMantissa = 0U;
+				// check for denormalized exponent underflow
+				else if (iExponent < RealTraits_t<V>::kExponentDenormalMin - 1)
+				{
+					uMantissa = 0U;
+					*pnError = ERANGE;
 				}
-				// otherwise print the time zone name
 				else
 				{
-					if (nRemainingSize <= 3U)
-						return 0U;
-
-					*tszDestinationEnd++ = 'P';
-					*tszDestinationEnd++ = pTime->tm_isdst ? 'D' : 'S';
-					*tszDestinationEnd++ = 'T';
+					mantissaDecimal.ullHigh >>= (-RealTraits_t<V>::kExponentBias - iExponent);
+					uMantissa = mantissaDecimal.ullHigh >> (64ULL - RealTraits_t<V>::kMantissaWidth);
 				}
-				// @test: do we have other ways to get it on windows other than winapi calls?
 
-				break;
+				iExponent = -RealTraits_t<V>::kExponentMax;
 			}
-			case '%': // percent escape
+			// otherwise value is normalized
+			else
 			{
-				*tszDestinationEnd++ = *tszFormat;
-				break;
-			}
-			default:
-				Q_ASSERT(false); // unknown token!
-				break;
+				// set implicit bit
+				mantissaDecimal.ullHigh <<= 1ULL;
+				uMantissa = mantissaDecimal.ullHigh >> (64ULL - RealTraits_t<V>::kMantissaWidth);
 			}
 
-			nRemainingSize -= tszDestinationEnd - tszPreviousEnd;
-			++tszFormat;
-			continue;
+			/*
+			 * apply rounding rules:
+			 * [GRS] guard (G), round (R), and sticky (S) bits
+			 *  000 -> NO ROUND
+			 *  010 -> NO ROUND
+			 *  100 -> NO ROUND (TIE)
+			 *  101 -> ROUND UP
+			 *  110 -> ROUND UP
+			 *  111 -> ROUND UP
+			 */
+			const std::uint32_t kGuardShift = 64U - RealTraits_t<V>::kMantissaWidth - 1U;
+			const bool bRoundUp = ((mantissaDecimal.ullHigh & (1ULL << kGuardShift)) != 0ULL && (mantissaDecimal.ullHigh & ((1ULL << kGuardShift) - 1ULL)) != 0ULL);
+			uMantissa = (uMantissa + bRoundUp) & RealTraits_t<V>::kMantissaMask;
+
+			// check for mantissa overflow
+			if (uMantissa == 0U && bRoundUp)
+				++iExponent;
+
+			// add bias to exponent
+			iExponent += RealTraits_t<V>::kExponentBias;
 		}
 
-		*tszDestinationEnd++ = *tszFormat++;
-		--nRemainingSize;
-	}
+		uBits = (static_cast<UIntType_t>(iExponent) << RealTraits_t<V>::kMantissaWidth) | uMantissa;
 
-	// check if the limit was reached before the entire string could be stored
-	if (nRemainingSize == 0U)
-		return 0U;
+		// the slow conversion uses only the leading digits and doesn't round exactly, so move its result to the nearest number by comparing all digits
+		if constexpr (std::is_same_v<V, float> || std::is_same_v<V, double>)
+		{
+			if (!std::is_constant_evaluated() && !bIsZero)
+			{
+				uBits = RoundDecimalToReal<V, bBounded>(tszDigitsBegin, tszSourceLast, iExponentLast, uBits);
+				*pnError = ((uBits == 0U || uBits == RealTraits_t<V>::kExponentMask) ? ERANGE : nPreviousError);
+			}
+		}
 
-	*tszDestinationEnd = '\0';
-	return nDestinationSize - nRemainingSize;
+		uBits |= uSign;
+		return std::bit_cast<V>(uBits);
+	}
 }
 
 /// convert the string to an integer number, alternative of 'atoi()', '_wtoi()', '_atoi64()', '_wtoi64()', 'atol()', '_wtol()', 'atoll()', '_wtoll()', 'strtol()', 'wcstol()', 'strtoll()', 'wcstoll()', '_strtoi64()', '_wcstoi64()', 'strtoul()', 'wcstoul()', 'strtoull()', 'wcstoull()'
@@ -1235,7 +3815,7 @@ std::size_t TimeToString(T* tszDestination, std::size_t nDestinationSize, const
 /// @param[out] pnError [optional] code of the conversion error, if any
 /// @remarks: converts @a`tszSourceBegin` string containing sequence of characters in form [whitespace][{+|-}][digits] that can be interpreted as a numeric value to specified integer type. stops reading at the first character that can't be recognized as part of number and store its position into @a`ptszSourceEnd`
 /// @returns: integer number converted from a string or 0 if no conversion could be performed
-template <typename V = int, typename T> requires (std::is_integral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+template <typename V = int, typename T> requires (DETAIL::IsIntegral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
 constexpr V StringToInteger(const T* tszSourceBegin, T** ptszSourceEnd = nullptr, int iBase = 0, int* pnError = nullptr)
 {
 	// set a local variable as error output if it's not set
@@ -1243,394 +3823,271 @@ constexpr V StringToInteger(const T* tszSourceBegin, T** ptszSourceEnd = nullptr
 	if (pnError == nullptr)
 		pnError = &nError;
 
-	if (iBase < 0 || iBase == 1 || iBase > kMaxNumberBase)
-	{
-		*pnError = EINVAL; // given number base is out of range
-		return 0;
-	}
-
-	const T* tszSourceCurrent = tszSourceBegin;
-
-	// strip off the leading blanks
-	while (IsSpace(static_cast<int>(*tszSourceCurrent)))
-		++tszSourceCurrent;
+	const T* tszSourceEnd;
+	const V result = DETAIL::ParseInteger<V, false, T>(tszSourceBegin, nullptr, &tszSourceEnd, iBase, pnError);
 
-	// check for a sign
-	const bool bPositive = ((*tszSourceCurrent == '+' || *tszSourceCurrent == '-') ? (*tszSourceCurrent++ == '+') : true);
-	constexpr bool bUnsigned = !std::numeric_limits<V>::is_signed;
+	if (ptszSourceEnd != nullptr)
+		*ptszSourceEnd = const_cast<T*>(tszSourceEnd);
 
-	// check if user provided exact number base
-	if (iBase > 0)
-	{
-		// strip 0x or 0X
-		if (iBase == 16 && *tszSourceCurrent == '0' && (tszSourceCurrent[1] | ('a' ^ 'A')) == 'x')
-			tszSourceCurrent += 2;
-	}
-	// otherwise try to determine base automatically
-	else if (*tszSourceCurrent == '0')
-	{
-		if ((*tszSourceCurrent++ | ('a' ^ 'A')) == 'x')
-		{
-			// a hexadecimal constant consists of the prefix 0x or 0X followed by a sequence of the decimal digits and the letters a (or A) through f (or F) with values 10 through 15 respectively (C standard 6.4.4.1)
-			iBase = 16;
-			++tszSourceCurrent;
-		}
-		else
-			// an octal constant consists of the prefix 0 optionally followed by a sequence of the digits 0 through 7 only (C standard 6.4.4.1)
-			iBase = 8;
-	}
-	else
-		// a decimal constant begins with a nonzero digit and consists of a sequence of decimal digits (C standard 6.4.4.1)
-		iBase = 10;
+	return result;
+}
 
-	constexpr std::uint64_t ullNegativeMax = (bUnsigned ? (std::numeric_limits<V>::max)() : (static_cast<std::uint64_t>((std::numeric_limits<V>::max)()) + 1ULL));
-	const std::uint64_t ullAbsoluteMax = (bPositive ? (std::numeric_limits<V>::max)() : ullNegativeMax);
-	const std::uint64_t ullAbsoluteMaxOfBase = ullAbsoluteMax / iBase;
+/// result of the bounded string to number conversion, alternative of 'std::from_chars_result'
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+struct CharsToNumberResult_t
+{
+	// pointer past the last parsed character, or the beginning of the string if no conversion could be performed
+	const T* tszEnd;
+	// code of the conversion error: EINVAL if no conversion could be performed, ERANGE if the number is out of range of the type, 0 otherwise
+	int nError;
+};
 
-	bool bIsNumber = false;
-	std::uint64_t ullResult = 0ULL;
+/// convert the bounded string to an integer number, alternative of 'std::from_chars()'
+/// @param[in] tszSourceBegin beginning of the string to convert value from
+/// @param[in] tszSourceEnd end of the string, that doesn't need to be null-terminated
+/// @param[out] value converted number, clamped to the range of its type on overflow, or left unchanged if no conversion could be performed
+/// @param[in] iBase number of digits used to represent number. value in range [2 .. 36] or 0 to automatically determine number base in range [2 .. 16]
+/// @remarks: accepts the same form as 'StringToInteger()', including the leading whitespaces, sign and base prefix, but never reads past @a`tszSourceEnd`
+/// @returns: pointer past the last parsed character and code of the conversion error, if any
+template <typename V, typename T> requires (DETAIL::IsIntegral_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+constexpr CharsToNumberResult_t<T> CharsToInteger(const T* tszSourceBegin, const T* tszSourceEnd, V& value, int iBase = 10)
+{
+	CharsToNumberResult_t<T> result = { tszSourceBegin, 0 };
+	const V parsedValue = DETAIL::ParseInteger<V, true>(tszSourceBegin, tszSourceEnd, &result.tszEnd, iBase, &result.nError);
 
-	for (bool bIsDigit, bIsAlpha = false; ((bIsDigit = IsDigit(static_cast<int>(*tszSourceCurrent)))) || ((bIsAlpha = IsAlpha(static_cast<int>(*tszSourceCurrent)))); ) // @note: double parenthesis to suppress warnings
+	if (result.tszEnd == tszSourceBegin)
 	{
-		int iCurrentDigit = 0;
-
-		if (bIsDigit)
-			iCurrentDigit = *tszSourceCurrent - '0';
-		else if (bIsAlpha)
-			iCurrentDigit = (*tszSourceCurrent | ('a' ^ 'A')) - 'a' + 0xA;
-
-		if (iCurrentDigit >= iBase)
-			break;
-
-		bIsNumber = true;
-		++tszSourceCurrent;
-
-		// if the number has already hit the maximum value for the current type then the result cannot change, but we still need to advance source to the end of the number
-		if (ullResult == ullAbsoluteMax)
-		{
-			*pnError = ERANGE; // numeric overflow
-			continue;
-		}
-
-		if (ullResult <= ullAbsoluteMaxOfBase)
-			ullResult *= iBase;
-		else
-		{
-			ullResult = ullAbsoluteMax;
-			*pnError = ERANGE; // numeric overflow
-		}
-
-		if (ullResult <= ullAbsoluteMax - iCurrentDigit)
-			ullResult += iCurrentDigit;
-		else
-		{
-			ullResult = ullAbsoluteMax;
-			*pnError = ERANGE; // numeric overflow
-		}
+		result.nError = EINVAL;
+		return result;
 	}
 
-	if (ptszSourceEnd != nullptr)
-		*ptszSourceEnd = const_cast<T*>(bIsNumber ? tszSourceCurrent : tszSourceBegin);
-
-	// clamp on overflow
-	if (*pnError == ERANGE)
-		return ((bPositive || bUnsigned) ? (std::numeric_limits<V>::max)() : (std::numeric_limits<V>::min)());
-
-	return (bPositive ? static_cast<V>(ullResult) : -static_cast<V>(ullResult));
+	value = parsedValue;
+	return result;
 }
 
 /// convert the string to a floating-point number, alternative of 'atof()', _wtof(), 'atod()', 'strtof()', 'strtod()'
 /// @param[in] tszSourceBegin string to convert value from
 /// @param[out] ptszSourceEnd [optional] pointer to the last scanned character during conversion
 /// @param[out] pnError [optional] code of the conversion error, if any
-/// @remarks: converts @a`tszSourceBegin` string containing sequence of characters in form [whitespace][{+|-}][digits][.digits][{e|E}[{+|-}]digits] that can be interpreted as a numeric value to specified floating-point type. stops reading at the first character that can't be recognized as part of number and store its position into @a`ptszSourceEnd`
+/// @remarks: converts @a`tszSourceBegin` string containing sequence of characters in form [whitespace][{+|-}][digits][.digits][{e|E}[{+|-}]digits], [whitespace][{+|-}]{0x|0X}[hexdigits][.hexdigits][{p|P}[{+|-}]digits], infinity or nan[(n-char-sequence)] that can be interpreted as a numeric value to specified floating-point type. stops reading at the first character that can't be recognized as part of number and store its position into @a`ptszSourceEnd`
 /// @returns: floating-point number converted from a string or 0.0 if no conversion could be performed
 template <typename V = float, typename T> requires (std::is_floating_point_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
 constexpr V StringToReal(const T* tszSourceBegin, T** ptszSourceEnd = nullptr, int* pnError = nullptr)
 {
-	using UIntType_t = typename RealTraits_t<V>::BitEquivalent_t;
-	UIntType_t uBits;
-
 	// set a local variable as error output if it's not set
 	int nError = 0;
 	if (pnError == nullptr)
 		pnError = &nError;
 
-	const T* tszSourceEnd = tszSourceBegin;
+	const T* tszSourceEnd;
+	const V result = DETAIL::ParseReal<V, false, T>(tszSourceBegin, nullptr, &tszSourceEnd, pnError);
 
-	// skip leading whitespaces
-	while (IsSpace(static_cast<int>(*tszSourceEnd)))
-		++tszSourceEnd;
-
-	// extract the sign
-	UIntType_t uSign = 0U;
-	if (*tszSourceEnd == '+')
-		++tszSourceEnd;
-	else if (*tszSourceEnd == '-')
-	{
-		uSign = RealTraits_t<V>::kSignMask;
-		++tszSourceEnd;
-	}
+	if (ptszSourceEnd != nullptr)
+		*ptszSourceEnd = const_cast<T*>(tszSourceEnd);
 
-	// check for NaN value
-	// @todo: we must also support nan(n-char-sequence)
-	if ((tszSourceEnd[0] | ('a' ^ 'A')) == 'n' && (tszSourceEnd[1] | ('a' ^ 'A')) == 'a' && (tszSourceEnd[2] | ('a' ^ 'A')) == 'n')
-	{
-		if (ptszSourceEnd != nullptr)
-		{
-			tszSourceEnd += 3;
-			*ptszSourceEnd = const_cast<T*>(tszSourceEnd);
-		}
+	return result;
+}
 
-		uBits = (uSign | RealTraits_t<V>::kExponentMask | RealTraits_t<V>::kQuietNanMask);
-		return std::bit_cast<V>(uBits);
-	}
+/// convert the bounded string to a floating-point number, alternative of 'std::from_chars()'
+/// @param[in] tszSourceBegin beginning of the string to convert value from
+/// @param[in] tszSourceEnd end of the string, that doesn't need to be null-terminated
+/// @param[out] value converted number, signed zero or infinity on underflow or overflow, or left unchanged if no conversion could be performed
+/// @remarks: accepts the same form as 'StringToReal()', including the leading whitespaces, sign and hexadecimal form with prefix, but never reads past @a`tszSourceEnd`
+/// @returns: pointer past the last parsed character and code of the conversion error, if any
+template <typename V, typename T> requires (std::is_floating_point_v<V> && (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>))
+constexpr CharsToNumberResult_t<T> CharsToReal(const T* tszSourceBegin, const T* tszSourceEnd, V& value)
+{
+	CharsToNumberResult_t<T> result = { tszSourceBegin, 0 };
+	const V parsedValue = DETAIL::ParseReal<V, true>(tszSourceBegin, tszSourceEnd, &result.tszEnd, &result.nError);
 
-	// check for infinity value
-	if ((tszSourceEnd[0] | ('a' ^ 'A')) == 'i' && (tszSourceEnd[1] | ('a' ^ 'A')) == 'n' && (tszSourceEnd[2] | ('a' ^ 'A')) == 'f')
+	if (result.tszEnd == tszSourceBegin)
 	{
-		// @test: tho C standard states that pointer to "inite" should be stored, we do also account it
-		if (ptszSourceEnd != nullptr)
-		{
-			tszSourceEnd += 3;
-			if ((tszSourceEnd[0] | ('a' ^ 'A')) == 'i' && (tszSourceEnd[1] | ('a' ^ 'A')) == 'n' && (tszSourceEnd[2] | ('a' ^ 'A')) == 'i' && (tszSourceEnd[3] | ('a' ^ 'A')) == 't' && (tszSourceEnd[4] | ('a' ^ 'A')) == 'y')
-				tszSourceEnd += 5;
-
-			*ptszSourceEnd = const_cast<T*>(tszSourceEnd);
-		}
-
-		uBits = (uSign | RealTraits_t<V>::kExponentMask);
-		return std::bit_cast<V>(uBits);
+		result.nError = EINVAL;
+		return result;
 	}
 
-	// skip leading zeros
-	while (*tszSourceEnd == '0')
-		++tszSourceEnd;
+	value = parsedValue;
+	return result;
+}
 
-	// max count of digits to parse, including excess digit for correct rounding
-	constexpr int kMaxPrecisionDigits = std::numeric_limits<double>::max_digits10 + 1;
+// type of the values in the column of delimited text
+enum EColumnType : std::uint8_t
+{
+	COLUMN_TYPE_SKIP = 0U, // field is not converted
+	COLUMN_TYPE_INT64, // decimal integer number stored as 'std::int64_t'
+	COLUMN_TYPE_DOUBLE, // floating-point number stored as 'double'
+	COLUMN_TYPE_FLOAT // floating-point number stored as 'float'
+};
 
-	int nDigitCount = 0;
-	int iExponentDecimal = 0;
-	BigInteger_t mantissaDecimal = { };
+/// destination of the converted column of delimited text
+struct Column_t
+{
+	// type of the column values
+	EColumnType nType;
+	// array of values of the column type with at least maximal row count elements, ignored for skipped columns
+	void* pValues;
+	// [optional] array of codes of the field conversion errors with at least maximal row count elements, ignored for skipped columns
+	int* pnErrors;
+};
 
-	// @todo: we must also support hexadecimal form
-	// extract integer part
-	while (IsDigit(static_cast<int>(*tszSourceEnd)))
+namespace DETAIL
+{
+	/// find the first delimiter or terminator character in the bounded string
+	/// @returns: pointer to the found character, or @a`tszSourceEnd` if there is none
+	template <typename T>
+	Q_INLINE inline const T* FindFieldEnd(const T* tszSource, const T* tszSourceEnd, const T tchDelimiter, const T tchTerminator)
 	{
-		if (++nDigitCount <= kMaxPrecisionDigits)
-			mantissaDecimal.ullLow = mantissaDecimal.ullLow * 10U + (*tszSourceEnd - '0');
-		else
-			++iExponentDecimal;
-
-		++tszSourceEnd;
-	}
+	#ifdef Q_ISA_SSE2
+		constexpr std::size_t nBlockLength = sizeof(__m128i) / sizeof(T);
 
-	// extract fractional part
-	if ((*tszSourceEnd | ('a' ^ 'A')) == 'e' || *tszSourceEnd == '.')
-	{
-		if (*tszSourceEnd == '.')
-			++tszSourceEnd;
+		const auto CompareEqual = [](const __m128i vecChars, const T tch)
+		{
+			if constexpr (sizeof(T) == 1U)
+				return ::_mm_cmpeq_epi8(vecChars, ::_mm_set1_epi8(static_cast<char>(tch)));
+			else if constexpr (sizeof(T) == 2U)
+				return ::_mm_cmpeq_epi16(vecChars, ::_mm_set1_epi16(static_cast<short>(tch)));
+			else
+				return ::_mm_cmpeq_epi32(vecChars, ::_mm_set1_epi32(static_cast<int>(tch)));
+		};
 
-		while (IsDigit(static_cast<int>(*tszSourceEnd)))
+		for (; static_cast<std::size_t>(tszSourceEnd - tszSource) >= nBlockLength; tszSource += nBlockLength)
 		{
-			if (++nDigitCount <= kMaxPrecisionDigits)
-			{
-				mantissaDecimal.ullLow = mantissaDecimal.ullLow * 10U + (*tszSourceEnd - '0');
-				--iExponentDecimal;
-			}
+			const __m128i vecChars = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(tszSource));
 
-			++tszSourceEnd;
+			// mask has a bit per byte, so the wide characters have a few bits each
+			if (const int iMask = ::_mm_movemask_epi8(::_mm_or_si128(CompareEqual(vecChars, tchDelimiter), CompareEqual(vecChars, tchTerminator))); iMask != 0)
+				return tszSource + std::countr_zero(static_cast<unsigned int>(iMask)) / sizeof(T);
 		}
-	}
-
-	// check if exponent is present
-	if ((*tszSourceEnd | ('a' ^ 'A')) == 'e')
-	{
-		++tszSourceEnd;
+	#endif
 
-		// extract exponent sign
-		bool bExponentSign = false;
-		if (*tszSourceEnd == '+')
-			++tszSourceEnd;
-		else if (*tszSourceEnd == '-')
+		for (; tszSource != tszSourceEnd; ++tszSource)
 		{
-			bExponentSign = true;
-			++tszSourceEnd;
+			if (*tszSource == tchDelimiter || *tszSource == tchTerminator)
+				break;
 		}
 
-		// extract exponent value
-		std::uint32_t uExponentValue = 0U;
-		while (IsDigit(static_cast<int>(*tszSourceEnd)))
-			uExponentValue = uExponentValue * 10U + (*tszSourceEnd++ - '0');
-
-		iExponentDecimal += bExponentSign ? -static_cast<int>(uExponentValue) : static_cast<int>(uExponentValue);
+		return tszSource;
 	}
 
-	if (ptszSourceEnd != nullptr)
-		*ptszSourceEnd = const_cast<T*>(tszSourceEnd);
-
-	// check for exponent underflow
-	if (iExponentDecimal + nDigitCount < (RealTraits_t<V>::kExponentDecimalMin + 1))
+	/// convert the field and store it to the column at the given row
+	/// @param[in] tszFieldEnd end of the field when @a`bBounded` is true, ignored otherwise
+	/// @param[out] ptszParsedEnd pointer past the last converted character, or @a`tszFieldBegin` if no conversion could be performed
+	/// @returns: code of the field conversion error, if any
+	template <bool bBounded, typename T>
+	Q_INLINE inline int ParseColumnField(const Column_t& column, const std::size_t nRow, const T* tszFieldBegin, const T* tszFieldEnd, const T** ptszParsedEnd)
 	{
-		*pnError = ERANGE;
+		int nError = 0;
+		switch (column.nType)
+		{
+		case COLUMN_TYPE_INT64:
+			static_cast<std::int64_t*>(column.pValues)[nRow] = ParseInteger<std::int64_t, bBounded, T>(tszFieldBegin, tszFieldEnd, ptszParsedEnd, 10, &nError);
+			break;
+		case COLUMN_TYPE_DOUBLE:
+			static_cast<double*>(column.pValues)[nRow] = ParseReal<double, bBounded, T>(tszFieldBegin, tszFieldEnd, ptszParsedEnd, &nError);
+			break;
+		case COLUMN_TYPE_FLOAT:
+			static_cast<float*>(column.pValues)[nRow] = ParseReal<float, bBounded, T>(tszFieldBegin, tszFieldEnd, ptszParsedEnd, &nError);
+			break;
+		default:
+			*ptszParsedEnd = tszFieldBegin;
+			break;
+		}
 
-		// signed zero
-		uBits = uSign;
-		return std::bit_cast<V>(uBits);
+		return nError;
 	}
+}
 
-	// check for exponent overflow
-	if (iExponentDecimal > (RealTraits_t<V>::kExponentDecimalMax + kMaxPrecisionDigits))
+/// convert the bounded delimited text, e.g. CSV, to the arrays of values column by column
+/// @param[in] tszSourceBegin beginning of the text to convert values from
+/// @param[in] tszSourceEnd end of the text, that doesn't need to be null-terminated
+/// @param[in] tchDelimiter character that separates the fields of a row
+/// @param[in] tchTerminator character that ends a row, when it's a newline the carriage return before it is ignored as well
+/// @param[in] arrColumns destinations of the columns, in order of the fields in a row
+/// @param[in] nMaxRowCount maximal count of rows to convert, that the column arrays can fit
+/// @param[out] ptszSourceEnd [optional] pointer to the beginning of the first row that hasn't been converted
+/// @remarks: each field is converted as with 'CharsToInteger()' in base 10 or 'CharsToReal()' and must contain the number only, optionally preceded by whitespaces. empty, missing and partially converted fields are stored as zero with EINVAL error code, extra fields of the row are ignored. when the separators can't be a part of number, the conversion stops at them, so the fields are converted in a single pass without bound checks, that may read past the end of the text but never crosses the page boundaries, and the separators are searched with SIMD only after the invalid or skipped fields
+/// @returns: count of converted rows
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+std::size_t CharsToColumns(const T* tszSourceBegin, const T* tszSourceEnd, const T tchDelimiter, const T tchTerminator, const Column_t* arrColumns, const std::size_t nColumnCount, const std::size_t nMaxRowCount, const T** ptszSourceEnd = nullptr)
+{
+	// @returns: true if the character may continue a number, in either decimal, hexadecimal, infinity or nan form
+	const auto IsNumberChar = [](const T tch)
 	{
-		*pnError = ERANGE;
-
-		// signed infinity
-		uBits = uSign | RealTraits_t<V>::kExponentMask;
-		return std::bit_cast<V>(uBits);
-	}
+		return (static_cast<std::make_unsigned_t<T>>(tch) > 0x7F || IsAlphaNum(static_cast<int>(tch)) || tch == '+' || tch == '-' || tch == '.' || tch == '(' || tch == ')' || tch == '_');
+	};
 
-	// convert decimal exponent into binary
-	int iExponent = 0;
-
-	// check if the number is true zero
-	if (mantissaDecimal.ullLow == 0ULL)
-	{
-		iExponent = RealTraits_t<V>::kExponentMin - 1;
-		mantissaDecimal.ullLow = 0ULL;
-	}
-	else
+	// the fields before the last separator are guaranteed to stop the conversion within the text
+	const T* tszSeparatorsEnd = tszSourceBegin;
+	if (!IsNumberChar(tchDelimiter) && !IsNumberChar(tchTerminator))
 	{
-		// normalize mantissa
-		// keep high 4 bits non-zero
-		std::uint8_t nLeadingZerosCount;
-		if (mantissaDecimal.ullHigh != 0ULL)
-			nLeadingZerosCount = static_cast<std::uint8_t>(std::countl_zero(mantissaDecimal.ullHigh)) - 4U;
-		else
-			nLeadingZerosCount = static_cast<std::uint8_t>(std::countl_zero(mantissaDecimal.ullLow)) + 60U;
-
-		mantissaDecimal.ShiftLeft(nLeadingZerosCount);
-		iExponent -= nLeadingZerosCount;
-
-		// take performed shift into account
-		iExponent += 123;
-
-		// @todo: normalization approach is robust but quite slow
-		// check for positive exponent
-		if (iExponentDecimal > 0)
+		for (tszSeparatorsEnd = tszSourceEnd; tszSeparatorsEnd != tszSourceBegin; --tszSeparatorsEnd)
 		{
-			do
-			{
-				mantissaDecimal.Multiply(10ULL);
-
-				// keep high 4 bits all zero
-				while ((mantissaDecimal.ullHigh >> 60ULL) != 0ULL)
-				{
-					mantissaDecimal.ShiftRight(1U);
-					++iExponent;
-				}
-			} while (--iExponentDecimal > 0);
+			if (tszSeparatorsEnd[-1] == tchDelimiter || tszSeparatorsEnd[-1] == tchTerminator)
+				break;
 		}
-		// otherwise check for negative exponent
-		else if (iExponentDecimal < 0)
+	}
+
+	std::size_t nRowCount = 0U;
+	for (; nRowCount < nMaxRowCount && tszSourceBegin < tszSourceEnd; ++nRowCount)
+	{
+		bool bIsRowEnd = false;
+		for (std::size_t i = 0U; i < nColumnCount; ++i)
 		{
-			do
+			const Column_t& column = arrColumns[i];
+			const T* tszFieldBegin = tszSourceBegin;
+			const T* tszFieldEnd = tszSourceBegin;
+			const T* tszParsedEnd = nullptr;
+			int nError = 0;
+
+			// missing fields are converted as the empty ones
+			if (!bIsRowEnd)
 			{
-				mantissaDecimal.Divide10();
+				// convert the field before its end is known, @note: the leading whitespaces are skipped by the conversion and may include the separators
+				if (column.nType != COLUMN_TYPE_SKIP && tszFieldBegin < tszSeparatorsEnd && !IsSpace(static_cast<int>(*tszFieldBegin)))
+					nError = DETAIL::ParseColumnField<false>(column, nRowCount, tszFieldBegin, static_cast<const T*>(nullptr), &tszParsedEnd);
 
-				if ((mantissaDecimal.ullHigh | mantissaDecimal.ullLow) != 0ULL)
-				{
-					// @todo: do use bsr/clz only when it's guaranteed to compile into appropriate instructions otherwise it will be less efficient
-					// keep high 4 bits non-zero
-#if 0
-					int nLeadingZerosCount;
-					if (mantissaDecimal.ullHigh != 0ULL)
-						nLeadingZerosCount = std::countl_zero(mantissaDecimal.ullHigh) - 4;
-					else
-						nLeadingZerosCount = std::countl_zero(mantissaDecimal.ullLow) + 60;
+				if (tszParsedEnd != nullptr && tszParsedEnd != tszFieldBegin && (*tszParsedEnd == tchDelimiter || *tszParsedEnd == tchTerminator))
+					tszFieldEnd = tszParsedEnd;
+				else
+					tszFieldEnd = DETAIL::FindFieldEnd((tszParsedEnd != nullptr ? tszParsedEnd : tszFieldBegin), tszSourceEnd, tchDelimiter, tchTerminator);
 
-					mantissaDecimal.ShiftLeft(nLeadingZerosCount);
-					iExponent -= nLeadingZerosCount;
-#else
-					while ((mantissaDecimal.ullHigh >> 60ULL) == 0ULL)
-					{
-						mantissaDecimal.ShiftLeft(1U);
-						--iExponent;
-					}
+				bIsRowEnd = (tszFieldEnd == tszSourceEnd || *tszFieldEnd == tchTerminator);
+				tszSourceBegin = (tszFieldEnd == tszSourceEnd ? tszFieldEnd : tszFieldEnd + 1);
 
-					mantissaDecimal.ShiftRight(1U);
-					++iExponent;
-#endif
-				}
-			} while (++iExponentDecimal < 0);
-		}
+				if (bIsRowEnd && tchTerminator == '\n' && tszFieldEnd != tszFieldBegin && tszFieldEnd[-1] == '\r')
+					--tszFieldEnd;
+			}
 
-		mantissaDecimal.ShiftLeft(4U);
-	}
+			if (column.nType == COLUMN_TYPE_SKIP)
+				continue;
 
-	// convert decimal mantissa into binary
-	UIntType_t uMantissa;
-	if (iExponent > RealTraits_t<V>::kExponentMax)
-	{
-		// infinity
-		iExponent = (1 << RealTraits_t<V>::kExponentWidth) - 1;
-		uMantissa = 0U;
+			if (tszParsedEnd == nullptr)
+				nError = DETAIL::ParseColumnField<true>(column, nRowCount, tszFieldBegin, tszFieldEnd, &tszParsedEnd);
 
-		*pnError = ERANGE;
-	}
-	else
-	{
-		// check if value is denormalized
-		if (iExponent < RealTraits_t<V>::kExponentMin)
-		{
-			// check for true zero
-			if ((mantissaDecimal.ullHigh | mantissaDecimal.ullLow) == 0ULL)
-				uMantissa = 0U;
-			// check for denormalized exponent underflow
-			else if (iExponent < RealTraits_t<V>::kExponentDenormalMin - 1)
-			{
-				uMantissa = 0U;
-				*pnError = ERANGE;
-			}
-			else
+			// empty field, or field with trailing characters
+			if (tszParsedEnd != tszFieldEnd || tszFieldBegin == tszFieldEnd)
 			{
-				mantissaDecimal.ullHigh >>= (-RealTraits_t<V>::kExponentBias - iExponent);
-				uMantissa = mantissaDecimal.ullHigh >> (64ULL - RealTraits_t<V>::kMantissaWidth);
+				// conversion of the empty field stores zero
+				DETAIL::ParseColumnField<true>(column, nRowCount, tszFieldEnd, tszFieldEnd, &tszParsedEnd);
+				nError = EINVAL;
 			}
 
-			iExponent = -RealTraits_t<V>::kExponentMax;
+			if (column.pnErrors != nullptr)
+				column.pnErrors[nRowCount] = nError;
 		}
-		// otherwise value is normalized
-		else
+
+		// skip the extra fields
+		if (!bIsRowEnd)
 		{
-			// set implicit bit
-			mantissaDecimal.ullHigh <<= 1ULL;
-			uMantissa = mantissaDecimal.ullHigh >> (64ULL - RealTraits_t<V>::kMantissaWidth);
+			tszSourceBegin = DETAIL::FindFieldEnd(tszSourceBegin, tszSourceEnd, tchTerminator, tchTerminator);
+			if (tszSourceBegin != tszSourceEnd)
+				++tszSourceBegin;
 		}
-
-		/*
-		 * apply rounding rules:
-		 * [GRS] guard (G), round (R), and sticky (S) bits
-		 *  000 -> NO ROUND
-		 *  010 -> NO ROUND
-		 *  100 -> NO ROUND (TIE)
-		 *  101 -> ROUND UP
-		 *  110 -> ROUND UP
-		 *  111 -> ROUND UP
-		 */
-		const std::uint32_t kGuardShift = 64U - RealTraits_t<V>::kMantissaWidth - 1U;
-		const bool bRoundUp = ((mantissaDecimal.ullHigh & (1ULL << kGuardShift)) != 0ULL && (mantissaDecimal.ullHigh & ((1ULL << kGuardShift) - 1ULL)) != 0ULL);
-		uMantissa = (uMantissa + bRoundUp) & RealTraits_t<V>::kMantissaMask;
-
-		// check for mantissa overflow
-		if (uMantissa == 0U && bRoundUp)
-			++iExponent;
-
-		// add bias to exponent
-		iExponent += RealTraits_t<V>::kExponentBias;
 	}
 
-	uBits = static_cast<UIntType_t>(uSign) | (static_cast<UIntType_t>(iExponent) << RealTraits_t<V>::kMantissaWidth) | uMantissa;
-	return std::bit_cast<V>(uBits);
+	if (ptszSourceEnd != nullptr)
+		*ptszSourceEnd = tszSourceBegin;
+
+	return nRowCount;
 }
 #endif
@@ -0,0 +1,1451 @@
+#ifndef Q_CRT_STRING_FORMAT_IMPLEMENTATION
+#define Q_CRT_STRING_FORMAT_IMPLEMENTATION
+// @note: format strings are compiled to the fixed sequence of conversion operations at compile time, so at run time only the arguments are converted and the literal text between them is copied
+
+namespace DETAIL
+{
+	enum EFormatFlags_t : std::uint8_t
+	{
+		FORMAT_FLAG_LEFT = 0x01, // '-', justify the converted value to the left of the field
+		FORMAT_FLAG_SIGN = 0x02, // '+', always begin the signed conversion with a sign
+		FORMAT_FLAG_SPACE = 0x04, // ' ', begin the non-negative signed conversion with a space
+		FORMAT_FLAG_ALTERNATIVE = 0x08, // '#', use the alternative form of the conversion
+		FORMAT_FLAG_ZERO = 0x10, // '0', pad the numeric conversion with leading zeros instead of spaces
+		FORMAT_FLAG_UPPER = 0x20, // conversion specifier is uppercase
+		FORMAT_FLAG_WIDTH_ARGUMENT = 0x40, // '*', field width is given by the preceding argument
+		FORMAT_FLAG_PRECISION_ARGUMENT = 0x80 // '.*', precision is given by the preceding argument
+	};
+
+	enum EFormatConversion : std::uint8_t
+	{
+		FORMAT_CONVERSION_NONE = 0U, // only the literal text is written, used for the text after the last conversion
+		FORMAT_CONVERSION_SIGNED, // '%d', '%i'
+		FORMAT_CONVERSION_UNSIGNED, // '%u'
+		FORMAT_CONVERSION_OCTAL, // '%o'
+		FORMAT_CONVERSION_HEXADECIMAL, // '%x', '%X'
+		FORMAT_CONVERSION_CHARACTER, // '%c'
+		FORMAT_CONVERSION_STRING, // '%s'
+		FORMAT_CONVERSION_POINTER, // '%p'
+		FORMAT_CONVERSION_FIXED, // '%f', '%F'
+		FORMAT_CONVERSION_SCIENTIFIC, // '%e', '%E'
+		FORMAT_CONVERSION_GENERAL // '%g', '%G'
+	};
+
+	enum EFormatLength : std::uint8_t
+	{
+		FORMAT_LENGTH_NONE = 0U, // type of the argument itself
+		FORMAT_LENGTH_CHAR, // 'hh'
+		FORMAT_LENGTH_SHORT, // 'h'
+		FORMAT_LENGTH_LONG, // 'l'
+		FORMAT_LENGTH_LONG_LONG, // 'll'
+		FORMAT_LENGTH_INTMAX, // 'j'
+		FORMAT_LENGTH_SIZE, // 'z'
+		FORMAT_LENGTH_PTRDIFF, // 't'
+		FORMAT_LENGTH_LONG_DOUBLE // 'L'
+	};
+
+	// purpose of the argument in the compiled format
+	enum EFormatArgument : std::uint8_t
+	{
+		FORMAT_ARGUMENT_VALUE = 0U, // argument is converted by the next conversion operation
+		FORMAT_ARGUMENT_WIDTH, // argument is the field width of the next conversion operation
+		FORMAT_ARGUMENT_PRECISION // argument is the precision of the next conversion operation
+	};
+
+	// category of the argument type, that determines which conversions are applicable to it
+	enum EFormatArgumentType : std::uint8_t
+	{
+		FORMAT_ARGUMENT_TYPE_UNSUPPORTED = 0U,
+		FORMAT_ARGUMENT_TYPE_INTEGER, // integral or enumeration type
+		FORMAT_ARGUMENT_TYPE_REAL, // 'float' or 'double'
+		FORMAT_ARGUMENT_TYPE_STRING, // pointer to the characters of the format string type
+		FORMAT_ARGUMENT_TYPE_POINTER // any other pointer
+	};
+
+	struct FormatOperation_t
+	{
+		// offset of the literal text preceding the conversion in the format string
+		std::uint32_t nLiteralOffset = 0U;
+		// length of the literal text preceding the conversion, including the escaped percent signs
+		std::uint32_t nLiteralLength = 0U;
+		// minimal width of the field
+		int iWidth = 0;
+		// precision of the conversion, or -1 if it's omitted
+		int iPrecision = -1;
+		// combination of 'EFormatFlags_t'
+		std::uint8_t nFlags = 0U;
+		EFormatConversion nConversion = FORMAT_CONVERSION_NONE;
+		EFormatLength nLength = FORMAT_LENGTH_NONE;
+		// whether the literal text contains escaped percent signs "%%", that are written as a single one
+		bool bLiteralEscaped = false;
+	};
+
+	template <typename T, typename V>
+	consteval EFormatArgumentType GetFormatArgumentType()
+	{
+		using ArgumentType_t = std::remove_cv_t<std::decay_t<V>>;
+
+		if constexpr (std::is_integral_v<ArgumentType_t> || std::is_enum_v<ArgumentType_t>)
+			return FORMAT_ARGUMENT_TYPE_INTEGER;
+		else if constexpr (std::is_same_v<ArgumentType_t, float> || std::is_same_v<ArgumentType_t, double>)
+			return FORMAT_ARGUMENT_TYPE_REAL;
+		else if constexpr (std::is_same_v<ArgumentType_t, const T*> || std::is_same_v<ArgumentType_t, T*>)
+			return FORMAT_ARGUMENT_TYPE_STRING;
+		else if constexpr (std::is_pointer_v<ArgumentType_t> || std::is_null_pointer_v<ArgumentType_t>)
+			return FORMAT_ARGUMENT_TYPE_POINTER;
+		else
+			return FORMAT_ARGUMENT_TYPE_UNSUPPORTED;
+	}
+
+	// it isn't a constant expression, so calling it during the format string compilation fails the compilation and shows the given message
+	inline void FormatStringError([[maybe_unused]] const char* szMessage) { }
+}
+
+/// format string compiled to the sequence of conversion operations
+/// @remarks: constructed only at compile time from the string literal, that is checked against the given argument types. conversion specification has the form '%[flags][width][.precision][length]specifier' as of 'printf()', where flags are any of "-+ #0", width and precision are either the decimal numbers or '*' to take them from the preceding 'int' argument, length is any of "hh", "h", "l", "ll", "j", "z", "t", "L" and specifier is any of "diouxXcspfFeEgG%". with the length modifier, integer argument is converted to the modified type before the conversion, otherwise its own type is used instead of the promoted one. "%s" and "%c" take the strings and characters of the format string type, regardless of the length modifier
+template <typename T, typename... A> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+struct FormatString_t
+{
+	template <std::size_t nFormatSize>
+	consteval FormatString_t(const T(&tszFormatSource)[nFormatSize]) :
+		tszFormat(tszFormatSource)
+	{
+		constexpr DETAIL::EFormatArgumentType arrArgumentTypes[sizeof...(A) + 1U] = { DETAIL::GetFormatArgumentType<T, A>()..., DETAIL::FORMAT_ARGUMENT_TYPE_UNSUPPORTED };
+
+		std::size_t nFormatLength = 0U;
+		while (nFormatLength < nFormatSize && tszFormatSource[nFormatLength] != '\0')
+			++nFormatLength;
+
+		// @returns: character at the given position of the format string, or null if it's past the end
+		const auto GetCharacter = [&tszFormatSource, nFormatLength](const std::size_t nPosition) -> T
+		{
+			return (nPosition < nFormatLength ? tszFormatSource[nPosition] : '\0');
+		};
+
+		std::size_t nArgumentCount = 0U;
+		// @returns: argument type of the next argument consumed by the conversion specification
+		const auto ConsumeArgument = [this, &arrArgumentTypes, &nArgumentCount](const DETAIL::EFormatArgument nPurpose) -> DETAIL::EFormatArgumentType
+		{
+			if (nArgumentCount == sizeof...(A))
+			{
+				DETAIL::FormatStringError("too few arguments for the format string");
+				return DETAIL::FORMAT_ARGUMENT_TYPE_UNSUPPORTED;
+			}
+
+			arrArgumentPurposes[nArgumentCount] = nPurpose;
+			return arrArgumentTypes[nArgumentCount++];
+		};
+
+		// @returns: decimal number of the field width or precision, parsed starting at the given position
+		const auto ParseNumber = [&GetCharacter](std::size_t& nPosition) -> int
+		{
+			int iNumber = 0;
+			for (T tchCurrent = GetCharacter(nPosition); tchCurrent >= '0' && tchCurrent <= '9'; tchCurrent = GetCharacter(++nPosition))
+			{
+				if (iNumber > (std::numeric_limits<int>::max() - 9) / 10)
+					DETAIL::FormatStringError("field width or precision is too large");
+
+				iNumber = iNumber * 10 + static_cast<int>(tchCurrent - '0');
+			}
+			return iNumber;
+		};
+
+		std::size_t nOperationCount = 0U;
+		std::size_t nLiteralBegin = 0U;
+		bool bLiteralEscaped = false;
+
+		for (std::size_t nPosition = 0U; nPosition < nFormatLength;)
+		{
+			if (tszFormatSource[nPosition] != '%')
+			{
+				++nPosition;
+				continue;
+			}
+
+			// escaped percent sign is a part of the literal text
+			if (GetCharacter(nPosition + 1U) == '%')
+			{
+				bLiteralEscaped = true;
+				nPosition += 2U;
+				continue;
+			}
+
+			DETAIL::FormatOperation_t operation;
+			operation.nLiteralOffset = static_cast<std::uint32_t>(nLiteralBegin);
+			operation.nLiteralLength = static_cast<std::uint32_t>(nPosition - nLiteralBegin);
+			operation.bLiteralEscaped = bLiteralEscaped;
+			++nPosition;
+
+			// parse flags
+			for (bool bIsFlag = true; bIsFlag; )
+			{
+				switch (GetCharacter(nPosition))
+				{
+				case '-':
+					operation.nFlags |= DETAIL::FORMAT_FLAG_LEFT;
+					break;
+				case '+':
+					operation.nFlags |= DETAIL::FORMAT_FLAG_SIGN;
+					break;
+				case ' ':
+					operation.nFlags |= DETAIL::FORMAT_FLAG_SPACE;
+					break;
+				case '#':
+					operation.nFlags |= DETAIL::FORMAT_FLAG_ALTERNATIVE;
+					break;
+				case '0':
+					operation.nFlags |= DETAIL::FORMAT_FLAG_ZERO;
+					break;
+				default:
+					bIsFlag = false;
+					continue;
+				}
+
+				++nPosition;
+			}
+
+			// parse field width
+			if (GetCharacter(nPosition) == '*')
+			{
+				if (ConsumeArgument(DETAIL::FORMAT_ARGUMENT_WIDTH) != DETAIL::FORMAT_ARGUMENT_TYPE_INTEGER)
+					DETAIL::FormatStringError("field width argument must be of integer type");
+
+				operation.nFlags |= DETAIL::FORMAT_FLAG_WIDTH_ARGUMENT;
+				++nPosition;
+			}
+			else
+				operation.iWidth = ParseNumber(nPosition);
+
+			// parse precision, that is zero when only the period is specified
+			if (GetCharacter(nPosition) == '.')
+			{
+				if (GetCharacter(++nPosition) == '*')
+				{
+					if (ConsumeArgument(DETAIL::FORMAT_ARGUMENT_PRECISION) != DETAIL::FORMAT_ARGUMENT_TYPE_INTEGER)
+						DETAIL::FormatStringError("precision argument must be of integer type");
+
+					operation.nFlags |= DETAIL::FORMAT_FLAG_PRECISION_ARGUMENT;
+					++nPosition;
+				}
+				else
+					operation.iPrecision = ParseNumber(nPosition);
+			}
+
+			// parse length modifier
+			switch (GetCharacter(nPosition))
+			{
+			case 'h':
+				operation.nLength = (GetCharacter(nPosition + 1U) == 'h' ? DETAIL::FORMAT_LENGTH_CHAR : DETAIL::FORMAT_LENGTH_SHORT);
+				break;
+			case 'l':
+				operation.nLength = (GetCharacter(nPosition + 1U) == 'l' ? DETAIL::FORMAT_LENGTH_LONG_LONG : DETAIL::FORMAT_LENGTH_LONG);
+				break;
+			case 'j':
+				operation.nLength = DETAIL::FORMAT_LENGTH_INTMAX;
+				break;
+			case 'z':
+				operation.nLength = DETAIL::FORMAT_LENGTH_SIZE;
+				break;
+			case 't':
+				operation.nLength = DETAIL::FORMAT_LENGTH_PTRDIFF;
+				break;
+			case 'L':
+				operation.nLength = DETAIL::FORMAT_LENGTH_LONG_DOUBLE;
+				break;
+			default:
+				break;
+			}
+
+			if (operation.nLength == DETAIL::FORMAT_LENGTH_CHAR || operation.nLength == DETAIL::FORMAT_LENGTH_LONG_LONG)
+				nPosition += 2U;
+			else if (operation.nLength != DETAIL::FORMAT_LENGTH_NONE)
+				++nPosition;
+
+			// parse conversion specifier
+			const T tchSpecifier = GetCharacter(nPosition++);
+			if (tchSpecifier == 'X' || tchSpecifier == 'F' || tchSpecifier == 'E' || tchSpecifier == 'G')
+				operation.nFlags |= DETAIL::FORMAT_FLAG_UPPER;
+
+			DETAIL::EFormatArgumentType nExpectedType = DETAIL::FORMAT_ARGUMENT_TYPE_INTEGER;
+			switch (tchSpecifier)
+			{
+			case 'd':
+			case 'i':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_SIGNED;
+				break;
+			case 'u':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_UNSIGNED;
+				break;
+			case 'o':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_OCTAL;
+				break;
+			case 'x':
+			case 'X':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_HEXADECIMAL;
+				break;
+			case 'c':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_CHARACTER;
+				break;
+			case 's':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_STRING;
+				nExpectedType = DETAIL::FORMAT_ARGUMENT_TYPE_STRING;
+				break;
+			case 'p':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_POINTER;
+				nExpectedType = DETAIL::FORMAT_ARGUMENT_TYPE_POINTER;
+				break;
+			case 'f':
+			case 'F':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_FIXED;
+				nExpectedType = DETAIL::FORMAT_ARGUMENT_TYPE_REAL;
+				break;
+			case 'e':
+			case 'E':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_SCIENTIFIC;
+				nExpectedType = DETAIL::FORMAT_ARGUMENT_TYPE_REAL;
+				break;
+			case 'g':
+			case 'G':
+				operation.nConversion = DETAIL::FORMAT_CONVERSION_GENERAL;
+				nExpectedType = DETAIL::FORMAT_ARGUMENT_TYPE_REAL;
+				break;
+			case 'a':
+			case 'A':
+				DETAIL::FormatStringError("hexadecimal floating-point conversion is not supported");
+				break;
+			case 'n':
+				DETAIL::FormatStringError("'%n' conversion is not supported");
+				break;
+			case '%':
+				DETAIL::FormatStringError("escaped percent sign can't have flags, width, precision or length");
+				break;
+			case '\0':
+				DETAIL::FormatStringError("incomplete conversion specification at the end of the format string");
+				break;
+			default:
+				DETAIL::FormatStringError("unknown conversion specifier");
+				break;
+			}
+
+			// check the modifiers that are undefined for the conversion
+			const bool bIsInteger = (operation.nConversion >= DETAIL::FORMAT_CONVERSION_SIGNED && operation.nConversion <= DETAIL::FORMAT_CONVERSION_HEXADECIMAL);
+			const bool bIsReal = (nExpectedType == DETAIL::FORMAT_ARGUMENT_TYPE_REAL);
+
+			if (bIsInteger && operation.nLength == DETAIL::FORMAT_LENGTH_LONG_DOUBLE)
+				DETAIL::FormatStringError("'L' length modifier is applicable only to floating-point conversions");
+			else if (bIsReal && operation.nLength != DETAIL::FORMAT_LENGTH_NONE && operation.nLength != DETAIL::FORMAT_LENGTH_LONG && operation.nLength != DETAIL::FORMAT_LENGTH_LONG_DOUBLE)
+				DETAIL::FormatStringError("length modifier is not applicable to floating-point conversions");
+			else if (!bIsInteger && !bIsReal && operation.nLength != DETAIL::FORMAT_LENGTH_NONE && !(operation.nLength == DETAIL::FORMAT_LENGTH_LONG && operation.nConversion != DETAIL::FORMAT_CONVERSION_POINTER))
+				DETAIL::FormatStringError("length modifier is not applicable to the conversion");
+
+			if ((operation.nFlags & DETAIL::FORMAT_FLAG_ALTERNATIVE) != 0U && !bIsReal && operation.nConversion != DETAIL::FORMAT_CONVERSION_OCTAL && operation.nConversion != DETAIL::FORMAT_CONVERSION_HEXADECIMAL)
+				DETAIL::FormatStringError("'#' flag is applicable only to octal, hexadecimal and floating-point conversions");
+
+			if (!bIsInteger && !bIsReal)
+			{
+				if ((operation.nFlags & (DETAIL::FORMAT_FLAG_SIGN | DETAIL::FORMAT_FLAG_SPACE | DETAIL::FORMAT_FLAG_ZERO)) != 0U)
+					DETAIL::FormatStringError("'+', ' ' and '0' flags are applicable only to numeric conversions");
+
+				if (operation.nConversion != DETAIL::FORMAT_CONVERSION_STRING && (operation.iPrecision >= 0 || (operation.nFlags & DETAIL::FORMAT_FLAG_PRECISION_ARGUMENT) != 0U))
+					DETAIL::FormatStringError("precision is not applicable to the conversion");
+			}
+
+			// check the type of the converted argument, pointers to characters can also be printed as addresses
+			if (const DETAIL::EFormatArgumentType nArgumentType = ConsumeArgument(DETAIL::FORMAT_ARGUMENT_VALUE); nArgumentType != nExpectedType && !(nExpectedType == DETAIL::FORMAT_ARGUMENT_TYPE_POINTER && nArgumentType == DETAIL::FORMAT_ARGUMENT_TYPE_STRING))
+				DETAIL::FormatStringError("type of the argument doesn't match the conversion specifier");
+
+			arrOperations[nOperationCount++] = operation;
+			nLiteralBegin = nPosition;
+			bLiteralEscaped = false;
+		}
+
+		if (nArgumentCount != sizeof...(A))
+			DETAIL::FormatStringError("too many arguments for the format string");
+
+		// the last operation only writes the literal text after the last conversion
+		DETAIL::FormatOperation_t& operationLast = arrOperations[nOperationCount];
+		operationLast.nLiteralOffset = static_cast<std::uint32_t>(nLiteralBegin);
+		operationLast.nLiteralLength = static_cast<std::uint32_t>(nFormatLength - nLiteralBegin);
+		operationLast.bLiteralEscaped = bLiteralEscaped;
+	}
+
+	// source format string
+	const T* tszFormat = nullptr;
+	// conversion operations in the order of the arguments, followed by the operation with the trailing literal text
+	DETAIL::FormatOperation_t arrOperations[sizeof...(A) + 1U] = { };
+	// purpose of each argument
+	DETAIL::EFormatArgument arrArgumentPurposes[sizeof...(A) + 1U] = { };
+};
+
+namespace DETAIL
+{
+	/// @returns: pointer to the @a`tszDestination` advanced by @a`nCount`
+	template <typename T>
+	Q_INLINE inline T* CopyFormatCharacters(T* tszDestination, const T* tszSource, const std::size_t nCount)
+	{
+		if constexpr (std::is_same_v<T, char>)
+			return static_cast<T*>(MemoryCopy(tszDestination, tszSource, nCount));
+		else
+			return MemoryCopyW(tszDestination, tszSource, nCount);
+	}
+
+	/// @returns: pointer to the @a`tszDestination` advanced by @a`nCount`
+	template <typename T>
+	Q_INLINE inline T* FillFormatCharacters(T* tszDestination, const T tchFill, const std::size_t nCount)
+	{
+		if constexpr (std::is_same_v<T, char>)
+			return static_cast<T*>(MemorySet(tszDestination, static_cast<std::uint8_t>(tchFill), nCount));
+		else
+			return MemorySetW(tszDestination, tchFill, nCount);
+	}
+
+	/// formatted output writer into the character buffer, that counts but discards the characters that doesn't fit
+	template <typename T>
+	struct FormatBufferWriter_t
+	{
+		Q_INLINE inline void Write(const T* tszSource, const std::size_t nLength)
+		{
+			const std::size_t nWriteLength = Min(nLength, nRemainingSize);
+			tszDestination = CopyFormatCharacters(tszDestination, tszSource, nWriteLength);
+			nRemainingSize -= nWriteLength;
+			nCount += nLength;
+		}
+
+		Q_INLINE inline void Fill(const T tchFill, const std::size_t nLength)
+		{
+			const std::size_t nWriteLength = Min(nLength, nRemainingSize);
+			tszDestination = FillFormatCharacters(tszDestination, tchFill, nWriteLength);
+			nRemainingSize -= nWriteLength;
+			nCount += nLength;
+		}
+
+		// current position in the buffer
+		T* tszDestination;
+		// count of the characters that can be written yet, not including the terminating null
+		std::size_t nRemainingSize;
+		// count of all characters passed to the writer, including the discarded ones
+		std::size_t nCount = 0U;
+	};
+
+	/// formatted output writer that only counts the characters
+	template <typename T>
+	struct FormatCountWriter_t
+	{
+		Q_INLINE inline void Write([[maybe_unused]] const T* tszSource, const std::size_t nLength)
+		{
+			nCount += nLength;
+		}
+
+		Q_INLINE inline void Fill([[maybe_unused]] const T tchFill, const std::size_t nLength)
+		{
+			nCount += nLength;
+		}
+
+		std::size_t nCount = 0U;
+	};
+
+	/// write the literal text preceding the conversion
+	template <typename W, typename T>
+	Q_INLINE inline void WriteFormatLiteral(W& writer, const T* tszFormat, const FormatOperation_t& operation)
+	{
+		const T* tszLiteral = tszFormat + operation.nLiteralOffset;
+		const T* tszLiteralEnd = tszLiteral + operation.nLiteralLength;
+
+		if (!operation.bLiteralEscaped)
+		{
+			writer.Write(tszLiteral, operation.nLiteralLength);
+			return;
+		}
+
+		// every percent sign of the literal text is known to be the first of the escaped pair
+		while (tszLiteral < tszLiteralEnd)
+		{
+			const T* tszChunkEnd = tszLiteral;
+			while (tszChunkEnd < tszLiteralEnd && *tszChunkEnd != '%')
+				++tszChunkEnd;
+
+			if (tszChunkEnd < tszLiteralEnd)
+			{
+				writer.Write(tszLiteral, static_cast<std::size_t>(tszChunkEnd - tszLiteral) + 1U);
+				tszLiteral = tszChunkEnd + 2;
+			}
+			else
+			{
+				writer.Write(tszLiteral, static_cast<std::size_t>(tszChunkEnd - tszLiteral));
+				tszLiteral = tszChunkEnd;
+			}
+		}
+	}
+
+	/// write the converted value justified within the field
+	/// @param[in] tszPrefix sign or base prefix of the number, that precedes the padding zeros
+	/// @param[in] nZeroCount count of the zeros between the prefix and the body, not including the field padding
+	/// @param[in] fnWriteBody callable that writes exactly @a`nBodyLength` characters of the converted value
+	template <typename W, typename T, typename F>
+	Q_INLINE inline void WriteFormatField(W& writer, const std::uint8_t nFlags, const int iWidth, const T* tszPrefix, const std::size_t nPrefixLength, const std::size_t nZeroCount, const std::size_t nBodyLength, F&& fnWriteBody)
+	{
+		const std::size_t nLength = nPrefixLength + nZeroCount + nBodyLength;
+		const std::size_t nPaddingCount = (static_cast<std::size_t>(iWidth) > nLength ? static_cast<std::size_t>(iWidth) - nLength : 0U);
+
+		if ((nFlags & FORMAT_FLAG_LEFT) != 0U)
+		{
+			writer.Write(tszPrefix, nPrefixLength);
+			writer.Fill('0', nZeroCount);
+			fnWriteBody();
+			writer.Fill(' ', nPaddingCount);
+		}
+		else if ((nFlags & FORMAT_FLAG_ZERO) != 0U)
+		{
+			writer.Write(tszPrefix, nPrefixLength);
+			writer.Fill('0', nZeroCount + nPaddingCount);
+			fnWriteBody();
+		}
+		else
+		{
+			writer.Fill(' ', nPaddingCount);
+			writer.Write(tszPrefix, nPrefixLength);
+			writer.Fill('0', nZeroCount);
+			fnWriteBody();
+		}
+	}
+
+	/// write the integer number with the integer conversion
+	template <typename W, typename T, typename V>
+	void WriteFormatInteger(W& writer, const EFormatConversion nConversion, const EFormatLength nLength, std::uint8_t nFlags, const int iWidth, const int iPrecision, const V value)
+	{
+		using UnsignedType_t = std::conditional_t<(sizeof(V) > sizeof(std::uint64_t)), std::make_unsigned_t<V>, std::uint64_t>;
+
+		bool bIsNegative = false;
+		UnsignedType_t uMagnitude;
+
+		// convert the value to the type of the length modifier as it would be read by 'printf()'
+		const auto ConvertValue = [&]<typename C>()
+		{
+			if (nConversion == FORMAT_CONVERSION_SIGNED)
+			{
+				const auto signedValue = static_cast<std::make_signed_t<C>>(value);
+				bIsNegative = (signedValue < 0);
+				uMagnitude = (bIsNegative ? static_cast<UnsignedType_t>(0U) - static_cast<UnsignedType_t>(signedValue) : static_cast<UnsignedType_t>(signedValue));
+			}
+			else
+				uMagnitude = static_cast<std::make_unsigned_t<C>>(value);
+		};
+
+		switch (nLength)
+		{
+		case FORMAT_LENGTH_CHAR:
+			ConvertValue.template operator()<char>();
+			break;
+		case FORMAT_LENGTH_SHORT:
+			ConvertValue.template operator()<short>();
+			break;
+		case FORMAT_LENGTH_LONG:
+			ConvertValue.template operator()<long>();
+			break;
+		case FORMAT_LENGTH_LONG_LONG:
+			ConvertValue.template operator()<long long>();
+			break;
+		case FORMAT_LENGTH_INTMAX:
+			ConvertValue.template operator()<std::intmax_t>();
+			break;
+		case FORMAT_LENGTH_SIZE:
+			ConvertValue.template operator()<std::size_t>();
+			break;
+		case FORMAT_LENGTH_PTRDIFF:
+			ConvertValue.template operator()<std::ptrdiff_t>();
+			break;
+		default:
+			ConvertValue.template operator()<V>();
+			break;
+		}
+
+		// octal notation is the longest one
+		T arrBuffer[IntegerToString_t<UnsignedType_t, 8U>::MaxCount()];
+		T* tszDigitsBegin = arrBuffer;
+		T* tszDigitsEnd = arrBuffer;
+
+		// zero value with zero precision has no digits
+		if (uMagnitude != 0U || iPrecision != 0)
+		{
+			if (nConversion == FORMAT_CONVERSION_OCTAL || nConversion == FORMAT_CONVERSION_HEXADECIMAL)
+			{
+				const char* szDigits = ((nFlags & FORMAT_FLAG_UPPER) != 0U ? "0123456789ABCDEF" : "0123456789abcdef");
+				const unsigned int uShift = (nConversion == FORMAT_CONVERSION_OCTAL ? 3U : 4U);
+				const unsigned int uMask = (1U << uShift) - 1U;
+
+				tszDigitsBegin = tszDigitsEnd = arrBuffer + sizeof(arrBuffer) / sizeof(T);
+				UnsignedType_t uRemaining = uMagnitude;
+				do
+				{
+					*--tszDigitsBegin = static_cast<T>(szDigits[static_cast<unsigned int>(uRemaining) & uMask]);
+					uRemaining >>= uShift;
+				} while (uRemaining != 0U);
+			}
+			else
+				tszDigitsEnd = IntegerToChars(uMagnitude, arrBuffer);
+		}
+
+		const std::size_t nDigitCount = static_cast<std::size_t>(tszDigitsEnd - tszDigitsBegin);
+		std::size_t nZeroCount = (iPrecision > 0 && static_cast<std::size_t>(iPrecision) > nDigitCount ? static_cast<std::size_t>(iPrecision) - nDigitCount : 0U);
+
+		T arrPrefix[2];
+		std::size_t nPrefixLength = 0U;
+
+		if (nConversion == FORMAT_CONVERSION_SIGNED)
+		{
+			if (bIsNegative)
+				arrPrefix[nPrefixLength++] = '-';
+			else if ((nFlags & FORMAT_FLAG_SIGN) != 0U)
+				arrPrefix[nPrefixLength++] = '+';
+			else if ((nFlags & FORMAT_FLAG_SPACE) != 0U)
+				arrPrefix[nPrefixLength++] = ' ';
+		}
+		else if ((nFlags & FORMAT_FLAG_ALTERNATIVE) != 0U)
+		{
+			// alternative form of the octal conversion begins with zero, and of the hexadecimal one with the base prefix if the value is nonzero
+			if (nConversion == FORMAT_CONVERSION_OCTAL && nZeroCount == 0U && (nDigitCount == 0U || *tszDigitsBegin != '0'))
+				nZeroCount = 1U;
+			else if (nConversion == FORMAT_CONVERSION_HEXADECIMAL && uMagnitude != 0U)
+			{
+				arrPrefix[nPrefixLength++] = '0';
+				arrPrefix[nPrefixLength++] = ((nFlags & FORMAT_FLAG_UPPER) != 0U ? 'X' : 'x');
+			}
+		}
+
+		// zero flag is ignored when the precision is specified
+		if (iPrecision >= 0)
+			nFlags &= ~FORMAT_FLAG_ZERO;
+
+		WriteFormatField(writer, nFlags, iWidth, arrPrefix, nPrefixLength, nZeroCount, nDigitCount, [&writer, tszDigitsBegin, nDigitCount]()
+		{
+			writer.Write(tszDigitsBegin, nDigitCount);
+		});
+	}
+
+	/// write the digits in positional notation with the given count of fractional digits, digits past the given ones are zeros
+	template <typename W, typename T>
+	void WriteFormatRealPositional(W& writer, const T* tszDigits, std::size_t nDigitCount, const int iExponent, const std::size_t nFractionalCount, const bool bHasPoint)
+	{
+		if (iExponent >= 0)
+		{
+			const std::size_t nIntegerCount = static_cast<std::size_t>(iExponent) + 1U;
+			const std::size_t nIntegerDigitCount = Min(nDigitCount, nIntegerCount);
+
+			writer.Write(tszDigits, nIntegerDigitCount);
+			writer.Fill('0', nIntegerCount - nIntegerDigitCount);
+			tszDigits += nIntegerDigitCount;
+			nDigitCount -= nIntegerDigitCount;
+		}
+		else
+			writer.Fill('0', 1U);
+
+		if (bHasPoint)
+		{
+			writer.Fill('.', 1U);
+
+			const std::size_t nLeadingZeroCount = (iExponent < 0 ? Min(static_cast<std::size_t>(-iExponent - 1), nFractionalCount) : 0U);
+			const std::size_t nFractionalDigitCount = Min(nDigitCount, nFractionalCount - nLeadingZeroCount);
+
+			writer.Fill('0', nLeadingZeroCount);
+			writer.Write(tszDigits, nFractionalDigitCount);
+			writer.Fill('0', nFractionalCount - nLeadingZeroCount - nFractionalDigitCount);
+		}
+	}
+
+	/// write the floating-point number with the floating-point conversion
+	template <typename W, typename T>
+	void WriteFormatReal(W& writer, const EFormatConversion nConversion, std::uint8_t nFlags, const int iWidth, const int iPrecision, const double dValue)
+	{
+		using RealTraits = RealTraits_t<double>;
+		const auto ullBits = std::bit_cast<std::uint64_t>(dValue);
+		const auto uExponent = static_cast<std::uint32_t>((ullBits & RealTraits::kExponentMask) >> RealTraits::kMantissaWidth);
+		const std::uint64_t ullMantissa = ullBits & RealTraits::kMantissaMask;
+		const double dAbsolute = std::bit_cast<double>(ullBits & ~RealTraits::kSignMask);
+		const bool bIsUpper = ((nFlags & FORMAT_FLAG_UPPER) != 0U);
+		const bool bIsAlternative = ((nFlags & FORMAT_FLAG_ALTERNATIVE) != 0U);
+
+		T tchSign = '\0';
+		if ((ullBits & RealTraits::kSignMask) != 0U)
+			tchSign = '-';
+		else if ((nFlags & FORMAT_FLAG_SIGN) != 0U)
+			tchSign = '+';
+		else if ((nFlags & FORMAT_FLAG_SPACE) != 0U)
+			tchSign = ' ';
+		const std::size_t nPrefixLength = (tchSign != '\0' ? 1U : 0U);
+
+		// check if the all bits of the exponent is set, indicating that value is infinity or NaN, they're never padded with zeros
+		if (uExponent == (1U << RealTraits::kExponentWidth) - 1U)
+		{
+			const char* szSpecial = (ullMantissa != 0U ? (bIsUpper ? "NAN" : "nan") : (bIsUpper ? "INF" : "inf"));
+			const T arrSpecial[3] = { static_cast<T>(szSpecial[0]), static_cast<T>(szSpecial[1]), static_cast<T>(szSpecial[2]) };
+
+			WriteFormatField(writer, nFlags & ~FORMAT_FLAG_ZERO, iWidth, &tchSign, nPrefixLength, 0U, 3U, [&writer, &arrSpecial]()
+			{
+				writer.Write(arrSpecial, 3U);
+			});
+			return;
+		}
+
+		const std::size_t nPrecision = static_cast<std::size_t>(iPrecision < 0 ? 6 : iPrecision);
+		// exact decimal value never has more significant digits than that, so the rest are zeros
+		constexpr std::size_t nMaxDigitCount = RealTraits::kMaxSignificantDigits;
+		// significant digits, decimal point, exponent with its sign and the terminating null
+		T arrBuffer[nMaxDigitCount + 8U];
+
+		// general notation without trailing zeros is printed by the converter as is
+		if (nConversion == FORMAT_CONVERSION_GENERAL && !bIsAlternative)
+		{
+			T* tszResult = RealToString(dAbsolute, arrBuffer, sizeof(arrBuffer) / sizeof(T), REAL_FORMAT_GENERAL, static_cast<int>(Min(nPrecision, nMaxDigitCount)));
+			const std::size_t nResultLength = StringLength(tszResult);
+
+			if (bIsUpper)
+			{
+				for (std::size_t i = 0U; i < nResultLength; ++i)
+				{
+					if (tszResult[i] == 'e')
+						tszResult[i] = 'E';
+				}
+			}
+
+			WriteFormatField(writer, nFlags, iWidth, &tchSign, nPrefixLength, 0U, nResultLength, [&writer, tszResult, nResultLength]()
+			{
+				writer.Write(tszResult, nResultLength);
+			});
+			return;
+		}
+
+		const T* tszDigits = arrBuffer;
+		std::size_t nDigitCount = 0U;
+		// decimal exponent of the first significant digit
+		int iExponent = 0;
+
+		// convert the absolute value to the scientific notation with the given count of significant digits, then join the digits around the decimal point and parse the exponent
+		const auto GenerateDigits = [&](const std::size_t nRequiredCount)
+		{
+			const std::size_t nGenerateCount = Min(nRequiredCount, nMaxDigitCount);
+			T* tszResult = RealToString(dAbsolute, arrBuffer, sizeof(arrBuffer) / sizeof(T), REAL_FORMAT_SCIENTIFIC, static_cast<int>(nGenerateCount) - 1);
+
+			if (tszResult[1] == '.')
+			{
+				tszResult[1] = tszResult[0];
+				++tszResult;
+			}
+
+			const T* tszExponent = tszResult + nGenerateCount + 1U;
+			const bool bIsExponentNegative = (*tszExponent++ == '-');
+			int iAbsoluteExponent = 0;
+			while (*tszExponent != '\0')
+				iAbsoluteExponent = iAbsoluteExponent * 10 + static_cast<int>(*tszExponent++ - '0');
+
+			tszDigits = tszResult;
+			nDigitCount = nGenerateCount;
+			iExponent = (bIsExponentNegative ? -iAbsoluteExponent : iAbsoluteExponent);
+		};
+
+		if (nConversion == FORMAT_CONVERSION_FIXED)
+		{
+			if ((uExponent | ullMantissa) != 0U)
+			{
+				// the estimate is either the exponent of the value or the one above it, rounding the value at the requested fractional digit can raise its exponent by one too
+				const int iBinaryExponent = (uExponent != 0U ? static_cast<int>(uExponent) - RealTraits::kExponentBias : static_cast<int>(std::bit_width(ullMantissa)) - 1 + RealTraits::kExponentDenormalMin);
+				int iEstimatedExponent = FloorLog10Pow2(iBinaryExponent + 1);
+
+				while (true)
+				{
+					const int iSignificantCount = iEstimatedExponent + 1 + static_cast<int>(nPrecision);
+
+					if (iSignificantCount > 0)
+					{
+						GenerateDigits(static_cast<std::size_t>(iSignificantCount));
+
+						// when the estimate is one above the exponent, the digits were rounded one position too far
+						if (iExponent == iEstimatedExponent - 1)
+						{
+							--iEstimatedExponent;
+							continue;
+						}
+					}
+					else
+					{
+						// value is less than the unit of the last fractional digit, so it's rounded either to zero or to that unit
+						bool bIsRoundedUp = false;
+
+						if (iSignificantCount == 0)
+						{
+							GenerateDigits(std::numeric_limits<double>::max_digits10 + 1U);
+
+							if (iExponent > iEstimatedExponent)
+								bIsRoundedUp = true;
+							else if (iExponent == iEstimatedExponent)
+							{
+								// value exactly midway is rounded to the even zero
+								bIsRoundedUp = (tszDigits[0] > '5');
+								for (std::size_t i = 1U; i < nDigitCount && !bIsRoundedUp && tszDigits[0] == '5'; ++i)
+									bIsRoundedUp = (tszDigits[i] != '0');
+							}
+						}
+
+						arrBuffer[0] = '1';
+						tszDigits = arrBuffer;
+						nDigitCount = (bIsRoundedUp ? 1U : 0U);
+						iExponent = (bIsRoundedUp ? -static_cast<int>(nPrecision) : -1);
+					}
+
+					break;
+				}
+			}
+
+			const bool bHasPoint = (nPrecision > 0U || bIsAlternative);
+			const std::size_t nBodyLength = (iExponent >= 0 ? static_cast<std::size_t>(iExponent) + 1U : 1U) + (bHasPoint ? nPrecision + 1U : 0U);
+
+			WriteFormatField(writer, nFlags, iWidth, &tchSign, nPrefixLength, 0U, nBodyLength, [&]()
+			{
+				WriteFormatRealPositional(writer, tszDigits, nDigitCount, iExponent, nPrecision, bHasPoint);
+			});
+			return;
+		}
+
+		// count of the significant digits of the scientific notation, general notation treats zero precision as one
+		const std::size_t nSignificantCount = (nConversion == FORMAT_CONVERSION_SCIENTIFIC ? nPrecision + 1U : Max<std::size_t>(nPrecision, 1U));
+		GenerateDigits(nSignificantCount);
+
+		// alternative form of the general notation keeps the trailing zeros, and it's either the scientific or the positional notation with the same significant digits
+		if (nConversion == FORMAT_CONVERSION_GENERAL && iExponent >= -4 && iExponent < static_cast<int>(nSignificantCount))
+		{
+			const std::size_t nFractionalCount = nSignificantCount - 1U - static_cast<std::size_t>(iExponent);
+			const std::size_t nBodyLength = (iExponent >= 0 ? static_cast<std::size_t>(iExponent) + 1U : 1U) + nFractionalCount + 1U;
+
+			WriteFormatField(writer, nFlags, iWidth, &tchSign, nPrefixLength, 0U, nBodyLength, [&]()
+			{
+				WriteFormatRealPositional(writer, tszDigits, nDigitCount, iExponent, nFractionalCount, true);
+			});
+			return;
+		}
+
+		const std::size_t nFractionalCount = nSignificantCount - 1U;
+		const bool bHasPoint = (nFractionalCount > 0U || bIsAlternative);
+		const int iAbsoluteExponent = (iExponent < 0 ? -iExponent : iExponent);
+
+		// exponent has at least two digits
+		T arrExponent[5] = { (bIsUpper ? 'E' : 'e'), (iExponent < 0 ? '-' : '+') };
+		std::size_t nExponentLength = 2U;
+		if (iAbsoluteExponent >= 100)
+			arrExponent[nExponentLength++] = static_cast<T>('0' + iAbsoluteExponent / 100);
+		arrExponent[nExponentLength++] = static_cast<T>('0' + iAbsoluteExponent / 10 % 10);
+		arrExponent[nExponentLength++] = static_cast<T>('0' + iAbsoluteExponent % 10);
+
+		const std::size_t nBodyLength = 1U + (bHasPoint ? nFractionalCount + 1U : 0U) + nExponentLength;
+
+		WriteFormatField(writer, nFlags, iWidth, &tchSign, nPrefixLength, 0U, nBodyLength, [&]()
+		{
+			writer.Write(tszDigits, 1U);
+
+			if (bHasPoint)
+			{
+				const std::size_t nFractionalDigitCount = Min(nDigitCount - 1U, nFractionalCount);
+
+				writer.Fill('.', 1U);
+				writer.Write(tszDigits + 1U, nFractionalDigitCount);
+				writer.Fill('0', nFractionalCount - nFractionalDigitCount);
+			}
+
+			writer.Write(arrExponent, nExponentLength);
+		});
+	}
+
+	/// write the string with the string conversion
+	template <typename W, typename T>
+	void WriteFormatString(W& writer, const std::uint8_t nFlags, const int iWidth, const int iPrecision, const T* tszValue)
+	{
+		static constexpr T arrNull[] = { '(', 'n', 'u', 'l', 'l', ')' };
+
+		std::size_t nLength;
+		if (tszValue == nullptr)
+		{
+			// same as glibc, the null string is written only as whole, otherwise nothing is written
+			tszValue = arrNull;
+			nLength = ((iPrecision < 0 || static_cast<std::size_t>(iPrecision) >= sizeof(arrNull) / sizeof(T)) ? sizeof(arrNull) / sizeof(T) : 0U);
+		}
+		else
+			nLength = (iPrecision >= 0 ? StringLengthN(tszValue, static_cast<std::size_t>(iPrecision)) : StringLength(tszValue));
+
+		WriteFormatField(writer, nFlags, iWidth, tszValue, 0U, 0U, nLength, [&writer, tszValue, nLength]()
+		{
+			writer.Write(tszValue, nLength);
+		});
+	}
+
+	/// write the address with the pointer conversion
+	template <typename W, typename T>
+	void WriteFormatPointer(W& writer, const std::uint8_t nFlags, const int iWidth, const void* pValue)
+	{
+		// null pointer is written as by 'printf()' of glibc
+		if (pValue == nullptr)
+		{
+			static constexpr T arrNil[] = { '(', 'n', 'i', 'l', ')' };
+			WriteFormatField(writer, nFlags, iWidth, arrNil, 0U, 0U, sizeof(arrNil) / sizeof(T), [&writer]()
+			{
+				writer.Write(arrNil, sizeof(arrNil) / sizeof(T));
+			});
+			return;
+		}
+
+		WriteFormatInteger<W, T>(writer, FORMAT_CONVERSION_HEXADECIMAL, FORMAT_LENGTH_NONE, nFlags | FORMAT_FLAG_ALTERNATIVE, iWidth, -1, reinterpret_cast<std::uintptr_t>(pValue));
+	}
+
+	/// write the literal text preceding the argument's conversion and the converted argument, or store the argument as the field width or precision of the next conversion
+	template <typename W, typename T, typename V>
+	Q_INLINE inline void WriteFormatArgument(W& writer, const T* tszFormat, const FormatOperation_t* arrOperations, const EFormatArgument nPurpose, std::size_t& nOperation, int& iArgumentWidth, int& iArgumentPrecision, const V& argument)
+	{
+		// arrays decay to the pointers to their constant elements
+		using ArgumentType_t = std::remove_cv_t<std::decay_t<const V&>>;
+		const ArgumentType_t value = argument;
+
+		if constexpr (std::is_integral_v<ArgumentType_t>)
+		{
+			if (nPurpose == FORMAT_ARGUMENT_WIDTH)
+			{
+				iArgumentWidth = static_cast<int>(value);
+				return;
+			}
+
+			if (nPurpose == FORMAT_ARGUMENT_PRECISION)
+			{
+				iArgumentPrecision = static_cast<int>(value);
+				return;
+			}
+		}
+
+		const FormatOperation_t& operation = arrOperations[nOperation++];
+		WriteFormatLiteral(writer, tszFormat, operation);
+
+		std::uint8_t nFlags = operation.nFlags;
+		int iWidth = operation.iWidth;
+		int iPrecision = operation.iPrecision;
+
+		// negative field width argument is taken as the left justification flag followed by the positive width, and negative precision argument as if the precision is omitted
+		if ((nFlags & FORMAT_FLAG_WIDTH_ARGUMENT) != 0U)
+		{
+			iWidth = iArgumentWidth;
+			if (iWidth < 0)
+			{
+				nFlags |= FORMAT_FLAG_LEFT;
+				iWidth = (iWidth == std::numeric_limits<int>::min() ? std::numeric_limits<int>::max() : -iWidth);
+			}
+		}
+
+		if ((nFlags & FORMAT_FLAG_PRECISION_ARGUMENT) != 0U)
+			iPrecision = (iArgumentPrecision < 0 ? -1 : iArgumentPrecision);
+
+		// zero flag is ignored when the left justification flag is specified
+		if ((nFlags & FORMAT_FLAG_LEFT) != 0U)
+			nFlags &= ~FORMAT_FLAG_ZERO;
+
+		if constexpr (std::is_integral_v<ArgumentType_t> || std::is_enum_v<ArgumentType_t>)
+		{
+			if (operation.nConversion == FORMAT_CONVERSION_CHARACTER)
+			{
+				const T tchValue = static_cast<T>(value);
+				WriteFormatField(writer, nFlags, iWidth, &tchValue, 0U, 0U, 1U, [&writer, &tchValue]()
+				{
+					writer.Write(&tchValue, 1U);
+				});
+			}
+			else if constexpr (std::is_same_v<ArgumentType_t, bool>)
+				WriteFormatInteger<W, T>(writer, operation.nConversion, operation.nLength, nFlags, iWidth, iPrecision, static_cast<int>(value));
+			else if constexpr (std::is_enum_v<ArgumentType_t>)
+				WriteFormatInteger<W, T>(writer, operation.nConversion, operation.nLength, nFlags, iWidth, iPrecision, static_cast<std::underlying_type_t<ArgumentType_t>>(value));
+			else
+				WriteFormatInteger<W, T>(writer, operation.nConversion, operation.nLength, nFlags, iWidth, iPrecision, value);
+		}
+		else if constexpr (std::is_floating_point_v<ArgumentType_t>)
+			WriteFormatReal<W, T>(writer, operation.nConversion, nFlags, iWidth, iPrecision, static_cast<double>(value));
+		else if constexpr (std::is_same_v<ArgumentType_t, const T*> || std::is_same_v<ArgumentType_t, T*>)
+		{
+			if (operation.nConversion == FORMAT_CONVERSION_POINTER)
+				WriteFormatPointer<W, T>(writer, nFlags, iWidth, value);
+			else
+				WriteFormatString(writer, nFlags, iWidth, iPrecision, static_cast<const T*>(value));
+		}
+		else if constexpr (std::is_null_pointer_v<ArgumentType_t>)
+			WriteFormatPointer<W, T>(writer, nFlags, iWidth, nullptr);
+		else
+			WriteFormatPointer<W, T>(writer, nFlags, iWidth, reinterpret_cast<const void*>(value));
+	}
+
+	/// write the formatted arguments with the given writer, that provides 'Write(const T*, std::size_t)' and 'Fill(T, std::size_t)' methods
+	template <typename W, typename T, typename... A>
+	Q_INLINE inline void WriteFormat(W& writer, const FormatString_t<T, A...>& format, const A&... arguments)
+	{
+		std::size_t nOperation = 0U;
+		std::size_t nArgument = 0U;
+		int iArgumentWidth = 0;
+		int iArgumentPrecision = -1;
+
+		(WriteFormatArgument(writer, format.tszFormat, format.arrOperations, format.arrArgumentPurposes[nArgument++], nOperation, iArgumentWidth, iArgumentPrecision, arguments), ...);
+		WriteFormatLiteral(writer, format.tszFormat, format.arrOperations[nOperation]);
+	}
+}
+
+/// write the formatted data to a string, alternative of 'sprintf()', 'swprintf()'
+/// @param[in] format format string literal, that is compiled at compile time, see 'FormatString_t'
+/// @param[in] arguments arguments to convert, their types are checked against the format string at compile time
+/// @remarks: writes the literal text of the format string and converted arguments to the @a`tszDestination` buffer followed by the terminating null. integer conversions are performed with 'IntegerToChars()' and floating-point conversions with 'RealToString()', so output of them is the same as of 'printf()' of glibc
+/// @returns: count of the written characters, not including the terminating null
+template <typename T, typename... A> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+std::size_t StringPrint(T* tszDestination, const FormatString_t<std::type_identity_t<T>, std::type_identity_t<A>...> format, const A&... arguments)
+{
+	DETAIL::FormatBufferWriter_t<T> writer = { tszDestination, std::numeric_limits<std::size_t>::max() };
+	DETAIL::WriteFormat(writer, format, arguments...);
+
+	*writer.tszDestination = '\0';
+	return writer.nCount;
+}
+
+/// write the formatted data to a string, alternative of 'snprintf()', 'swprintf()'
+/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters
+/// @param[in] format format string literal, that is compiled at compile time, see 'FormatString_t'
+/// @param[in] arguments arguments to convert, their types are checked against the format string at compile time
+/// @remarks: writes the literal text of the format string and converted arguments to the @a`tszDestination` buffer, truncating the output to fit it and always terminating it with null unless the buffer is empty
+/// @returns: count of the characters that would have been written if the buffer is large enough, not including the terminating null
+template <typename T, typename... A> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+std::size_t StringPrintN(T* tszDestination, const std::size_t nDestinationSize, const FormatString_t<std::type_identity_t<T>, std::type_identity_t<A>...> format, const A&... arguments)
+{
+	if (nDestinationSize == 0U)
+	{
+		DETAIL::FormatCountWriter_t<T> writer;
+		DETAIL::WriteFormat(writer, format, arguments...);
+		return writer.nCount;
+	}
+
+	DETAIL::FormatBufferWriter_t<T> writer = { tszDestination, nDestinationSize - 1U };
+	DETAIL::WriteFormat(writer, format, arguments...);
+
+	*writer.tszDestination = '\0';
+	return writer.nCount;
+}
+
+/// @returns: count of the characters that the formatted data consists of, without writing them anywhere
+/// @remarks: the format string and arguments are the same as of 'StringPrint()'
+template <typename... A>
+std::size_t StringPrintLength(const FormatString_t<char, std::type_identity_t<A>...> format, const A&... arguments)
+{
+	DETAIL::FormatCountWriter_t<char> writer;
+	DETAIL::WriteFormat(writer, format, arguments...);
+	return writer.nCount;
+}
+
+/// @returns: count of the wide characters that the formatted data consists of, without writing them anywhere
+/// @remarks: the format string and arguments are the same as of 'StringPrint()'
+template <typename... A>
+std::size_t StringPrintLength(const FormatString_t<wchar_t, std::type_identity_t<A>...> format, const A&... arguments)
+{
+	DETAIL::FormatCountWriter_t<wchar_t> writer;
+	DETAIL::WriteFormat(writer, format, arguments...);
+	return writer.nCount;
+}
+
+/*
+ * sinks of the streaming formatted output of 'StringPrintTo()'
+ * - sink is any class that has 'Character_t' type of its characters and 'Write(const Character_t*, std::size_t)' method, that receives the output in the order it's produced.
+ *   the output is collected to the fixed chunk on the stack and passed to the sink each time the chunk is full, so its size isn't limited by any buffer
+ * - sink that also has 'Fill(Character_t, std::size_t)' method receives the output directly, without the intermediate chunk
+ * - sinks below don't own the storage and never allocate, arena grows only through the caller-supplied callable
+ */
+template <typename S>
+concept FormatSink_t = requires (S& sink, const typename S::Character_t* tszSource, std::size_t nLength) { sink.Write(tszSource, nLength); };
+template <typename S>
+concept FormatFillSink_t = FormatSink_t<S> && requires (S& sink, const typename S::Character_t tchFill, std::size_t nLength) { sink.Fill(tchFill, nLength); };
+
+/*
+ * sink that writes the output to the fixed-size buffer
+ * - keeps the buffer null-terminated, the output that doesn't fit is discarded
+ */
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+class FormatFixedSink_t
+{
+public:
+	using Character_t = T;
+
+	/// @param[in] tszBuffer buffer to write the output to
+	/// @param[in] nBufferSize size of the buffer including the terminating null, in characters
+	FormatFixedSink_t(T* tszBuffer, const std::size_t nBufferSize) :
+		tszBuffer(tszBuffer), nBufferSize(nBufferSize)
+	{
+		if (nBufferSize != 0U)
+			*tszBuffer = '\0';
+	}
+
+	void Write(const T* tszSource, const std::size_t nLength)
+	{
+		const std::size_t nWriteLength = this->Reserve(nLength);
+		DETAIL::CopyFormatCharacters(this->tszBuffer + this->nLength, tszSource, nWriteLength);
+		this->Commit(nWriteLength);
+	}
+
+	void Fill(const T tchFill, const std::size_t nLength)
+	{
+		const std::size_t nWriteLength = this->Reserve(nLength);
+		DETAIL::FillFormatCharacters(this->tszBuffer + this->nLength, tchFill, nWriteLength);
+		this->Commit(nWriteLength);
+	}
+
+	/// discard the written output
+	void Reset()
+	{
+		this->nLength = 0U;
+		this->bIsTruncated = false;
+
+		if (this->nBufferSize != 0U)
+			*this->tszBuffer = '\0';
+	}
+
+	[[nodiscard]] const T* GetData() const
+	{
+		return this->tszBuffer;
+	}
+
+	/// @returns: count of the written characters, not including the terminating null
+	[[nodiscard]] std::size_t GetLength() const
+	{
+		return this->nLength;
+	}
+
+	/// @returns: true if any of the output has been discarded, false otherwise
+	[[nodiscard]] bool IsTruncated() const
+	{
+		return this->bIsTruncated;
+	}
+
+private:
+	/// @returns: count of the characters of the given count that fit the buffer
+	std::size_t Reserve(const std::size_t nLength)
+	{
+		const std::size_t nAvailableLength = (this->nBufferSize != 0U ? this->nBufferSize - 1U - this->nLength : 0U);
+		if (nLength <= nAvailableLength)
+			return nLength;
+
+		this->bIsTruncated = true;
+		return nAvailableLength;
+	}
+
+	void Commit(const std::size_t nWriteLength)
+	{
+		this->nLength += nWriteLength;
+
+		if (this->nBufferSize != 0U)
+			this->tszBuffer[this->nLength] = '\0';
+	}
+
+	T* tszBuffer;
+	std::size_t nBufferSize;
+	std::size_t nLength = 0U;
+	bool bIsTruncated = false;
+};
+
+/// callable for 'FormatArenaSink_t' that never grows the arena
+struct FormatArenaNoGrow_t
+{
+	template <typename T>
+	T* operator()([[maybe_unused]] T* tszStorage, [[maybe_unused]] const std::size_t nLength, [[maybe_unused]] const std::size_t nRequiredSize, [[maybe_unused]] std::size_t& nNewSize) const noexcept
+	{
+		return nullptr;
+	}
+};
+
+/*
+ * sink that appends the output to the contiguous arena, that grows when it's exhausted
+ * - the output of the consecutive prints is appended, so the arena can batch them until it's consumed and reset
+ * - grows with the caller-supplied callable, at least twice of the current size, so the count of the reallocations is logarithmic and they're off the hot path.
+ *   the output that doesn't fit the arena that can't grow is discarded
+ * - arena isn't null-terminated
+ */
+template <typename T, typename G = FormatArenaNoGrow_t> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+class FormatArenaSink_t
+{
+public:
+	using Character_t = T;
+
+	/// @param[in] tszStorage initial storage of the arena, can be null when @a`nStorageSize` is zero
+	/// @param[in] nStorageSize size of the initial storage, in characters
+	/// @param[in] fnGrow callable of the form 'T*(T* tszStorage, std::size_t nLength, std::size_t nRequiredSize, std::size_t& nNewSize)' that is called when the storage is exhausted. it should return the new storage of at least @a`nRequiredSize` characters, with the first @a`nLength` characters copied from the current storage, and store its size to @a`nNewSize`, or return null if the arena can't grow
+	FormatArenaSink_t(T* tszStorage, const std::size_t nStorageSize, G fnGrow = G()) :
+		tszStorage(tszStorage), nStorageSize(nStorageSize), fnGrow(fnGrow) { }
+
+	void Write(const T* tszSource, const std::size_t nLength)
+	{
+		const std::size_t nWriteLength = this->Reserve(nLength);
+		DETAIL::CopyFormatCharacters(this->tszStorage + this->nLength, tszSource, nWriteLength);
+		this->nLength += nWriteLength;
+	}
+
+	void Fill(const T tchFill, const std::size_t nLength)
+	{
+		const std::size_t nWriteLength = this->Reserve(nLength);
+		DETAIL::FillFormatCharacters(this->tszStorage + this->nLength, tchFill, nWriteLength);
+		this->nLength += nWriteLength;
+	}
+
+	/// discard the written output, the storage is kept
+	void Reset()
+	{
+		this->nLength = 0U;
+		this->bIsTruncated = false;
+	}
+
+	[[nodiscard]] const T* GetData() const
+	{
+		return this->tszStorage;
+	}
+
+	/// @returns: count of the written characters
+	[[nodiscard]] std::size_t GetLength() const
+	{
+		return this->nLength;
+	}
+
+	/// @returns: true if any of the output has been discarded, false otherwise
+	[[nodiscard]] bool IsTruncated() const
+	{
+		return this->bIsTruncated;
+	}
+
+private:
+	/// @returns: count of the characters of the given count that fit the storage, after growing it if needed
+	std::size_t Reserve(const std::size_t nLength)
+	{
+		if (nLength <= this->nStorageSize - this->nLength)
+			return nLength;
+
+		const std::size_t nRequiredSize = Max(this->nLength + nLength, this->nStorageSize * 2U);
+		std::size_t nNewSize = 0U;
+
+		if (T* tszNewStorage = this->fnGrow(this->tszStorage, this->nLength, nRequiredSize, nNewSize); tszNewStorage != nullptr && nNewSize >= this->nLength + nLength)
+		{
+			this->tszStorage = tszNewStorage;
+			this->nStorageSize = nNewSize;
+			return nLength;
+		}
+
+		this->bIsTruncated = true;
+		return this->nStorageSize - this->nLength;
+	}
+
+	T* tszStorage;
+	std::size_t nStorageSize;
+	std::size_t nLength = 0U;
+	bool bIsTruncated = false;
+	G fnGrow;
+};
+
+/*
+ * sink that writes the output to the ring buffer, keeping only the last written characters
+ * - the oldest characters are overwritten when the buffer is full, so it never discards the new output and its memory is bounded
+ * - ring buffer isn't null-terminated
+ */
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+class FormatRingSink_t
+{
+public:
+	using Character_t = T;
+
+	/// @param[in] tszStorage storage of the ring buffer
+	/// @param[in] nStorageSize size of the storage, in characters
+	FormatRingSink_t(T* tszStorage, const std::size_t nStorageSize) :
+		tszStorage(tszStorage), nStorageSize(nStorageSize) { }
+
+	void Write(const T* tszSource, std::size_t nLength)
+	{
+		// only the last characters that fit the storage are kept
+		const std::size_t nSkipLength = (nLength > this->nStorageSize ? nLength - this->nStorageSize : 0U);
+		tszSource += nSkipLength;
+		this->Advance(nSkipLength);
+		nLength -= nSkipLength;
+
+		const std::size_t nFirstLength = Min(nLength, this->nStorageSize - this->nPosition);
+		DETAIL::CopyFormatCharacters(this->tszStorage + this->nPosition, tszSource, nFirstLength);
+		DETAIL::CopyFormatCharacters(this->tszStorage, tszSource + nFirstLength, nLength - nFirstLength);
+		this->Advance(nLength);
+	}
+
+	void Fill(const T tchFill, std::size_t nLength)
+	{
+		const std::size_t nSkipLength = (nLength > this->nStorageSize ? nLength - this->nStorageSize : 0U);
+		this->Advance(nSkipLength);
+		nLength -= nSkipLength;
+
+		const std::size_t nFirstLength = Min(nLength, this->nStorageSize - this->nPosition);
+		DETAIL::FillFormatCharacters(this->tszStorage + this->nPosition, tchFill, nFirstLength);
+		DETAIL::FillFormatCharacters(this->tszStorage, tchFill, nLength - nFirstLength);
+		this->Advance(nLength);
+	}
+
+	/// discard the written output
+	void Reset()
+	{
+		this->nPosition = 0U;
+		this->nTotalLength = 0U;
+	}
+
+	/// copy the kept characters in the order they were written
+	/// @param[out] tszDestination buffer that is large enough to hold @code GetLength() @endcode characters
+	/// @returns: pointer to the @a`tszDestination` advanced by the count of the copied characters
+	T* CopyTo(T* tszDestination) const
+	{
+		if (this->nTotalLength >= this->nStorageSize)
+			tszDestination = DETAIL::CopyFormatCharacters(tszDestination, this->tszStorage + this->nPosition, this->nStorageSize - this->nPosition);
+
+		return DETAIL::CopyFormatCharacters(tszDestination, this->tszStorage, this->nPosition);
+	}
+
+	/// @returns: count of the kept characters
+	[[nodiscard]] std::size_t GetLength() const
+	{
+		return Min(this->nTotalLength, this->nStorageSize);
+	}
+
+	/// @returns: count of all written characters, including the overwritten ones
+	[[nodiscard]] std::size_t GetTotalLength() const
+	{
+		return this->nTotalLength;
+	}
+
+private:
+	void Advance(const std::size_t nLength)
+	{
+		this->nTotalLength += nLength;
+
+		if (this->nStorageSize != 0U)
+		{
+			this->nPosition += nLength % this->nStorageSize;
+			if (this->nPosition >= this->nStorageSize)
+				this->nPosition -= this->nStorageSize;
+		}
+	}
+
+	T* tszStorage;
+	std::size_t nStorageSize;
+	// position of the next character to write, that is also the oldest kept character when the buffer is full
+	std::size_t nPosition = 0U;
+	std::size_t nTotalLength = 0U;
+};
+
+namespace DETAIL
+{
+	// count of the characters that the streaming formatter collects before passing them to the sink
+	inline constexpr std::size_t kFormatChunkSize = 512U;
+
+	/// formatted output writer that passes the output directly to the sink
+	template <typename S>
+	struct FormatSinkWriter_t
+	{
+		using Character_t = typename S::Character_t;
+
+		Q_INLINE inline void Write(const Character_t* tszSource, const std::size_t nLength)
+		{
+			sink.Write(tszSource, nLength);
+			nCount += nLength;
+		}
+
+		Q_INLINE inline void Fill(const Character_t tchFill, const std::size_t nLength)
+		{
+			sink.Fill(tchFill, nLength);
+			nCount += nLength;
+		}
+
+		S& sink;
+		std::size_t nCount = 0U;
+	};
+
+	/// formatted output writer that collects the output to the chunk and passes it to the sink when the chunk is full
+	template <typename S>
+	class FormatChunkWriter_t
+	{
+	public:
+		using Character_t = typename S::Character_t;
+
+		explicit FormatChunkWriter_t(S& sink) :
+			sink(sink) { }
+
+		Q_INLINE inline void Write(const Character_t* tszSource, const std::size_t nLength)
+		{
+			this->nCount += nLength;
+
+			if (nLength > kFormatChunkSize - this->nChunkLength)
+			{
+				this->Flush();
+
+				// the piece that doesn't fit the chunk anyway is passed as is
+				if (nLength >= kFormatChunkSize)
+				{
+					this->sink.Write(tszSource, nLength);
+					return;
+				}
+			}
+
+			CopyFormatCharacters(this->arrChunk + this->nChunkLength, tszSource, nLength);
+			this->nChunkLength += nLength;
+		}
+
+		Q_INLINE inline void Fill(const Character_t tchFill, std::size_t nLength)
+		{
+			this->nCount += nLength;
+
+			while (nLength > 0U)
+			{
+				if (this->nChunkLength == kFormatChunkSize)
+					this->Flush();
+
+				const std::size_t nFillLength = Min(nLength, kFormatChunkSize - this->nChunkLength);
+				FillFormatCharacters(this->arrChunk + this->nChunkLength, tchFill, nFillLength);
+				this->nChunkLength += nFillLength;
+				nLength -= nFillLength;
+			}
+		}
+
+		/// pass the collected output to the sink
+		void Flush()
+		{
+			if (this->nChunkLength != 0U)
+			{
+				this->sink.Write(this->arrChunk, this->nChunkLength);
+				this->nChunkLength = 0U;
+			}
+		}
+
+		[[nodiscard]] std::size_t GetCount() const
+		{
+			return this->nCount;
+		}
+
+	private:
+		S& sink;
+		std::size_t nCount = 0U;
+		std::size_t nChunkLength = 0U;
+		Character_t arrChunk[kFormatChunkSize];
+	};
+}
+
+/// write the formatted data to the sink, see 'FormatSink_t' for the requirements of the sink
+/// @param[in] format format string literal, that is compiled at compile time, see 'FormatString_t'
+/// @param[in] arguments arguments to convert, their types are checked against the format string at compile time
+/// @remarks: the output is streamed to the sink in chunks, the terminating null isn't written. never allocates by itself
+/// @returns: count of the characters of the output, including the ones that the sink has discarded
+template <FormatSink_t S, typename... A>
+std::size_t StringPrintTo(S& sink, const FormatString_t<typename S::Character_t, std::type_identity_t<A>...> format, const A&... arguments)
+{
+	if constexpr (FormatFillSink_t<S>)
+	{
+		DETAIL::FormatSinkWriter_t<S> writer = { sink };
+		DETAIL::WriteFormat(writer, format, arguments...);
+		return writer.nCount;
+	}
+	else
+	{
+		DETAIL::FormatChunkWriter_t<S> writer(sink);
+		DETAIL::WriteFormat(writer, format, arguments...);
+		writer.Flush();
+		return writer.GetCount();
+	}
+}
+#endif
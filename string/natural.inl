@@ -46,6 +46,8 @@ constexpr int StringNaturalCompare(const T* tszLeft, const T* tszRight)
 template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
 constexpr int StringNaturalCompareI(const T* tszLeft, const T* tszRight)
 {
+	using ComparisonType_t = std::conditional_t<std::is_same_v<T, char>, int, wint_t>;
+
 	int nLeft, nRight;
 	while (*tszLeft != '\0' || *tszRight != '\0')
 	{
@@ -65,8 +67,8 @@ constexpr int StringNaturalCompareI(const T* tszLeft, const T* tszRight)
 		}
 		else
 		{
-			nLeft = CharToLower(*tszLeft++);
-			nRight = CharToLower(*tszRight++);
+			nLeft = static_cast<int>(CharToLower(static_cast<ComparisonType_t>(*tszLeft++)));
+			nRight = static_cast<int>(CharToLower(static_cast<ComparisonType_t>(*tszRight++)));
 		}
 
 		// check either for larger number or regular equality
@@ -0,0 +1,547 @@
+#ifndef Q_CRT_STRING_NORMALIZE_IMPLEMENTATION
+#define Q_CRT_STRING_NORMALIZE_IMPLEMENTATION
+// @note: implements canonical normalization forms of Unicode Standard Annex #15, both UTF-8 and wide (UTF-16 or UTF-32, depending on the size of 'wchar_t') strings are supported
+
+enum ENormalizationForm : std::uint8_t
+{
+	NORMALIZATION_FORM_C = 0U, // canonical decomposition followed by canonical composition
+	NORMALIZATION_FORM_D // canonical decomposition
+};
+
+enum ENormalizationCheck : std::uint8_t
+{
+	NORMALIZATION_CHECK_YES = 0U, // string is in the normalization form
+	NORMALIZATION_CHECK_NO, // string is not in the normalization form
+	NORMALIZATION_CHECK_MAYBE // string may be in the normalization form, full normalization is required to determine
+};
+
+namespace DETAIL
+{
+	// algorithmic decomposition of the Hangul syllables
+	inline constexpr std::uint32_t kHangulSyllableBase = 0xAC00;
+	inline constexpr std::uint32_t kHangulLeadingBase = 0x1100;
+	inline constexpr std::uint32_t kHangulVowelBase = 0x1161;
+	inline constexpr std::uint32_t kHangulTrailingBase = 0x11A7;
+	inline constexpr std::uint32_t kHangulLeadingCount = 19U;
+	inline constexpr std::uint32_t kHangulVowelCount = 21U;
+	inline constexpr std::uint32_t kHangulTrailingCount = 28U;
+	inline constexpr std::uint32_t kHangulSyllableCount = kHangulLeadingCount * kHangulVowelCount * kHangulTrailingCount;
+	// bytes of the ill-formed UTF-8 sequences are decoded into this range to pass them through unchanged
+	inline constexpr std::uint32_t kNormalizeInvalidByte = 0x110000;
+	// maximal count of the codepoints of the segment that are reordered and composed together, longer sequences of non-starters are split (stream-safe text format limits it to 31)
+	inline constexpr std::size_t kNormalizeSegmentCapacity = 64U;
+	// maximal count of the codepoints of the full canonical decomposition
+	inline constexpr std::size_t kNormalizeDecompositionCapacity = 4U;
+
+	/// @returns: canonical combining class combined with 'ENormalizePropertyFlags_t' flags of the given codepoint
+	[[nodiscard]] Q_INLINE inline std::uint16_t GetNormalizeProperties(const std::uint32_t uCodepoint)
+	{
+		if (uCodepoint >= kNormalizePropertyCodepointLimit)
+			return 0U;
+
+		constexpr std::uint32_t uBlockPerPlaneShift = kNormalizePropertyPlaneShift - kNormalizePropertyBlockShift;
+		constexpr std::uint32_t uBlockPerPlaneMask = (1U << uBlockPerPlaneShift) - 1U;
+		constexpr std::uint32_t uBlockMask = (1U << kNormalizePropertyBlockShift) - 1U;
+
+		const std::uint32_t uBlockOffset = arrNormalizePropertyOffsets[(static_cast<std::uint32_t>(arrNormalizePropertyIndices[uCodepoint >> kNormalizePropertyPlaneShift]) << uBlockPerPlaneShift) + ((uCodepoint >> kNormalizePropertyBlockShift) & uBlockPerPlaneMask)];
+		return arrNormalizeProperties[arrNormalizePropertyLUT[uBlockOffset + (uCodepoint & uBlockMask)]];
+	}
+
+	/// decode the single codepoint from UTF-8, UTF-16 or UTF-32 string and advance it
+	/// @remarks: each byte of ill-formed UTF-8 sequence is decoded to 'kNormalizeInvalidByte' + byte, unpaired UTF-16 surrogates are decoded as is
+	template <typename T>
+	[[nodiscard]] Q_INLINE inline std::uint32_t DecodeNormalizeCodepoint(const T*& tszSource, const T* tszSourceEnd)
+	{
+		if constexpr (sizeof(T) == 4U)
+			return static_cast<std::uint32_t>(*tszSource++);
+		else if constexpr (sizeof(T) == 2U)
+		{
+			const std::uint32_t uHigh = static_cast<std::uint16_t>(*tszSource++);
+			if ((uHigh & 0xFC00) == 0xD800 && tszSource != tszSourceEnd && (static_cast<std::uint16_t>(*tszSource) & 0xFC00) == 0xDC00)
+				return 0x10000 + ((uHigh & 0x3FF) << 10U) + (static_cast<std::uint16_t>(*tszSource++) & 0x3FF);
+
+			return uHigh;
+		}
+		else
+		{
+			const std::uint8_t* pSource = reinterpret_cast<const std::uint8_t*>(tszSource);
+			const std::uint32_t uLead = *pSource;
+
+			std::ptrdiff_t nLength;
+			std::uint32_t uCodepoint, uSecondMin = 0x80, uSecondMax = 0xBF;
+			if (uLead < 0x80)
+			{
+				++tszSource;
+				return uLead;
+			}
+			else if (uLead < 0xC2)
+				nLength = 0;
+			else if (uLead < 0xE0)
+			{
+				// 110XXXXX 10XXXXXX
+				nLength = 2;
+				uCodepoint = uLead & 0x1F;
+			}
+			else if (uLead < 0xF0)
+			{
+				// 1110XXXX 10XXXXXX 10XXXXXX, excluding overlong encodings and surrogates
+				nLength = 3;
+				uCodepoint = uLead & 0x0F;
+				uSecondMin = (uLead == 0xE0 ? 0xA0 : 0x80);
+				uSecondMax = (uLead == 0xED ? 0x9F : 0xBF);
+			}
+			else if (uLead < 0xF5)
+			{
+				// 11110XXX 10XXXXXX 10XXXXXX 10XXXXXX, excluding overlong encodings and values above 0x10FFFF
+				nLength = 4;
+				uCodepoint = uLead & 0x07;
+				uSecondMin = (uLead == 0xF0 ? 0x90 : 0x80);
+				uSecondMax = (uLead == 0xF4 ? 0x8F : 0xBF);
+			}
+			else
+				nLength = 0;
+
+			// @note: null terminator is never a valid continuation byte, so it is not read past
+			if (nLength == 0 || (tszSourceEnd != nullptr && tszSourceEnd - tszSource < nLength) || pSource[1] < uSecondMin || pSource[1] > uSecondMax)
+			{
+				++tszSource;
+				return kNormalizeInvalidByte + uLead;
+			}
+
+			for (std::ptrdiff_t i = 1; i < nLength; ++i)
+			{
+				if ((pSource[i] & 0xC0) != 0x80)
+				{
+					++tszSource;
+					return kNormalizeInvalidByte + uLead;
+				}
+
+				uCodepoint = (uCodepoint << 6U) | (pSource[i] & 0x3F);
+			}
+
+			tszSource += nLength;
+			return uCodepoint;
+		}
+	}
+
+	/// encode the single codepoint to UTF-8, UTF-16 or UTF-32 string and advance it
+	/// @returns: true if the codepoint has been encoded, false if there is not enough space in the destination
+	template <typename T>
+	[[nodiscard]] Q_INLINE inline bool EncodeNormalizeCodepoint(const std::uint32_t uCodepoint, T*& tszDestination, const T* tszDestinationEnd)
+	{
+		const std::ptrdiff_t nAvailable = tszDestinationEnd - tszDestination;
+
+		if constexpr (sizeof(T) == 4U)
+		{
+			if (nAvailable < 1)
+				return false;
+
+			*tszDestination++ = static_cast<T>(uCodepoint);
+		}
+		else if constexpr (sizeof(T) == 2U)
+		{
+			if (uCodepoint < 0x10000)
+			{
+				if (nAvailable < 1)
+					return false;
+
+				*tszDestination++ = static_cast<T>(uCodepoint);
+			}
+			else
+			{
+				if (nAvailable < 2)
+					return false;
+
+				*tszDestination++ = static_cast<T>(0xD800 | ((uCodepoint - 0x10000) >> 10U));
+				*tszDestination++ = static_cast<T>(0xDC00 | (uCodepoint & 0x3FF));
+			}
+		}
+		else
+		{
+			if (uCodepoint < 0x80 || uCodepoint >= kNormalizeInvalidByte)
+			{
+				if (nAvailable < 1)
+					return false;
+
+				*tszDestination++ = static_cast<T>(uCodepoint & 0xFF);
+			}
+			else if (uCodepoint < 0x800)
+			{
+				if (nAvailable < 2)
+					return false;
+
+				*tszDestination++ = static_cast<T>(0xC0 | (uCodepoint >> 6U));
+				*tszDestination++ = static_cast<T>(0x80 | (uCodepoint & 0x3F));
+			}
+			else if (uCodepoint < 0x10000)
+			{
+				if (nAvailable < 3)
+					return false;
+
+				*tszDestination++ = static_cast<T>(0xE0 | (uCodepoint >> 12U));
+				*tszDestination++ = static_cast<T>(0x80 | ((uCodepoint >> 6U) & 0x3F));
+				*tszDestination++ = static_cast<T>(0x80 | (uCodepoint & 0x3F));
+			}
+			else
+			{
+				if (nAvailable < 4)
+					return false;
+
+				*tszDestination++ = static_cast<T>(0xF0 | (uCodepoint >> 18U));
+				*tszDestination++ = static_cast<T>(0x80 | ((uCodepoint >> 12U) & 0x3F));
+				*tszDestination++ = static_cast<T>(0x80 | ((uCodepoint >> 6U) & 0x3F));
+				*tszDestination++ = static_cast<T>(0x80 | (uCodepoint & 0x3F));
+			}
+		}
+
+		return true;
+	}
+
+	/// get full canonical decomposition of the given codepoint
+	/// @param[out] arrDecomposition destination buffer of at least 'kNormalizeDecompositionCapacity' codepoints
+	/// @returns: count of the decomposed codepoints, the codepoint itself is stored when it has no decomposition
+	Q_INLINE inline std::size_t DecomposeCodepoint(const std::uint32_t uCodepoint, std::uint32_t* arrDecomposition)
+	{
+		if (const std::uint32_t uSyllableIndex = uCodepoint - kHangulSyllableBase; uSyllableIndex < kHangulSyllableCount)
+		{
+			constexpr std::uint32_t nSyllablesPerLeading = kHangulVowelCount * kHangulTrailingCount;
+			arrDecomposition[0] = kHangulLeadingBase + uSyllableIndex / nSyllablesPerLeading;
+			arrDecomposition[1] = kHangulVowelBase + (uSyllableIndex % nSyllablesPerLeading) / kHangulTrailingCount;
+
+			if (const std::uint32_t uTrailingIndex = uSyllableIndex % kHangulTrailingCount; uTrailingIndex != 0U)
+			{
+				arrDecomposition[2] = kHangulTrailingBase + uTrailingIndex;
+				return 3U;
+			}
+
+			return 2U;
+		}
+
+		if ((GetNormalizeProperties(uCodepoint) & NORMALIZE_DECOMPOSABLE) == 0U)
+		{
+			arrDecomposition[0] = uCodepoint;
+			return 1U;
+		}
+
+		// @note: last key is the end sentinel and used only to get the length of the last decomposition
+		const std::uint32_t* pKey = LowerBound(arrNormalizeDecompositionKeys, arrNormalizeDecompositionKeys + (sizeof(arrNormalizeDecompositionKeys) / sizeof(arrNormalizeDecompositionKeys[0]) - 1U), uCodepoint << 12U);
+		const std::uint16_t* pData = arrNormalizeDecompositionData + (pKey[0] & 0xFFF);
+		const std::uint16_t* pDataEnd = arrNormalizeDecompositionData + (pKey[1] & 0xFFF);
+
+		std::size_t nCount = 0U;
+		while (pData < pDataEnd)
+			arrDecomposition[nCount++] = DecodeNormalizeCodepoint(pData, pDataEnd);
+
+		return nCount;
+	}
+
+	/// @returns: primary composite of the given starter and the following codepoint, or zero if they don't compose
+	Q_INLINE inline std::uint32_t ComposeCodepoints(const std::uint32_t uFirst, const std::uint32_t uSecond)
+	{
+		// leading and vowel jamo
+		if (const std::uint32_t uLeadingIndex = uFirst - kHangulLeadingBase, uVowelIndex = uSecond - kHangulVowelBase; uLeadingIndex < kHangulLeadingCount && uVowelIndex < kHangulVowelCount)
+			return kHangulSyllableBase + (uLeadingIndex * kHangulVowelCount + uVowelIndex) * kHangulTrailingCount;
+
+		// syllable without trailing and trailing jamo
+		if (const std::uint32_t uSyllableIndex = uFirst - kHangulSyllableBase, uTrailingIndex = uSecond - kHangulTrailingBase; uSyllableIndex < kHangulSyllableCount && uSyllableIndex % kHangulTrailingCount == 0U && uTrailingIndex - 1U < kHangulTrailingCount - 1U)
+			return uFirst + uTrailingIndex;
+
+		// ill-formed bytes and values above the codespace never compose
+		if ((uFirst | uSecond) >= kNormalizeInvalidByte)
+			return 0U;
+
+		const std::uint64_t* pCompositionsEnd = arrNormalizeCompositions + (sizeof(arrNormalizeCompositions) / sizeof(arrNormalizeCompositions[0]));
+		const std::uint64_t ullKey = (static_cast<std::uint64_t>(uFirst) << 21U) | uSecond;
+		const std::uint64_t* pComposition = LowerBound(arrNormalizeCompositions, pCompositionsEnd, ullKey, [](const std::uint64_t ullComposition, const std::uint64_t ullKey)
+		{
+			return (ullComposition >> 21U) < ullKey;
+		});
+
+		if (pComposition == pCompositionsEnd || (*pComposition >> 21U) != ullKey)
+			return 0U;
+
+		return static_cast<std::uint32_t>(*pComposition & 0x1FFFFF);
+	}
+
+	/// skip the leading characters of the string that are below the given codepoint and can't affect normalization
+	/// @remarks: checks the whole blocks of characters with SIMD, stops at the null terminator. when the end of the string is not given, reads are never crossing the page boundary
+	/// @param[in] uBound codepoint that is not greater than 0x80 for UTF-8 strings
+	template <typename T>
+	Q_CRT_NO_SANITIZE Q_INLINE inline void SkipNormalizedBlocks(const T*& tszSource, const T* tszSourceEnd, const std::uint32_t uBound)
+	{
+	#ifdef Q_ISA_SSE2
+		constexpr std::size_t nBlockLength = sizeof(__m128i) / sizeof(T);
+		constexpr std::uintptr_t uPageMask = 0xFFF;
+
+		// @returns: true if all characters of the block are in [1 .. uBound) range
+		const auto IsBlockNormalized = [uBound](const __m128i vecChars)
+		{
+			if constexpr (sizeof(T) == 1U)
+				// signed bytes above 0x7F are negative already
+				return ::_mm_movemask_epi8(::_mm_cmpgt_epi8(vecChars, ::_mm_setzero_si128())) == 0xFFFF;
+			else if constexpr (sizeof(T) == 2U)
+				return ::_mm_movemask_epi8(::_mm_and_si128(::_mm_cmpgt_epi16(vecChars, ::_mm_setzero_si128()), ::_mm_cmpgt_epi16(::_mm_set1_epi16(static_cast<short>(uBound)), vecChars))) == 0xFFFF;
+			else
+				return ::_mm_movemask_epi8(::_mm_and_si128(::_mm_cmpgt_epi32(vecChars, ::_mm_setzero_si128()), ::_mm_cmpgt_epi32(::_mm_set1_epi32(static_cast<int>(uBound)), vecChars))) == 0xFFFF;
+		};
+
+		while (true)
+		{
+			std::size_t nBlockCount;
+			if (tszSourceEnd != nullptr)
+			{
+				// remaining characters are checked by the caller
+				if (nBlockCount = static_cast<std::size_t>(tszSourceEnd - tszSource) / nBlockLength; nBlockCount == 0U)
+					return;
+			}
+			// step over the page boundary by single character
+			else if (nBlockCount = (uPageMask + 1U - (reinterpret_cast<std::uintptr_t>(tszSource) & uPageMask)) / sizeof(__m128i); nBlockCount == 0U)
+			{
+				if (static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<T>>(*tszSource)) - 1U >= uBound - 1U)
+					return;
+
+				++tszSource;
+				continue;
+			}
+
+			for (; nBlockCount > 0U; --nBlockCount)
+			{
+				if (!IsBlockNormalized(::_mm_loadu_si128(reinterpret_cast<const __m128i*>(tszSource))))
+					return;
+
+				tszSource += nBlockLength;
+			}
+		}
+	#else
+		static_cast<void>(tszSource);
+		static_cast<void>(tszSourceEnd);
+		static_cast<void>(uBound);
+	#endif
+	}
+
+	/// @returns: codepoint below which characters are not affected by the given normalization form and have zero canonical combining class
+	[[nodiscard]] constexpr std::uint32_t GetNormalizeQuickCheckBound(const ENormalizationForm nForm)
+	{
+		return (nForm == NORMALIZATION_FORM_C ? 0x300 : 0xC0);
+	}
+
+	/// buffer of the codepoints of the current segment, that starts with a starter and followed by non-starters
+	struct NormalizeSegment_t
+	{
+		std::uint32_t arrCodepoints[kNormalizeSegmentCapacity];
+		std::uint8_t arrClasses[kNormalizeSegmentCapacity];
+		std::size_t nCount = 0U;
+	};
+
+	/// reorder and optionally compose the codepoints of the segment, then encode them into the destination
+	/// @param[in] bKeepStarter if true, the trailing starter of the composed segment is kept in the buffer to be composed with the following characters
+	/// @returns: true if the codepoints have been encoded, false if there is not enough space in the destination
+	template <typename T>
+	[[nodiscard]] bool FlushNormalizeSegment(NormalizeSegment_t& segment, const ENormalizationForm nForm, T*& tszDestination, const T* tszDestinationEnd, const bool bKeepStarter)
+	{
+		std::uint32_t* arrCodepoints = segment.arrCodepoints;
+		std::uint8_t* arrClasses = segment.arrClasses;
+		std::size_t nCount = segment.nCount;
+
+		// canonical ordering, stable sort of the non-starters by their combining class, starters are never moved
+		for (std::size_t i = 1U; i < nCount; ++i)
+		{
+			for (std::size_t j = i; j > 0U && arrClasses[j] != 0U && arrClasses[j - 1U] > arrClasses[j]; --j)
+			{
+				std::swap(arrCodepoints[j], arrCodepoints[j - 1U]);
+				std::swap(arrClasses[j], arrClasses[j - 1U]);
+			}
+		}
+
+		// canonical composition
+		if (nForm == NORMALIZATION_FORM_C && nCount > 1U)
+		{
+			std::size_t nStarterIndex = (arrClasses[0] == 0U ? 0U : nCount);
+			std::uint8_t uLastClass = arrClasses[0];
+			std::size_t nComposedCount = 1U;
+
+			for (std::size_t i = 1U; i < nCount; ++i)
+			{
+				const std::uint32_t uCodepoint = arrCodepoints[i];
+				const std::uint8_t uClass = arrClasses[i];
+
+				// character is not blocked from the last starter
+				if (nStarterIndex != nCount && (uLastClass < uClass || uLastClass == 0U))
+				{
+					if (const std::uint32_t uComposite = ComposeCodepoints(arrCodepoints[nStarterIndex], uCodepoint); uComposite != 0U)
+					{
+						arrCodepoints[nStarterIndex] = uComposite;
+						continue;
+					}
+				}
+
+				if (uClass == 0U)
+					nStarterIndex = nComposedCount;
+
+				uLastClass = uClass;
+				arrCodepoints[nComposedCount] = uCodepoint;
+				arrClasses[nComposedCount] = uClass;
+				++nComposedCount;
+			}
+
+			nCount = nComposedCount;
+		}
+
+		const std::size_t nKeepCount = ((bKeepStarter && nForm == NORMALIZATION_FORM_C && nCount > 0U && arrClasses[nCount - 1U] == 0U) ? 1U : 0U);
+		for (std::size_t i = 0U; i < nCount - nKeepCount; ++i)
+		{
+			if (!EncodeNormalizeCodepoint(arrCodepoints[i], tszDestination, tszDestinationEnd))
+				return false;
+		}
+
+		if (nKeepCount != 0U)
+		{
+			arrCodepoints[0] = arrCodepoints[nCount - 1U];
+			arrClasses[0] = 0U;
+		}
+
+		segment.nCount = nKeepCount;
+		return true;
+	}
+
+	/// perform the quick check of the string normalization form
+	/// @param[out] tszStableEnd end of the leading part of the string that is already normalized and can't be changed by the following characters, set only when the result is not 'NORMALIZATION_CHECK_YES'
+	/// @returns: result of the quick check
+	template <typename T>
+	ENormalizationCheck QuickCheckNormalize(const ENormalizationForm nForm, const T* tszSource, const T* tszSourceEnd, const T*& tszStableEnd)
+	{
+		const std::uint32_t uBound = GetNormalizeQuickCheckBound(nForm);
+		// only ASCII characters can be skipped by single unit of UTF-8 string
+		const std::uint32_t uSkipBound = (sizeof(T) == 1U ? Min(uBound, 0x80U) : uBound);
+		// properties of the character before which the normalization can start
+		const std::uint16_t uUnstableMask = NORMALIZE_COMBINING_CLASS_MASK | (nForm == NORMALIZATION_FORM_C ? (NORMALIZE_NFC_NO | NORMALIZE_NFC_MAYBE) : NORMALIZE_DECOMPOSABLE);
+
+		ENormalizationCheck nResult = NORMALIZATION_CHECK_YES;
+		const T* tszStable = tszSource;
+		std::uint8_t uLastClass = 0U;
+		while (true)
+		{
+			if (const T* tszSkipBegin = tszSource; (SkipNormalizedBlocks(tszSource, tszSourceEnd, uSkipBound), tszSource != tszSkipBegin))
+			{
+				uLastClass = 0U;
+
+				if (nResult == NORMALIZATION_CHECK_YES)
+					tszStable = tszSource - 1;
+			}
+
+			if (tszSource == tszSourceEnd || *tszSource == '\0')
+				break;
+
+			const T* tszCurrent = tszSource;
+			if (static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<T>>(*tszSource)) < uSkipBound)
+			{
+				++tszSource;
+				uLastClass = 0U;
+
+				if (nResult == NORMALIZATION_CHECK_YES)
+					tszStable = tszCurrent;
+
+				continue;
+			}
+
+			const std::uint32_t uCodepoint = DecodeNormalizeCodepoint(tszSource, tszSourceEnd);
+			if (uCodepoint < uBound)
+			{
+				uLastClass = 0U;
+
+				if (nResult == NORMALIZATION_CHECK_YES)
+					tszStable = tszCurrent;
+
+				continue;
+			}
+
+			const std::uint16_t uProperties = GetNormalizeProperties(uCodepoint);
+			const std::uint8_t uClass = static_cast<std::uint8_t>(uProperties & NORMALIZE_COMBINING_CLASS_MASK);
+
+			if ((uClass != 0U && uLastClass > uClass) || (uProperties & (nForm == NORMALIZATION_FORM_C ? NORMALIZE_NFC_NO : NORMALIZE_DECOMPOSABLE)) != 0U)
+			{
+				if (nResult == NORMALIZATION_CHECK_YES)
+					tszStableEnd = tszStable;
+
+				return NORMALIZATION_CHECK_NO;
+			}
+
+			if (nResult == NORMALIZATION_CHECK_YES)
+			{
+				if ((uProperties & NORMALIZE_NFC_MAYBE) != 0U && nForm == NORMALIZATION_FORM_C)
+				{
+					nResult = NORMALIZATION_CHECK_MAYBE;
+					tszStableEnd = tszStable;
+				}
+				else if ((uProperties & uUnstableMask) == 0U)
+					tszStable = tszCurrent;
+			}
+
+			uLastClass = uClass;
+		}
+
+		return nResult;
+	}
+}
+
+/// check whether the string is in the given normalization form, without decomposition or composition of it, alternative of 'IsNormalizedString()'
+/// @remarks: verifies the canonical ordering of non-starters and the quick check properties of each character, the leading characters that can't be affected by normalization are skipped by the blocks
+/// @returns: 'NORMALIZATION_CHECK_YES' if the string is in the normalization form, 'NORMALIZATION_CHECK_NO' if it is not, 'NORMALIZATION_CHECK_MAYBE' if the result of NFC quick check is inconclusive
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+ENormalizationCheck StringNormalizeQuickCheck(const ENormalizationForm nForm, const T* tszSourceBegin, const T* tszSourceEnd = nullptr)
+{
+	const T* tszStableEnd;
+	return DETAIL::QuickCheckNormalize(nForm, tszSourceBegin, tszSourceEnd, tszStableEnd);
+}
+
+/// convert string to the given normalization form, alternative of 'NormalizeString()'
+/// @param[in] nDestinationSize size of the destination buffer including the terminating null, in characters. normalized string is at most 3 times longer than the source for UTF-8 strings and 4 times longer for wide strings
+/// @remarks: locale-independent. the source is first checked with 'StringNormalizeQuickCheck()' and nothing is written when it is already normalized, otherwise the leading part that passed the check is copied as is. bytes of ill-formed UTF-8 sequences and unpaired UTF-16 surrogates are passed through unchanged. sequences of more than 63 successive non-starters are normalized in parts
+/// @returns: @a`tszSourceBegin` if the source is already in the normalization form, pointer to the normalized null-terminated string in the destination buffer otherwise, or null if the destination buffer is too small
+template <typename T> requires (std::is_same_v<T, char> || std::is_same_v<T, wchar_t>)
+const T* StringNormalize(T* tszDestination, std::size_t nDestinationSize, const ENormalizationForm nForm, const T* tszSourceBegin, const T* tszSourceEnd = nullptr)
+{
+	const T* tszStableEnd;
+	if (DETAIL::QuickCheckNormalize(nForm, tszSourceBegin, tszSourceEnd, tszStableEnd) == NORMALIZATION_CHECK_YES)
+		return tszSourceBegin;
+
+	// reserve space for null terminator
+	const std::size_t nStableLength = static_cast<std::size_t>(tszStableEnd - tszSourceBegin);
+	if (nDestinationSize <= nStableLength)
+		return nullptr;
+
+	MemoryCopy(tszDestination, tszSourceBegin, nStableLength * sizeof(T));
+	T* tszDestinationCurrent = tszDestination + nStableLength;
+	const T* tszDestinationEnd = tszDestination + nDestinationSize - 1U;
+	tszSourceBegin = tszStableEnd;
+
+	DETAIL::NormalizeSegment_t segment;
+	std::uint32_t arrDecomposition[DETAIL::kNormalizeDecompositionCapacity];
+	while (tszSourceBegin != tszSourceEnd && *tszSourceBegin != '\0')
+	{
+		const std::size_t nDecompositionCount = DETAIL::DecomposeCodepoint(DETAIL::DecodeNormalizeCodepoint(tszSourceBegin, tszSourceEnd), arrDecomposition);
+
+		for (std::size_t i = 0U; i < nDecompositionCount; ++i)
+		{
+			const std::uint8_t uClass = static_cast<std::uint8_t>(DETAIL::GetNormalizeProperties(arrDecomposition[i]) & NORMALIZE_COMBINING_CLASS_MASK);
+
+			// flush the previous segment on the next starter or when the buffer is full
+			if ((uClass == 0U && segment.nCount > 0U) || segment.nCount == DETAIL::kNormalizeSegmentCapacity)
+			{
+				if (!DETAIL::FlushNormalizeSegment(segment, nForm, tszDestinationCurrent, tszDestinationEnd, uClass == 0U))
+					return nullptr;
+			}
+
+			segment.arrCodepoints[segment.nCount] = arrDecomposition[i];
+			segment.arrClasses[segment.nCount] = uClass;
+			++segment.nCount;
+		}
+	}
+
+	if (!DETAIL::FlushNormalizeSegment(segment, nForm, tszDestinationCurrent, tszDestinationEnd, false))
+		return nullptr;
+
+	*tszDestinationCurrent = '\0';
+	return tszDestination;
+}
+#endif
@@ -0,0 +1,1380 @@
+#ifndef Q_CRT_STRING_NORMALIZE_TABLES_IMPLEMENTATION
+#define Q_CRT_STRING_NORMALIZE_TABLES_IMPLEMENTATION
+// autogenerated with 'q-tee/tools/unicode-wnorm', Unicode 14.0.0
+// @note: three-stage trie of canonical combining class and quick check properties, block sizes: 256/16, sliding window size: 16, approximate total size: ~28KB
+
+enum ENormalizePropertyFlags_t : std::uint16_t
+{
+	NORMALIZE_DECOMPOSABLE = 0x100, // has canonical decomposition, 'NFD_Quick_Check=No'
+	NORMALIZE_NFC_NO = 0x200, // 'NFC_Quick_Check=No'
+	NORMALIZE_NFC_MAYBE = 0x400, // 'NFC_Quick_Check=Maybe'
+	NORMALIZE_COMBINING_CLASS_MASK = 0xFF
+};
+
+// layout of the lookup tables
+constexpr std::uint32_t kNormalizePropertyPlaneShift = 8U;
+constexpr std::uint32_t kNormalizePropertyBlockShift = 4U;
+// codepoints starting from this have neither canonical combining class nor decomposition
+constexpr std::uint32_t kNormalizePropertyCodepointLimit = 0x30000;
+
+// mapping of codepoint plane block to the offsets block index
+constexpr std::uint8_t arrNormalizePropertyIndices[768] =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+	0x10, 0x11, 0x12, 0x13, 0x12, 0x12, 0x12, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+	0x1D, 0x1E, 0x1F, 0x20, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x21, 0x12, 0x22, 0x23, 0x12, 0x12,
+	0x24, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x25, 0x12, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2A, 0x2A, 0x2A,
+	0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+	0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A,
+	0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2B, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x2C, 0x2D, 0x2E, 0x12, 0x12, 0x2F, 0x12,
+	0x12, 0x30, 0x31, 0x32, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x33, 0x12, 0x12, 0x34, 0x35, 0x36,
+	0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x12, 0x42, 0x43, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x44, 0x45, 0x12, 0x12, 0x12, 0x46,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x47, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x48, 0x49, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x4A, 0x45, 0x4B, 0x12, 0x12, 0x12, 0x12, 0x12, 0x4C, 0x4D, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x2C, 0x2C, 0x4E, 0x12, 0x12, 0x12, 0x12, 0x12
+};
+
+// mapping of codepoint block to lookup table block offset
+constexpr std::uint16_t arrNormalizePropertyOffsets[1264] =
+{
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0020, 0x0010, 0x002F,
+	0x003E, 0x004E, 0x0048, 0x005D, 0x006C, 0x004C, 0x0048, 0x003F,
+	0x0000, 0x0000, 0x007A, 0x0089, 0x0003, 0x0099, 0x004A, 0x00A8,
+	0x003E, 0x0042, 0x0093, 0x0078, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x00B8, 0x00C6, 0x00D5, 0x00E2, 0x00F2, 0x0102, 0x010F, 0x011F,
+	0x012E, 0x0089, 0x0006, 0x0089, 0x013E, 0x014D, 0x0000, 0x0000,
+	0x015D, 0x0080, 0x0000, 0x0080, 0x0000, 0x015D, 0x0000, 0x016C,
+	0x0179, 0x0000, 0x0000, 0x0000, 0x0188, 0x0198, 0x01A0, 0x01AA,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x01B9, 0x01C7, 0x01D7, 0x01E7, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x01F7, 0x0205, 0x0000, 0x020C, 0x021C, 0x0000, 0x022C,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x023C, 0x0249, 0x0258, 0x0000,
+	0x0000, 0x0267, 0x0000, 0x0277, 0x0286, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0291, 0x029F,
+	0x0000, 0x02AD, 0x02B9, 0x0000, 0x0000, 0x02C7, 0x0000, 0x0000,
+	0x0000, 0x02D3, 0x0000, 0x0000, 0x0292, 0x02E3, 0x02F1, 0x0301,
+	0x0000, 0x0000, 0x0080, 0x0311, 0x031E, 0x032D, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x033D, 0x034C, 0x035A, 0x0000, 0x036A,
+	0x0000, 0x0000, 0x0000, 0x0379, 0x031E, 0x0386, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0395, 0x031E, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x033D, 0x03A2, 0x03B0, 0x0000, 0x0000,
+	0x0000, 0x0085, 0x0000, 0x03BE, 0x03CD, 0x03C5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0395, 0x03DB, 0x03E9, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0395, 0x03F9, 0x0407, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x040E, 0x03CD, 0x03C5, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x041D, 0x042D, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x043D, 0x0448, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0454, 0x045F, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x046B, 0x0000, 0x0476, 0x0120, 0x0484, 0x0491, 0x04A0,
+	0x04B0, 0x0120, 0x0484, 0x0491, 0x04BA, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x04C4, 0x04D3, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x04DE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04ED, 0x04F7,
+	0x0000, 0x0000, 0x04FF, 0x0507, 0x0514, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0517, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0527, 0x0000, 0x0533, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0541, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x054F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0559, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0565, 0x0000, 0x0000, 0x0000, 0x0000, 0x0575, 0x0580,
+	0x0000, 0x0000, 0x0000, 0x0590, 0x059F, 0x0000, 0x0000, 0x0000,
+	0x05AE, 0x0087, 0x0000, 0x05BD, 0x05CD, 0x0000, 0x05D2, 0x05DF,
+	0x0000, 0x0000, 0x05E5, 0x0000, 0x0000, 0x0000, 0x05F1, 0x05FF,
+	0x0000, 0x0000, 0x0000, 0x039A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x060F, 0x061F, 0x062D,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x063D, 0x064D, 0x064E, 0x0658,
+	0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E,
+	0x003E, 0x0668, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x0678,
+	0x003E, 0x01A2, 0x003E, 0x003E, 0x01A2, 0x0688, 0x003E, 0x0697,
+	0x003E, 0x003E, 0x003E, 0x06A7, 0x06B6, 0x06C3, 0x06D0, 0x06E0,
+	0x03BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x06F0, 0x06FF, 0x070F,
+	0x0000, 0x0000, 0x0719, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0725, 0x022E, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000,
+	0x0731, 0x0000, 0x0238, 0x0000, 0x0740, 0x0000, 0x0747, 0x0755,
+	0x0755, 0x0000, 0x0004, 0x0000, 0x0000, 0x0000, 0x0765, 0x0000,
+	0x0000, 0x0000, 0x0773, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0713, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0576, 0x0783,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0785,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x064E, 0x064E,
+	0x0000, 0x0000, 0x0795, 0x0000, 0x0230, 0x07A5, 0x07B1, 0x07C1,
+	0x0000, 0x07CF, 0x0230, 0x07A5, 0x07B1, 0x07C1, 0x0000, 0x07DE,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0576, 0x07ED,
+	0x0000, 0x0577, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0783,
+	0x0531, 0x0000, 0x0788, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0533, 0x0000, 0x064E, 0x0783,
+	0x0000, 0x0000, 0x07FB, 0x0000, 0x0000, 0x0572, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0809, 0x0575, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0819, 0x0829, 0x0000, 0x0000, 0x0531,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x031E, 0x0000,
+	0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E,
+	0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E,
+	0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E, 0x003E,
+	0x003E, 0x003E, 0x0078, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0839, 0x0839, 0x0839, 0x0839, 0x0839, 0x0839, 0x0839, 0x0839,
+	0x0839, 0x0839, 0x0839, 0x0839, 0x0839, 0x0839, 0x0839, 0x0839,
+	0x083B, 0x084B, 0x0859, 0x0839, 0x0839, 0x0839, 0x083B, 0x0839,
+	0x0839, 0x0839, 0x0839, 0x0839, 0x0839, 0x0863, 0x0000, 0x0000,
+	0x0000, 0x086D, 0x082F, 0x087C, 0x088C, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x089C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04DE,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08AC, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0176,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x08AF, 0x0000, 0x0000, 0x08BF, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08CF, 0x0000,
+	0x0000, 0x0000, 0x08DB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x08E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x08F0, 0x08AC, 0x0000, 0x0000,
+	0x0900, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0531, 0x0000, 0x0000, 0x0910,
+	0x0000, 0x0232, 0x007E, 0x0916, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0926, 0x0000, 0x092F, 0x05FE, 0x0000, 0x0000, 0x0000, 0x0809,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x093F, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x094A, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0951, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x095C, 0x034C, 0x03C5, 0x096B, 0x07F6,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0979, 0x036A, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0989, 0x0998, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x099C, 0x09AC, 0x099B, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0785, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x09BC, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0538, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x09C4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x09D4, 0x0809, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0575, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0533, 0x0530, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x052E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0785, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x04D8, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0530, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09E4,
+	0x0000, 0x0000, 0x0000, 0x07F4, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x09F4,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x09F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x082B, 0x0A06, 0x0A14,
+	0x0A21, 0x0000, 0x0A2D, 0x082E, 0x0A3D, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0924, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0A4D, 0x0A55, 0x0A63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x036A, 0x0000, 0x0000, 0x0000, 0x0579, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A73, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0A7F, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0839, 0x083B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
+
+// lookup table for the property indices
+constexpr std::uint8_t arrNormalizePropertyLUT[2703] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x04, 0x05, 0x05, 0x05, 0x05,
+	0x04, 0x06, 0x05, 0x05, 0x05, 0x05, 0x07, 0x07, 0x08, 0x08, 0x08, 0x08, 0x09, 0x09, 0x05, 0x05,
+	0x05, 0x05, 0x08, 0x08, 0x05, 0x05, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x05, 0x05, 0x05, 0x05, 0x03,
+	0x03, 0x03, 0x0C, 0x0C, 0x02, 0x0C, 0x0C, 0x0D, 0x03, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x05,
+	0x05, 0x00, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x03, 0x04, 0x05, 0x05, 0x03, 0x0E, 0x0F,
+	0x0F, 0x0E, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x03, 0x03, 0x03, 0x05,
+	0x03, 0x03, 0x03, 0x11, 0x05, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03,
+	0x03, 0x05, 0x03, 0x03, 0x11, 0x12, 0x03, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+	0x1C, 0x1C, 0x1D, 0x1E, 0x1F, 0x00, 0x20, 0x00, 0x21, 0x22, 0x00, 0x03, 0x05, 0x00, 0x1B, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x23,
+	0x24, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x28, 0x23, 0x24, 0x25, 0x29, 0x2A, 0x02,
+	0x02, 0x08, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x03, 0x03, 0x05, 0x2B, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x03, 0x05, 0x03, 0x00, 0x00, 0x03,
+	0x03, 0x00, 0x05, 0x03, 0x03, 0x05, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x03, 0x03, 0x05, 0x03, 0x03, 0x05, 0x05,
+	0x05, 0x03, 0x05, 0x05, 0x03, 0x05, 0x03, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03, 0x05, 0x03,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03,
+	0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x03,
+	0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x05, 0x03, 0x03, 0x05, 0x03, 0x03, 0x05, 0x03, 0x03, 0x03, 0x05, 0x05,
+	0x05, 0x26, 0x27, 0x28, 0x03, 0x03, 0x03, 0x05, 0x03, 0x03, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x03, 0x05,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x2E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2E, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x35, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x2E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x38,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x39, 0x3A, 0x10, 0x3B, 0x10, 0x10, 0x00, 0x10, 0x00, 0x3A, 0x3A, 0x3A, 0x3A, 0x00, 0x00,
+	0x3A, 0x10, 0x03, 0x03, 0x2E, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x2E, 0x2E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2E, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x05,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x00, 0x05,
+	0x03, 0x03, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+	0x01, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+	0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x2E, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x03, 0x03, 0x00, 0x0A, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x03,
+	0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x05,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x03, 0x03, 0x0F, 0x3C, 0x05, 0x07, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x12,
+	0x12, 0x05, 0x3D, 0x03, 0x0E, 0x05, 0x03, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01,
+	0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x10, 0x01, 0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x10,
+	0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x00,
+	0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x10, 0x01, 0x01, 0x10, 0x10,
+	0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x00, 0x00,
+	0x03, 0x03, 0x0A, 0x0A, 0x03, 0x03, 0x03, 0x03, 0x0A, 0x0A, 0x0A, 0x03, 0x03, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x0A, 0x0A, 0x03, 0x05, 0x03, 0x0A, 0x0A, 0x05, 0x05, 0x05, 0x05, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D,
+	0x12, 0x04, 0x11, 0x3E, 0x3E, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x03, 0x05, 0x00, 0x00,
+	0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x00, 0x10, 0x10,
+	0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00, 0x10, 0x10, 0x00, 0x10,
+	0x10, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x03, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x03, 0x03, 0x03, 0x05, 0x03, 0x05, 0x05, 0x05,
+	0x00, 0x00, 0x03, 0x05, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+	0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x2E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+	0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x2F, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x01, 0x01, 0x30, 0x01, 0x00, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x2E, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x2F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x2E, 0x2E, 0x00, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x0A, 0x0A, 0x0A,
+	0x00, 0x00, 0x00, 0x42, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x03, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// canonical combining class and 'ENormalizePropertyFlags_t' flags for the property indices
+constexpr std::uint16_t arrNormalizeProperties[67] =
+{
+	0x0000, 0x0100, 0x04E6, 0x00E6, 0x00E8, 0x00DC, 0x04D8, 0x00CA,
+	0x04DC, 0x04CA, 0x0001, 0x0401, 0x03E6, 0x04F0, 0x00E9, 0x00EA,
+	0x0300, 0x00DE, 0x00E4, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E,
+	0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016,
+	0x0017, 0x0018, 0x0019, 0x001E, 0x001F, 0x0020, 0x001B, 0x001C,
+	0x001D, 0x0021, 0x0022, 0x0023, 0x0024, 0x0407, 0x0009, 0x0007,
+	0x0400, 0x0054, 0x045B, 0x0409, 0x0067, 0x006B, 0x0076, 0x007A,
+	0x00D8, 0x0081, 0x0082, 0x0084, 0x00D6, 0x00DA, 0x00E0, 0x0408,
+	0x001A, 0x0006, 0x00E2
+};
+
+// sorted decomposable codepoints in high 20 bits and offset of their full canonical decomposition in low 12 bits, last entry is the end sentinel
+constexpr std::uint32_t arrNormalizeDecompositionKeys[2062] =
+{
+	0x000C0000, 0x000C1002, 0x000C2004, 0x000C3006, 0x000C4008, 0x000C500A, 0x000C700C, 0x000C800E,
+	0x000C9010, 0x000CA012, 0x000CB014, 0x000CC016, 0x000CD018, 0x000CE01A, 0x000CF01C, 0x000D101E,
+	0x000D2020, 0x000D3022, 0x000D4024, 0x000D5026, 0x000D6028, 0x000D902A, 0x000DA02C, 0x000DB02E,
+	0x000DC030, 0x000DD032, 0x000E0034, 0x000E1036, 0x000E2038, 0x000E303A, 0x000E403C, 0x000E503E,
+	0x000E7040, 0x000E8042, 0x000E9044, 0x000EA046, 0x000EB048, 0x000EC04A, 0x000ED04C, 0x000EE04E,
+	0x000EF050, 0x000F1052, 0x000F2054, 0x000F3056, 0x000F4058, 0x000F505A, 0x000F605C, 0x000F905E,
+	0x000FA060, 0x000FB062, 0x000FC064, 0x000FD066, 0x000FF068, 0x0010006A, 0x0010106C, 0x0010206E,
+	0x00103070, 0x00104072, 0x00105074, 0x00106076, 0x00107078, 0x0010807A, 0x0010907C, 0x0010A07E,
+	0x0010B080, 0x0010C082, 0x0010D084, 0x0010E086, 0x0010F088, 0x0011208A, 0x0011308C, 0x0011408E,
+	0x00115090, 0x00116092, 0x00117094, 0x00118096, 0x00119098, 0x0011A09A, 0x0011B09C, 0x0011C09E,
+	0x0011D0A0, 0x0011E0A2, 0x0011F0A4, 0x001200A6, 0x001210A8, 0x001220AA, 0x001230AC, 0x001240AE,
+	0x001250B0, 0x001280B2, 0x001290B4, 0x0012A0B6, 0x0012B0B8, 0x0012C0BA, 0x0012D0BC, 0x0012E0BE,
+	0x0012F0C0, 0x001300C2, 0x001340C4, 0x001350C6, 0x001360C8, 0x001370CA, 0x001390CC, 0x0013A0CE,
+	0x0013B0D0, 0x0013C0D2, 0x0013D0D4, 0x0013E0D6, 0x001430D8, 0x001440DA, 0x001450DC, 0x001460DE,
+	0x001470E0, 0x001480E2, 0x0014C0E4, 0x0014D0E6, 0x0014E0E8, 0x0014F0EA, 0x001500EC, 0x001510EE,
+	0x001540F0, 0x001550F2, 0x001560F4, 0x001570F6, 0x001580F8, 0x001590FA, 0x0015A0FC, 0x0015B0FE,
+	0x0015C100, 0x0015D102, 0x0015E104, 0x0015F106, 0x00160108, 0x0016110A, 0x0016210C, 0x0016310E,
+	0x00164110, 0x00165112, 0x00168114, 0x00169116, 0x0016A118, 0x0016B11A, 0x0016C11C, 0x0016D11E,
+	0x0016E120, 0x0016F122, 0x00170124, 0x00171126, 0x00172128, 0x0017312A, 0x0017412C, 0x0017512E,
+	0x00176130, 0x00177132, 0x00178134, 0x00179136, 0x0017A138, 0x0017B13A, 0x0017C13C, 0x0017D13E,
+	0x0017E140, 0x001A0142, 0x001A1144, 0x001AF146, 0x001B0148, 0x001CD14A, 0x001CE14C, 0x001CF14E,
+	0x001D0150, 0x001D1152, 0x001D2154, 0x001D3156, 0x001D4158, 0x001D515A, 0x001D615D, 0x001D7160,
+	0x001D8163, 0x001D9166, 0x001DA169, 0x001DB16C, 0x001DC16F, 0x001DE172, 0x001DF175, 0x001E0178,
+	0x001E117B, 0x001E217E, 0x001E3180, 0x001E6182, 0x001E7184, 0x001E8186, 0x001E9188, 0x001EA18A,
+	0x001EB18C, 0x001EC18E, 0x001ED191, 0x001EE194, 0x001EF196, 0x001F0198, 0x001F419A, 0x001F519C,
+	0x001F819E, 0x001F91A0, 0x001FA1A2, 0x001FB1A5, 0x001FC1A8, 0x001FD1AA, 0x001FE1AC, 0x001FF1AE,
+	0x002001B0, 0x002011B2, 0x002021B4, 0x002031B6, 0x002041B8, 0x002051BA, 0x002061BC, 0x002071BE,
+	0x002081C0, 0x002091C2, 0x0020A1C4, 0x0020B1C6, 0x0020C1C8, 0x0020D1CA, 0x0020E1CC, 0x0020F1CE,
+	0x002101D0, 0x002111D2, 0x002121D4, 0x002131D6, 0x002141D8, 0x002151DA, 0x002161DC, 0x002171DE,
+	0x002181E0, 0x002191E2, 0x0021A1E4, 0x0021B1E6, 0x0021E1E8, 0x0021F1EA, 0x002261EC, 0x002271EE,
+	0x002281F0, 0x002291F2, 0x0022A1F4, 0x0022B1F7, 0x0022C1FA, 0x0022D1FD, 0x0022E200, 0x0022F202,
+	0x00230204, 0x00231207, 0x0023220A, 0x0023320C, 0x0034020E, 0x0034120F, 0x00343210, 0x00344211,
+	0x00374213, 0x0037E214, 0x00385215, 0x00386217, 0x00387219, 0x0038821A, 0x0038921C, 0x0038A21E,
+	0x0038C220, 0x0038E222, 0x0038F224, 0x00390226, 0x003AA229, 0x003AB22B, 0x003AC22D, 0x003AD22F,
+	0x003AE231, 0x003AF233, 0x003B0235, 0x003CA238, 0x003CB23A, 0x003CC23C, 0x003CD23E, 0x003CE240,
+	0x003D3242, 0x003D4244, 0x00400246, 0x00401248, 0x0040324A, 0x0040724C, 0x0040C24E, 0x0040D250,
+	0x0040E252, 0x00419254, 0x00439256, 0x00450258, 0x0045125A, 0x0045325C, 0x0045725E, 0x0045C260,
+	0x0045D262, 0x0045E264, 0x00476266, 0x00477268, 0x004C126A, 0x004C226C, 0x004D026E, 0x004D1270,
+	0x004D2272, 0x004D3274, 0x004D6276, 0x004D7278, 0x004DA27A, 0x004DB27C, 0x004DC27E, 0x004DD280,
+	0x004DE282, 0x004DF284, 0x004E2286, 0x004E3288, 0x004E428A, 0x004E528C, 0x004E628E, 0x004E7290,
+	0x004EA292, 0x004EB294, 0x004EC296, 0x004ED298, 0x004EE29A, 0x004EF29C, 0x004F029E, 0x004F12A0,
+	0x004F22A2, 0x004F32A4, 0x004F42A6, 0x004F52A8, 0x004F82AA, 0x004F92AC, 0x006222AE, 0x006232B0,
+	0x006242B2, 0x006252B4, 0x006262B6, 0x006C02B8, 0x006C22BA, 0x006D32BC, 0x009292BE, 0x009312C0,
+	0x009342C2, 0x009582C4, 0x009592C6, 0x0095A2C8, 0x0095B2CA, 0x0095C2CC, 0x0095D2CE, 0x0095E2D0,
+	0x0095F2D2, 0x009CB2D4, 0x009CC2D6, 0x009DC2D8, 0x009DD2DA, 0x009DF2DC, 0x00A332DE, 0x00A362E0,
+	0x00A592E2, 0x00A5A2E4, 0x00A5B2E6, 0x00A5E2E8, 0x00B482EA, 0x00B4B2EC, 0x00B4C2EE, 0x00B5C2F0,
+	0x00B5D2F2, 0x00B942F4, 0x00BCA2F6, 0x00BCB2F8, 0x00BCC2FA, 0x00C482FC, 0x00CC02FE, 0x00CC7300,
+	0x00CC8302, 0x00CCA304, 0x00CCB306, 0x00D4A309, 0x00D4B30B, 0x00D4C30D, 0x00DDA30F, 0x00DDC311,
+	0x00DDD313, 0x00DDE316, 0x00F43318, 0x00F4D31A, 0x00F5231C, 0x00F5731E, 0x00F5C320, 0x00F69322,
+	0x00F73324, 0x00F75326, 0x00F76328, 0x00F7832A, 0x00F8132C, 0x00F9332E, 0x00F9D330, 0x00FA2332,
+	0x00FA7334, 0x00FAC336, 0x00FB9338, 0x0102633A, 0x01B0633C, 0x01B0833E, 0x01B0A340, 0x01B0C342,
+	0x01B0E344, 0x01B12346, 0x01B3B348, 0x01B3D34A, 0x01B4034C, 0x01B4134E, 0x01B43350, 0x01E00352,
+	0x01E01354, 0x01E02356, 0x01E03358, 0x01E0435A, 0x01E0535C, 0x01E0635E, 0x01E07360, 0x01E08362,
+	0x01E09365, 0x01E0A368, 0x01E0B36A, 0x01E0C36C, 0x01E0D36E, 0x01E0E370, 0x01E0F372, 0x01E10374,
+	0x01E11376, 0x01E12378, 0x01E1337A, 0x01E1437C, 0x01E1537F, 0x01E16382, 0x01E17385, 0x01E18388,
+	0x01E1938A, 0x01E1A38C, 0x01E1B38E, 0x01E1C390, 0x01E1D393, 0x01E1E396, 0x01E1F398, 0x01E2039A,
+	0x01E2139C, 0x01E2239E, 0x01E233A0, 0x01E243A2, 0x01E253A4, 0x01E263A6, 0x01E273A8, 0x01E283AA,
+	0x01E293AC, 0x01E2A3AE, 0x01E2B3B0, 0x01E2C3B2, 0x01E2D3B4, 0x01E2E3B6, 0x01E2F3B9, 0x01E303BC,
+	0x01E313BE, 0x01E323C0, 0x01E333C2, 0x01E343C4, 0x01E353C6, 0x01E363C8, 0x01E373CA, 0x01E383CC,
+	0x01E393CF, 0x01E3A3D2, 0x01E3B3D4, 0x01E3C3D6, 0x01E3D3D8, 0x01E3E3DA, 0x01E3F3DC, 0x01E403DE,
+	0x01E413E0, 0x01E423E2, 0x01E433E4, 0x01E443E6, 0x01E453E8, 0x01E463EA, 0x01E473EC, 0x01E483EE,
+	0x01E493F0, 0x01E4A3F2, 0x01E4B3F4, 0x01E4C3F6, 0x01E4D3F9, 0x01E4E3FC, 0x01E4F3FF, 0x01E50402,
+	0x01E51405, 0x01E52408, 0x01E5340B, 0x01E5440E, 0x01E55410, 0x01E56412, 0x01E57414, 0x01E58416,
+	0x01E59418, 0x01E5A41A, 0x01E5B41C, 0x01E5C41E, 0x01E5D421, 0x01E5E424, 0x01E5F426, 0x01E60428,
+	0x01E6142A, 0x01E6242C, 0x01E6342E, 0x01E64430, 0x01E65433, 0x01E66436, 0x01E67439, 0x01E6843C,
+	0x01E6943F, 0x01E6A442, 0x01E6B444, 0x01E6C446, 0x01E6D448, 0x01E6E44A, 0x01E6F44C, 0x01E7044E,
+	0x01E71450, 0x01E72452, 0x01E73454, 0x01E74456, 0x01E75458, 0x01E7645A, 0x01E7745C, 0x01E7845E,
+	0x01E79461, 0x01E7A464, 0x01E7B467, 0x01E7C46A, 0x01E7D46C, 0x01E7E46E, 0x01E7F470, 0x01E80472,
+	0x01E81474, 0x01E82476, 0x01E83478, 0x01E8447A, 0x01E8547C, 0x01E8647E, 0x01E87480, 0x01E88482,
+	0x01E89484, 0x01E8A486, 0x01E8B488, 0x01E8C48A, 0x01E8D48C, 0x01E8E48E, 0x01E8F490, 0x01E90492,
+	0x01E91494, 0x01E92496, 0x01E93498, 0x01E9449A, 0x01E9549C, 0x01E9649E, 0x01E974A0, 0x01E984A2,
+	0x01E994A4, 0x01E9B4A6, 0x01EA04A8, 0x01EA14AA, 0x01EA24AC, 0x01EA34AE, 0x01EA44B0, 0x01EA54B3,
+	0x01EA64B6, 0x01EA74B9, 0x01EA84BC, 0x01EA94BF, 0x01EAA4C2, 0x01EAB4C5, 0x01EAC4C8, 0x01EAD4CB,
+	0x01EAE4CE, 0x01EAF4D1, 0x01EB04D4, 0x01EB14D7, 0x01EB24DA, 0x01EB34DD, 0x01EB44E0, 0x01EB54E3,
+	0x01EB64E6, 0x01EB74E9, 0x01EB84EC, 0x01EB94EE, 0x01EBA4F0, 0x01EBB4F2, 0x01EBC4F4, 0x01EBD4F6,
+	0x01EBE4F8, 0x01EBF4FB, 0x01EC04FE, 0x01EC1501, 0x01EC2504, 0x01EC3507, 0x01EC450A, 0x01EC550D,
+	0x01EC6510, 0x01EC7513, 0x01EC8516, 0x01EC9518, 0x01ECA51A, 0x01ECB51C, 0x01ECC51E, 0x01ECD520,
+	0x01ECE522, 0x01ECF524, 0x01ED0526, 0x01ED1529, 0x01ED252C, 0x01ED352F, 0x01ED4532, 0x01ED5535,
+	0x01ED6538, 0x01ED753B, 0x01ED853E, 0x01ED9541, 0x01EDA544, 0x01EDB547, 0x01EDC54A, 0x01EDD54D,
+	0x01EDE550, 0x01EDF553, 0x01EE0556, 0x01EE1559, 0x01EE255C, 0x01EE355F, 0x01EE4562, 0x01EE5564,
+	0x01EE6566, 0x01EE7568, 0x01EE856A, 0x01EE956D, 0x01EEA570, 0x01EEB573, 0x01EEC576, 0x01EED579,
+	0x01EEE57C, 0x01EEF57F, 0x01EF0582, 0x01EF1585, 0x01EF2588, 0x01EF358A, 0x01EF458C, 0x01EF558E,
+	0x01EF6590, 0x01EF7592, 0x01EF8594, 0x01EF9596, 0x01F00598, 0x01F0159A, 0x01F0259C, 0x01F0359F,
+	0x01F045A2, 0x01F055A5, 0x01F065A8, 0x01F075AB, 0x01F085AE, 0x01F095B0, 0x01F0A5B2, 0x01F0B5B5,
+	0x01F0C5B8, 0x01F0D5BB, 0x01F0E5BE, 0x01F0F5C1, 0x01F105C4, 0x01F115C6, 0x01F125C8, 0x01F135CB,
+	0x01F145CE, 0x01F155D1, 0x01F185D4, 0x01F195D6, 0x01F1A5D8, 0x01F1B5DB, 0x01F1C5DE, 0x01F1D5E1,
+	0x01F205E4, 0x01F215E6, 0x01F225E8, 0x01F235EB, 0x01F245EE, 0x01F255F1, 0x01F265F4, 0x01F275F7,
+	0x01F285FA, 0x01F295FC, 0x01F2A5FE, 0x01F2B601, 0x01F2C604, 0x01F2D607, 0x01F2E60A, 0x01F2F60D,
+	0x01F30610, 0x01F31612, 0x01F32614, 0x01F33617, 0x01F3461A, 0x01F3561D, 0x01F36620, 0x01F37623,
+	0x01F38626, 0x01F39628, 0x01F3A62A, 0x01F3B62D, 0x01F3C630, 0x01F3D633, 0x01F3E636, 0x01F3F639,
+	0x01F4063C, 0x01F4163E, 0x01F42640, 0x01F43643, 0x01F44646, 0x01F45649, 0x01F4864C, 0x01F4964E,
+	0x01F4A650, 0x01F4B653, 0x01F4C656, 0x01F4D659, 0x01F5065C, 0x01F5165E, 0x01F52660, 0x01F53663,
+	0x01F54666, 0x01F55669, 0x01F5666C, 0x01F5766F, 0x01F59672, 0x01F5B674, 0x01F5D677, 0x01F5F67A,
+	0x01F6067D, 0x01F6167F, 0x01F62681, 0x01F63684, 0x01F64687, 0x01F6568A, 0x01F6668D, 0x01F67690,
+	0x01F68693, 0x01F69695, 0x01F6A697, 0x01F6B69A, 0x01F6C69D, 0x01F6D6A0, 0x01F6E6A3, 0x01F6F6A6,
+	0x01F706A9, 0x01F716AB, 0x01F726AD, 0x01F736AF, 0x01F746B1, 0x01F756B3, 0x01F766B5, 0x01F776B7,
+	0x01F786B9, 0x01F796BB, 0x01F7A6BD, 0x01F7B6BF, 0x01F7C6C1, 0x01F7D6C3, 0x01F806C5, 0x01F816C8,
+	0x01F826CB, 0x01F836CF, 0x01F846D3, 0x01F856D7, 0x01F866DB, 0x01F876DF, 0x01F886E3, 0x01F896E6,
+	0x01F8A6E9, 0x01F8B6ED, 0x01F8C6F1, 0x01F8D6F5, 0x01F8E6F9, 0x01F8F6FD, 0x01F90701, 0x01F91704,
+	0x01F92707, 0x01F9370B, 0x01F9470F, 0x01F95713, 0x01F96717, 0x01F9771B, 0x01F9871F, 0x01F99722,
+	0x01F9A725, 0x01F9B729, 0x01F9C72D, 0x01F9D731, 0x01F9E735, 0x01F9F739, 0x01FA073D, 0x01FA1740,
+	0x01FA2743, 0x01FA3747, 0x01FA474B, 0x01FA574F, 0x01FA6753, 0x01FA7757, 0x01FA875B, 0x01FA975E,
+	0x01FAA761, 0x01FAB765, 0x01FAC769, 0x01FAD76D, 0x01FAE771, 0x01FAF775, 0x01FB0779, 0x01FB177B,
+	0x01FB277D, 0x01FB3780, 0x01FB4782, 0x01FB6785, 0x01FB7787, 0x01FB878A, 0x01FB978C, 0x01FBA78E,
+	0x01FBB790, 0x01FBC792, 0x01FBE794, 0x01FC1795, 0x01FC2797, 0x01FC379A, 0x01FC479C, 0x01FC679F,
+	0x01FC77A1, 0x01FC87A4, 0x01FC97A6, 0x01FCA7A8, 0x01FCB7AA, 0x01FCC7AC, 0x01FCD7AE, 0x01FCE7B0,
+	0x01FCF7B2, 0x01FD07B4, 0x01FD17B6, 0x01FD27B8, 0x01FD37BB, 0x01FD67BE, 0x01FD77C0, 0x01FD87C3,
+	0x01FD97C5, 0x01FDA7C7, 0x01FDB7C9, 0x01FDD7CB, 0x01FDE7CD, 0x01FDF7CF, 0x01FE07D1, 0x01FE17D3,
+	0x01FE27D5, 0x01FE37D8, 0x01FE47DB, 0x01FE57DD, 0x01FE67DF, 0x01FE77E1, 0x01FE87E4, 0x01FE97E6,
+	0x01FEA7E8, 0x01FEB7EA, 0x01FEC7EC, 0x01FED7EE, 0x01FEE7F0, 0x01FEF7F2, 0x01FF27F3, 0x01FF37F6,
+	0x01FF47F8, 0x01FF67FB, 0x01FF77FD, 0x01FF8800, 0x01FF9802, 0x01FFA804, 0x01FFB806, 0x01FFC808,
+	0x01FFD80A, 0x0200080B, 0x0200180C, 0x0212680D, 0x0212A80E, 0x0212B80F, 0x0219A811, 0x0219B813,
+	0x021AE815, 0x021CD817, 0x021CE819, 0x021CF81B, 0x0220481D, 0x0220981F, 0x0220C821, 0x02224823,
+	0x02226825, 0x02241827, 0x02244829, 0x0224782B, 0x0224982D, 0x0226082F, 0x02262831, 0x0226D833,
+	0x0226E835, 0x0226F837, 0x02270839, 0x0227183B, 0x0227483D, 0x0227583F, 0x02278841, 0x02279843,
+	0x02280845, 0x02281847, 0x02284849, 0x0228584B, 0x0228884D, 0x0228984F, 0x022AC851, 0x022AD853,
+	0x022AE855, 0x022AF857, 0x022E0859, 0x022E185B, 0x022E285D, 0x022E385F, 0x022EA861, 0x022EB863,
+	0x022EC865, 0x022ED867, 0x02329869, 0x0232A86A, 0x02ADC86B, 0x0304C86D, 0x0304E86F, 0x03050871,
+	0x03052873, 0x03054875, 0x03056877, 0x03058879, 0x0305A87B, 0x0305C87D, 0x0305E87F, 0x03060881,
+	0x03062883, 0x03065885, 0x03067887, 0x03069889, 0x0307088B, 0x0307188D, 0x0307388F, 0x03074891,
+	0x03076893, 0x03077895, 0x03079897, 0x0307A899, 0x0307C89B, 0x0307D89D, 0x0309489F, 0x0309E8A1,
+	0x030AC8A3, 0x030AE8A5, 0x030B08A7, 0x030B28A9, 0x030B48AB, 0x030B68AD, 0x030B88AF, 0x030BA8B1,
+	0x030BC8B3, 0x030BE8B5, 0x030C08B7, 0x030C28B9, 0x030C58BB, 0x030C78BD, 0x030C98BF, 0x030D08C1,
+	0x030D18C3, 0x030D38C5, 0x030D48C7, 0x030D68C9, 0x030D78CB, 0x030D98CD, 0x030DA8CF, 0x030DC8D1,
+	0x030DD8D3, 0x030F48D5, 0x030F78D7, 0x030F88D9, 0x030F98DB, 0x030FA8DD, 0x030FE8DF, 0x0F9008E1,
+	0x0F9018E2, 0x0F9028E3, 0x0F9038E4, 0x0F9048E5, 0x0F9058E6, 0x0F9068E7, 0x0F9078E8, 0x0F9088E9,
+	0x0F9098EA, 0x0F90A8EB, 0x0F90B8EC, 0x0F90C8ED, 0x0F90D8EE, 0x0F90E8EF, 0x0F90F8F0, 0x0F9108F1,
+	0x0F9118F2, 0x0F9128F3, 0x0F9138F4, 0x0F9148F5, 0x0F9158F6, 0x0F9168F7, 0x0F9178F8, 0x0F9188F9,
+	0x0F9198FA, 0x0F91A8FB, 0x0F91B8FC, 0x0F91C8FD, 0x0F91D8FE, 0x0F91E8FF, 0x0F91F900, 0x0F920901,
+	0x0F921902, 0x0F922903, 0x0F923904, 0x0F924905, 0x0F925906, 0x0F926907, 0x0F927908, 0x0F928909,
+	0x0F92990A, 0x0F92A90B, 0x0F92B90C, 0x0F92C90D, 0x0F92D90E, 0x0F92E90F, 0x0F92F910, 0x0F930911,
+	0x0F931912, 0x0F932913, 0x0F933914, 0x0F934915, 0x0F935916, 0x0F936917, 0x0F937918, 0x0F938919,
+	0x0F93991A, 0x0F93A91B, 0x0F93B91C, 0x0F93C91D, 0x0F93D91E, 0x0F93E91F, 0x0F93F920, 0x0F940921,
+	0x0F941922, 0x0F942923, 0x0F943924, 0x0F944925, 0x0F945926, 0x0F946927, 0x0F947928, 0x0F948929,
+	0x0F94992A, 0x0F94A92B, 0x0F94B92C, 0x0F94C92D, 0x0F94D92E, 0x0F94E92F, 0x0F94F930, 0x0F950931,
+	0x0F951932, 0x0F952933, 0x0F953934, 0x0F954935, 0x0F955936, 0x0F956937, 0x0F957938, 0x0F958939,
+	0x0F95993A, 0x0F95A93B, 0x0F95B93C, 0x0F95C93D, 0x0F95D93E, 0x0F95E93F, 0x0F95F940, 0x0F960941,
+	0x0F961942, 0x0F962943, 0x0F963944, 0x0F964945, 0x0F965946, 0x0F966947, 0x0F967948, 0x0F968949,
+	0x0F96994A, 0x0F96A94B, 0x0F96B94C, 0x0F96C94D, 0x0F96D94E, 0x0F96E94F, 0x0F96F950, 0x0F970951,
+	0x0F971952, 0x0F972953, 0x0F973954, 0x0F974955, 0x0F975956, 0x0F976957, 0x0F977958, 0x0F978959,
+	0x0F97995A, 0x0F97A95B, 0x0F97B95C, 0x0F97C95D, 0x0F97D95E, 0x0F97E95F, 0x0F97F960, 0x0F980961,
+	0x0F981962, 0x0F982963, 0x0F983964, 0x0F984965, 0x0F985966, 0x0F986967, 0x0F987968, 0x0F988969,
+	0x0F98996A, 0x0F98A96B, 0x0F98B96C, 0x0F98C96D, 0x0F98D96E, 0x0F98E96F, 0x0F98F970, 0x0F990971,
+	0x0F991972, 0x0F992973, 0x0F993974, 0x0F994975, 0x0F995976, 0x0F996977, 0x0F997978, 0x0F998979,
+	0x0F99997A, 0x0F99A97B, 0x0F99B97C, 0x0F99C97D, 0x0F99D97E, 0x0F99E97F, 0x0F99F980, 0x0F9A0981,
+	0x0F9A1982, 0x0F9A2983, 0x0F9A3984, 0x0F9A4985, 0x0F9A5986, 0x0F9A6987, 0x0F9A7988, 0x0F9A8989,
+	0x0F9A998A, 0x0F9AA98B, 0x0F9AB98C, 0x0F9AC98D, 0x0F9AD98E, 0x0F9AE98F, 0x0F9AF990, 0x0F9B0991,
+	0x0F9B1992, 0x0F9B2993, 0x0F9B3994, 0x0F9B4995, 0x0F9B5996, 0x0F9B6997, 0x0F9B7998, 0x0F9B8999,
+	0x0F9B999A, 0x0F9BA99B, 0x0F9BB99C, 0x0F9BC99D, 0x0F9BD99E, 0x0F9BE99F, 0x0F9BF9A0, 0x0F9C09A1,
+	0x0F9C19A2, 0x0F9C29A3, 0x0F9C39A4, 0x0F9C49A5, 0x0F9C59A6, 0x0F9C69A7, 0x0F9C79A8, 0x0F9C89A9,
+	0x0F9C99AA, 0x0F9CA9AB, 0x0F9CB9AC, 0x0F9CC9AD, 0x0F9CD9AE, 0x0F9CE9AF, 0x0F9CF9B0, 0x0F9D09B1,
+	0x0F9D19B2, 0x0F9D29B3, 0x0F9D39B4, 0x0F9D49B5, 0x0F9D59B6, 0x0F9D69B7, 0x0F9D79B8, 0x0F9D89B9,
+	0x0F9D99BA, 0x0F9DA9BB, 0x0F9DB9BC, 0x0F9DC9BD, 0x0F9DD9BE, 0x0F9DE9BF, 0x0F9DF9C0, 0x0F9E09C1,
+	0x0F9E19C2, 0x0F9E29C3, 0x0F9E39C4, 0x0F9E49C5, 0x0F9E59C6, 0x0F9E69C7, 0x0F9E79C8, 0x0F9E89C9,
+	0x0F9E99CA, 0x0F9EA9CB, 0x0F9EB9CC, 0x0F9EC9CD, 0x0F9ED9CE, 0x0F9EE9CF, 0x0F9EF9D0, 0x0F9F09D1,
+	0x0F9F19D2, 0x0F9F29D3, 0x0F9F39D4, 0x0F9F49D5, 0x0F9F59D6, 0x0F9F69D7, 0x0F9F79D8, 0x0F9F89D9,
+	0x0F9F99DA, 0x0F9FA9DB, 0x0F9FB9DC, 0x0F9FC9DD, 0x0F9FD9DE, 0x0F9FE9DF, 0x0F9FF9E0, 0x0FA009E1,
+	0x0FA019E2, 0x0FA029E3, 0x0FA039E4, 0x0FA049E5, 0x0FA059E6, 0x0FA069E7, 0x0FA079E8, 0x0FA089E9,
+	0x0FA099EA, 0x0FA0A9EB, 0x0FA0B9EC, 0x0FA0C9ED, 0x0FA0D9EE, 0x0FA109EF, 0x0FA129F0, 0x0FA159F1,
+	0x0FA169F2, 0x0FA179F3, 0x0FA189F4, 0x0FA199F5, 0x0FA1A9F6, 0x0FA1B9F7, 0x0FA1C9F8, 0x0FA1D9F9,
+	0x0FA1E9FA, 0x0FA209FB, 0x0FA229FC, 0x0FA259FD, 0x0FA269FE, 0x0FA2A9FF, 0x0FA2BA00, 0x0FA2CA01,
+	0x0FA2DA02, 0x0FA2EA03, 0x0FA2FA04, 0x0FA30A05, 0x0FA31A06, 0x0FA32A07, 0x0FA33A08, 0x0FA34A09,
+	0x0FA35A0A, 0x0FA36A0B, 0x0FA37A0C, 0x0FA38A0D, 0x0FA39A0E, 0x0FA3AA0F, 0x0FA3BA10, 0x0FA3CA11,
+	0x0FA3DA12, 0x0FA3EA13, 0x0FA3FA14, 0x0FA40A15, 0x0FA41A16, 0x0FA42A17, 0x0FA43A18, 0x0FA44A19,
+	0x0FA45A1A, 0x0FA46A1B, 0x0FA47A1C, 0x0FA48A1D, 0x0FA49A1E, 0x0FA4AA1F, 0x0FA4BA20, 0x0FA4CA21,
+	0x0FA4DA22, 0x0FA4EA23, 0x0FA4FA24, 0x0FA50A25, 0x0FA51A26, 0x0FA52A27, 0x0FA53A28, 0x0FA54A29,
+	0x0FA55A2A, 0x0FA56A2B, 0x0FA57A2C, 0x0FA58A2D, 0x0FA59A2E, 0x0FA5AA2F, 0x0FA5BA30, 0x0FA5CA31,
+	0x0FA5DA32, 0x0FA5EA33, 0x0FA5FA34, 0x0FA60A35, 0x0FA61A36, 0x0FA62A37, 0x0FA63A38, 0x0FA64A39,
+	0x0FA65A3A, 0x0FA66A3B, 0x0FA67A3C, 0x0FA68A3D, 0x0FA69A3E, 0x0FA6AA3F, 0x0FA6BA40, 0x0FA6CA41,
+	0x0FA6DA43, 0x0FA70A44, 0x0FA71A45, 0x0FA72A46, 0x0FA73A47, 0x0FA74A48, 0x0FA75A49, 0x0FA76A4A,
+	0x0FA77A4B, 0x0FA78A4C, 0x0FA79A4D, 0x0FA7AA4E, 0x0FA7BA4F, 0x0FA7CA50, 0x0FA7DA51, 0x0FA7EA52,
+	0x0FA7FA53, 0x0FA80A54, 0x0FA81A55, 0x0FA82A56, 0x0FA83A57, 0x0FA84A58, 0x0FA85A59, 0x0FA86A5A,
+	0x0FA87A5B, 0x0FA88A5C, 0x0FA89A5D, 0x0FA8AA5E, 0x0FA8BA5F, 0x0FA8CA60, 0x0FA8DA61, 0x0FA8EA62,
+	0x0FA8FA63, 0x0FA90A64, 0x0FA91A65, 0x0FA92A66, 0x0FA93A67, 0x0FA94A68, 0x0FA95A69, 0x0FA96A6A,
+	0x0FA97A6B, 0x0FA98A6C, 0x0FA99A6D, 0x0FA9AA6E, 0x0FA9BA6F, 0x0FA9CA70, 0x0FA9DA71, 0x0FA9EA72,
+	0x0FA9FA73, 0x0FAA0A74, 0x0FAA1A75, 0x0FAA2A76, 0x0FAA3A77, 0x0FAA4A78, 0x0FAA5A79, 0x0FAA6A7A,
+	0x0FAA7A7B, 0x0FAA8A7C, 0x0FAA9A7D, 0x0FAAAA7E, 0x0FAABA7F, 0x0FAACA80, 0x0FAADA81, 0x0FAAEA82,
+	0x0FAAFA83, 0x0FAB0A84, 0x0FAB1A85, 0x0FAB2A86, 0x0FAB3A87, 0x0FAB4A88, 0x0FAB5A89, 0x0FAB6A8A,
+	0x0FAB7A8B, 0x0FAB8A8C, 0x0FAB9A8D, 0x0FABAA8E, 0x0FABBA8F, 0x0FABCA90, 0x0FABDA91, 0x0FABEA92,
+	0x0FABFA93, 0x0FAC0A94, 0x0FAC1A95, 0x0FAC2A96, 0x0FAC3A97, 0x0FAC4A98, 0x0FAC5A99, 0x0FAC6A9A,
+	0x0FAC7A9B, 0x0FAC8A9C, 0x0FAC9A9D, 0x0FACAA9E, 0x0FACBA9F, 0x0FACCAA0, 0x0FACDAA1, 0x0FACEAA2,
+	0x0FACFAA3, 0x0FAD0AA5, 0x0FAD1AA7, 0x0FAD2AA9, 0x0FAD3AAA, 0x0FAD4AAB, 0x0FAD5AAC, 0x0FAD6AAE,
+	0x0FAD7AB0, 0x0FAD8AB2, 0x0FAD9AB3, 0x0FB1DAB4, 0x0FB1FAB6, 0x0FB2AAB8, 0x0FB2BABA, 0x0FB2CABC,
+	0x0FB2DABF, 0x0FB2EAC2, 0x0FB2FAC4, 0x0FB30AC6, 0x0FB31AC8, 0x0FB32ACA, 0x0FB33ACC, 0x0FB34ACE,
+	0x0FB35AD0, 0x0FB36AD2, 0x0FB38AD4, 0x0FB39AD6, 0x0FB3AAD8, 0x0FB3BADA, 0x0FB3CADC, 0x0FB3EADE,
+	0x0FB40AE0, 0x0FB41AE2, 0x0FB43AE4, 0x0FB44AE6, 0x0FB46AE8, 0x0FB47AEA, 0x0FB48AEC, 0x0FB49AEE,
+	0x0FB4AAF0, 0x0FB4BAF2, 0x0FB4CAF4, 0x0FB4DAF6, 0x0FB4EAF8, 0x1109AAFA, 0x1109CAFE, 0x110ABB02,
+	0x1112EB06, 0x1112FB0A, 0x1134BB0E, 0x1134CB12, 0x114BBB16, 0x114BCB1A, 0x114BEB1E, 0x115BAB22,
+	0x115BBB26, 0x11938B2A, 0x1D15EB2E, 0x1D15FB32, 0x1D160B36, 0x1D161B3C, 0x1D162B42, 0x1D163B48,
+	0x1D164B4E, 0x1D1BBB54, 0x1D1BCB58, 0x1D1BDB5C, 0x1D1BEB62, 0x1D1BFB68, 0x1D1C0B6E, 0x2F800B74,
+	0x2F801B75, 0x2F802B76, 0x2F803B77, 0x2F804B79, 0x2F805B7A, 0x2F806B7B, 0x2F807B7C, 0x2F808B7D,
+	0x2F809B7E, 0x2F80AB7F, 0x2F80BB80, 0x2F80CB81, 0x2F80DB82, 0x2F80EB84, 0x2F80FB85, 0x2F810B86,
+	0x2F811B87, 0x2F812B88, 0x2F813B8A, 0x2F814B8B, 0x2F815B8C, 0x2F816B8D, 0x2F817B8F, 0x2F818B90,
+	0x2F819B91, 0x2F81AB92, 0x2F81BB93, 0x2F81CB94, 0x2F81DB96, 0x2F81EB97, 0x2F81FB98, 0x2F820B99,
+	0x2F821B9A, 0x2F822B9B, 0x2F823B9C, 0x2F824B9D, 0x2F825B9E, 0x2F826B9F, 0x2F827BA0, 0x2F828BA1,
+	0x2F829BA2, 0x2F82ABA3, 0x2F82BBA4, 0x2F82CBA5, 0x2F82DBA6, 0x2F82EBA7, 0x2F82FBA8, 0x2F830BA9,
+	0x2F831BAA, 0x2F832BAB, 0x2F833BAC, 0x2F834BAD, 0x2F835BAF, 0x2F836BB0, 0x2F837BB1, 0x2F838BB2,
+	0x2F839BB4, 0x2F83ABB5, 0x2F83BBB6, 0x2F83CBB7, 0x2F83DBB8, 0x2F83EBB9, 0x2F83FBBA, 0x2F840BBB,
+	0x2F841BBC, 0x2F842BBD, 0x2F843BBE, 0x2F844BBF, 0x2F845BC0, 0x2F846BC1, 0x2F847BC2, 0x2F848BC3,
+	0x2F849BC4, 0x2F84ABC5, 0x2F84BBC6, 0x2F84CBC7, 0x2F84DBC8, 0x2F84EBC9, 0x2F84FBCA, 0x2F850BCB,
+	0x2F851BCC, 0x2F852BCD, 0x2F853BCE, 0x2F854BCF, 0x2F855BD0, 0x2F856BD1, 0x2F857BD2, 0x2F858BD3,
+	0x2F859BD4, 0x2F85ABD6, 0x2F85BBD7, 0x2F85CBD8, 0x2F85DBD9, 0x2F85EBDA, 0x2F85FBDB, 0x2F860BDC,
+	0x2F861BDE, 0x2F862BE0, 0x2F863BE1, 0x2F864BE2, 0x2F865BE3, 0x2F866BE4, 0x2F867BE5, 0x2F868BE6,
+	0x2F869BE7, 0x2F86ABE8, 0x2F86BBE9, 0x2F86CBEA, 0x2F86DBEC, 0x2F86EBED, 0x2F86FBEE, 0x2F870BEF,
+	0x2F871BF0, 0x2F872BF2, 0x2F873BF3, 0x2F874BF4, 0x2F875BF5, 0x2F876BF6, 0x2F877BF7, 0x2F878BF8,
+	0x2F879BF9, 0x2F87ABFA, 0x2F87BBFB, 0x2F87CBFD, 0x2F87DBFE, 0x2F87EC00, 0x2F87FC01, 0x2F880C02,
+	0x2F881C03, 0x2F882C04, 0x2F883C05, 0x2F884C06, 0x2F885C07, 0x2F886C08, 0x2F887C09, 0x2F888C0A,
+	0x2F889C0B, 0x2F88AC0D, 0x2F88BC0E, 0x2F88CC0F, 0x2F88DC10, 0x2F88EC11, 0x2F88FC12, 0x2F890C14,
+	0x2F891C15, 0x2F892C17, 0x2F893C19, 0x2F894C1A, 0x2F895C1B, 0x2F896C1C, 0x2F897C1D, 0x2F898C1F,
+	0x2F899C21, 0x2F89AC22, 0x2F89BC23, 0x2F89CC24, 0x2F89DC25, 0x2F89EC26, 0x2F89FC27, 0x2F8A0C28,
+	0x2F8A1C29, 0x2F8A2C2A, 0x2F8A3C2B, 0x2F8A4C2C, 0x2F8A5C2E, 0x2F8A6C2F, 0x2F8A7C30, 0x2F8A8C31,
+	0x2F8A9C32, 0x2F8AAC33, 0x2F8ABC34, 0x2F8ACC35, 0x2F8ADC36, 0x2F8AEC37, 0x2F8AFC38, 0x2F8B0C39,
+	0x2F8B1C3A, 0x2F8B2C3B, 0x2F8B3C3C, 0x2F8B4C3D, 0x2F8B5C3E, 0x2F8B6C3F, 0x2F8B7C40, 0x2F8B8C41,
+	0x2F8B9C43, 0x2F8BAC44, 0x2F8BBC45, 0x2F8BCC46, 0x2F8BDC47, 0x2F8BEC48, 0x2F8BFC4A, 0x2F8C0C4B,
+	0x2F8C1C4C, 0x2F8C2C4D, 0x2F8C3C4E, 0x2F8C4C4F, 0x2F8C5C50, 0x2F8C6C51, 0x2F8C7C52, 0x2F8C8C53,
+	0x2F8C9C54, 0x2F8CAC55, 0x2F8CBC57, 0x2F8CCC58, 0x2F8CDC59, 0x2F8CEC5A, 0x2F8CFC5B, 0x2F8D0C5C,
+	0x2F8D1C5D, 0x2F8D2C5E, 0x2F8D3C5F, 0x2F8D4C60, 0x2F8D5C61, 0x2F8D6C62, 0x2F8D7C63, 0x2F8D8C64,
+	0x2F8D9C65, 0x2F8DAC66, 0x2F8DBC67, 0x2F8DCC68, 0x2F8DDC69, 0x2F8DEC6B, 0x2F8DFC6C, 0x2F8E0C6D,
+	0x2F8E1C6E, 0x2F8E2C6F, 0x2F8E3C70, 0x2F8E4C72, 0x2F8E5C73, 0x2F8E6C74, 0x2F8E7C75, 0x2F8E8C76,
+	0x2F8E9C77, 0x2F8EAC78, 0x2F8EBC79, 0x2F8ECC7A, 0x2F8EDC7C, 0x2F8EEC7D, 0x2F8EFC7E, 0x2F8F0C7F,
+	0x2F8F1C81, 0x2F8F2C82, 0x2F8F3C83, 0x2F8F4C84, 0x2F8F5C85, 0x2F8F6C86, 0x2F8F7C87, 0x2F8F8C89,
+	0x2F8F9C8B, 0x2F8FAC8D, 0x2F8FBC8E, 0x2F8FCC90, 0x2F8FDC91, 0x2F8FEC92, 0x2F8FFC93, 0x2F900C94,
+	0x2F901C95, 0x2F902C96, 0x2F903C97, 0x2F904C98, 0x2F905C99, 0x2F906C9A, 0x2F907C9C, 0x2F908C9D,
+	0x2F909C9E, 0x2F90AC9F, 0x2F90BCA0, 0x2F90CCA1, 0x2F90DCA2, 0x2F90ECA4, 0x2F90FCA5, 0x2F910CA6,
+	0x2F911CA8, 0x2F912CAA, 0x2F913CAB, 0x2F914CAC, 0x2F915CAD, 0x2F916CAE, 0x2F917CAF, 0x2F918CB0,
+	0x2F919CB1, 0x2F91ACB2, 0x2F91BCB3, 0x2F91CCB5, 0x2F91DCB6, 0x2F91ECB8, 0x2F91FCB9, 0x2F920CBB,
+	0x2F921CBC, 0x2F922CBD, 0x2F923CBE, 0x2F924CC0, 0x2F925CC1, 0x2F926CC2, 0x2F927CC4, 0x2F928CC6,
+	0x2F929CC7, 0x2F92ACC8, 0x2F92BCC9, 0x2F92CCCA, 0x2F92DCCB, 0x2F92ECCC, 0x2F92FCCD, 0x2F930CCE,
+	0x2F931CCF, 0x2F932CD0, 0x2F933CD1, 0x2F934CD2, 0x2F935CD3, 0x2F936CD5, 0x2F937CD6, 0x2F938CD8,
+	0x2F939CD9, 0x2F93ACDB, 0x2F93BCDC, 0x2F93CCDE, 0x2F93DCE0, 0x2F93ECE2, 0x2F93FCE3, 0x2F940CE4,
+	0x2F941CE5, 0x2F942CE7, 0x2F943CE9, 0x2F944CEB, 0x2F945CED, 0x2F946CEE, 0x2F947CEF, 0x2F948CF0,
+	0x2F949CF1, 0x2F94ACF2, 0x2F94BCF3, 0x2F94CCF4, 0x2F94DCF5, 0x2F94ECF7, 0x2F94FCF8, 0x2F950CF9,
+	0x2F951CFA, 0x2F952CFB, 0x2F953CFD, 0x2F954CFE, 0x2F955D00, 0x2F956D02, 0x2F957D03, 0x2F958D04,
+	0x2F959D05, 0x2F95AD06, 0x2F95BD07, 0x2F95CD08, 0x2F95DD0A, 0x2F95ED0C, 0x2F95FD0E, 0x2F960D0F,
+	0x2F961D10, 0x2F962D12, 0x2F963D13, 0x2F964D14, 0x2F965D15, 0x2F966D17, 0x2F967D18, 0x2F968D19,
+	0x2F969D1A, 0x2F96AD1B, 0x2F96BD1C, 0x2F96CD1E, 0x2F96DD1F, 0x2F96ED20, 0x2F96FD21, 0x2F970D22,
+	0x2F971D23, 0x2F972D24, 0x2F973D26, 0x2F974D28, 0x2F975D29, 0x2F976D2B, 0x2F977D2C, 0x2F978D2E,
+	0x2F979D2F, 0x2F97AD30, 0x2F97BD31, 0x2F97CD33, 0x2F97DD35, 0x2F97ED36, 0x2F97FD38, 0x2F980D39,
+	0x2F981D3B, 0x2F982D3C, 0x2F983D3D, 0x2F984D3E, 0x2F985D3F, 0x2F986D40, 0x2F987D41, 0x2F988D43,
+	0x2F989D45, 0x2F98AD47, 0x2F98BD49, 0x2F98CD4A, 0x2F98DD4B, 0x2F98ED4C, 0x2F98FD4D, 0x2F990D4E,
+	0x2F991D4F, 0x2F992D50, 0x2F993D51, 0x2F994D52, 0x2F995D53, 0x2F996D54, 0x2F997D55, 0x2F998D57,
+	0x2F999D58, 0x2F99AD59, 0x2F99BD5A, 0x2F99CD5B, 0x2F99DD5C, 0x2F99ED5D, 0x2F99FD5E, 0x2F9A0D5F,
+	0x2F9A1D60, 0x2F9A2D61, 0x2F9A3D62, 0x2F9A4D63, 0x2F9A5D65, 0x2F9A6D67, 0x2F9A7D69, 0x2F9A8D6A,
+	0x2F9A9D6B, 0x2F9AAD6C, 0x2F9ABD6D, 0x2F9ACD6F, 0x2F9ADD70, 0x2F9AED72, 0x2F9AFD73, 0x2F9B0D74,
+	0x2F9B1D76, 0x2F9B2D78, 0x2F9B3D79, 0x2F9B4D7A, 0x2F9B5D7B, 0x2F9B6D7C, 0x2F9B7D7D, 0x2F9B8D7E,
+	0x2F9B9D7F, 0x2F9BAD80, 0x2F9BBD81, 0x2F9BCD82, 0x2F9BDD83, 0x2F9BED84, 0x2F9BFD85, 0x2F9C0D86,
+	0x2F9C1D87, 0x2F9C2D88, 0x2F9C3D89, 0x2F9C4D8A, 0x2F9C5D8B, 0x2F9C6D8D, 0x2F9C7D8E, 0x2F9C8D8F,
+	0x2F9C9D90, 0x2F9CAD91, 0x2F9CBD92, 0x2F9CCD94, 0x2F9CDD96, 0x2F9CED97, 0x2F9CFD98, 0x2F9D0D99,
+	0x2F9D1D9A, 0x2F9D2D9B, 0x2F9D3D9C, 0x2F9D4D9E, 0x2F9D5D9F, 0x2F9D6DA0, 0x2F9D7DA1, 0x2F9D8DA2,
+	0x2F9D9DA4, 0x2F9DADA6, 0x2F9DBDA7, 0x2F9DCDA8, 0x2F9DDDA9, 0x2F9DEDAB, 0x2F9DFDAC, 0x2F9E0DAD,
+	0x2F9E1DAF, 0x2F9E2DB1, 0x2F9E3DB2, 0x2F9E4DB3, 0x2F9E5DB4, 0x2F9E6DB6, 0x2F9E7DB7, 0x2F9E8DB8,
+	0x2F9E9DB9, 0x2F9EADBA, 0x2F9EBDBB, 0x2F9ECDBC, 0x2F9EDDBD, 0x2F9EEDBF, 0x2F9EFDC0, 0x2F9F0DC1,
+	0x2F9F1DC2, 0x2F9F2DC4, 0x2F9F3DC5, 0x2F9F4DC6, 0x2F9F5DC7, 0x2F9F6DC8, 0x2F9F7DCA, 0x2F9F8DCC,
+	0x2F9F9DCD, 0x2F9FADCE, 0x2F9FBDCF, 0x2F9FCDD1, 0x2F9FDDD2, 0x2F9FEDD4, 0x2F9FFDD5, 0x2FA00DD6,
+	0x2FA01DD7, 0x2FA02DD9, 0x2FA03DDA, 0x2FA04DDB, 0x2FA05DDC, 0x2FA06DDD, 0x2FA07DDE, 0x2FA08DDF,
+	0x2FA09DE0, 0x2FA0ADE2, 0x2FA0BDE3, 0x2FA0CDE4, 0x2FA0DDE5, 0x2FA0EDE6, 0x2FA0FDE7, 0x2FA10DE8,
+	0x2FA11DEA, 0x2FA12DEB, 0x2FA13DED, 0x2FA14DEF, 0x2FA15DF1, 0x2FA16DF2, 0x2FA17DF3, 0x2FA18DF4,
+	0x2FA19DF5, 0x2FA1ADF6, 0x2FA1BDF7, 0x2FA1CDF8, 0x2FA1DDF9, 0xFFFFFDFB
+};
+
+// full canonical decompositions, encoded in UTF-16
+constexpr std::uint16_t arrNormalizeDecompositionData[3579] =
+{
+	0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303,
+	0x0041, 0x0308, 0x0041, 0x030A, 0x0043, 0x0327, 0x0045, 0x0300,
+	0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+	0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004E, 0x0303,
+	0x004F, 0x0300, 0x004F, 0x0301, 0x004F, 0x0302, 0x004F, 0x0303,
+	0x004F, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302,
+	0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301,
+	0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A,
+	0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+	0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+	0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+	0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300,
+	0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+	0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306,
+	0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+	0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307,
+	0x0063, 0x0307, 0x0043, 0x030C, 0x0063, 0x030C, 0x0044, 0x030C,
+	0x0064, 0x030C, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306,
+	0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328,
+	0x0065, 0x0328, 0x0045, 0x030C, 0x0065, 0x030C, 0x0047, 0x0302,
+	0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+	0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302,
+	0x0068, 0x0302, 0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304,
+	0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328,
+	0x0069, 0x0328, 0x0049, 0x0307, 0x004A, 0x0302, 0x006A, 0x0302,
+	0x004B, 0x0327, 0x006B, 0x0327, 0x004C, 0x0301, 0x006C, 0x0301,
+	0x004C, 0x0327, 0x006C, 0x0327, 0x004C, 0x030C, 0x006C, 0x030C,
+	0x004E, 0x0301, 0x006E, 0x0301, 0x004E, 0x0327, 0x006E, 0x0327,
+	0x004E, 0x030C, 0x006E, 0x030C, 0x004F, 0x0304, 0x006F, 0x0304,
+	0x004F, 0x0306, 0x006F, 0x0306, 0x004F, 0x030B, 0x006F, 0x030B,
+	0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327,
+	0x0052, 0x030C, 0x0072, 0x030C, 0x0053, 0x0301, 0x0073, 0x0301,
+	0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327,
+	0x0053, 0x030C, 0x0073, 0x030C, 0x0054, 0x0327, 0x0074, 0x0327,
+	0x0054, 0x030C, 0x0074, 0x030C, 0x0055, 0x0303, 0x0075, 0x0303,
+	0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306,
+	0x0055, 0x030A, 0x0075, 0x030A, 0x0055, 0x030B, 0x0075, 0x030B,
+	0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302, 0x0077, 0x0302,
+	0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005A, 0x0301,
+	0x007A, 0x0301, 0x005A, 0x0307, 0x007A, 0x0307, 0x005A, 0x030C,
+	0x007A, 0x030C, 0x004F, 0x031B, 0x006F, 0x031B, 0x0055, 0x031B,
+	0x0075, 0x031B, 0x0041, 0x030C, 0x0061, 0x030C, 0x0049, 0x030C,
+	0x0069, 0x030C, 0x004F, 0x030C, 0x006F, 0x030C, 0x0055, 0x030C,
+	0x0075, 0x030C, 0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304,
+	0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+	0x030C, 0x0075, 0x0308, 0x030C, 0x0055, 0x0308, 0x0300, 0x0075,
+	0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304,
+	0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00C6, 0x0304,
+	0x00E6, 0x0304, 0x0047, 0x030C, 0x0067, 0x030C, 0x004B, 0x030C,
+	0x006B, 0x030C, 0x004F, 0x0328, 0x006F, 0x0328, 0x004F, 0x0328,
+	0x0304, 0x006F, 0x0328, 0x0304, 0x01B7, 0x030C, 0x0292, 0x030C,
+	0x006A, 0x030C, 0x0047, 0x0301, 0x0067, 0x0301, 0x004E, 0x0300,
+	0x006E, 0x0300, 0x0041, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301,
+	0x00C6, 0x0301, 0x00E6, 0x0301, 0x00D8, 0x0301, 0x00F8, 0x0301,
+	0x0041, 0x030F, 0x0061, 0x030F, 0x0041, 0x0311, 0x0061, 0x0311,
+	0x0045, 0x030F, 0x0065, 0x030F, 0x0045, 0x0311, 0x0065, 0x0311,
+	0x0049, 0x030F, 0x0069, 0x030F, 0x0049, 0x0311, 0x0069, 0x0311,
+	0x004F, 0x030F, 0x006F, 0x030F, 0x004F, 0x0311, 0x006F, 0x0311,
+	0x0052, 0x030F, 0x0072, 0x030F, 0x0052, 0x0311, 0x0072, 0x0311,
+	0x0055, 0x030F, 0x0075, 0x030F, 0x0055, 0x0311, 0x0075, 0x0311,
+	0x0053, 0x0326, 0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326,
+	0x0048, 0x030C, 0x0068, 0x030C, 0x0041, 0x0307, 0x0061, 0x0307,
+	0x0045, 0x0327, 0x0065, 0x0327, 0x004F, 0x0308, 0x0304, 0x006F,
+	0x0308, 0x0304, 0x004F, 0x0303, 0x0304, 0x006F, 0x0303, 0x0304,
+	0x004F, 0x0307, 0x006F, 0x0307, 0x004F, 0x0307, 0x0304, 0x006F,
+	0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0300, 0x0301,
+	0x0313, 0x0308, 0x0301, 0x02B9, 0x003B, 0x00A8, 0x0301, 0x0391,
+	0x0301, 0x00B7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301,
+	0x039F, 0x0301, 0x03A5, 0x0301, 0x03A9, 0x0301, 0x03B9, 0x0308,
+	0x0301, 0x0399, 0x0308, 0x03A5, 0x0308, 0x03B1, 0x0301, 0x03B5,
+	0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301,
+	0x03B9, 0x0308, 0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301,
+	0x03C9, 0x0301, 0x03D2, 0x0301, 0x03D2, 0x0308, 0x0415, 0x0300,
+	0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041A, 0x0301,
+	0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306,
+	0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308,
+	0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030F,
+	0x0475, 0x030F, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306,
+	0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306,
+	0x0435, 0x0306, 0x04D8, 0x0308, 0x04D9, 0x0308, 0x0416, 0x0308,
+	0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304,
+	0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041E, 0x0308,
+	0x043E, 0x0308, 0x04E8, 0x0308, 0x04E9, 0x0308, 0x042D, 0x0308,
+	0x044D, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308,
+	0x0443, 0x0308, 0x0423, 0x030B, 0x0443, 0x030B, 0x0427, 0x0308,
+	0x0447, 0x0308, 0x042B, 0x0308, 0x044B, 0x0308, 0x0627, 0x0653,
+	0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064A, 0x0654,
+	0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2, 0x0654, 0x0928, 0x093C,
+	0x0930, 0x093C, 0x0933, 0x093C, 0x0915, 0x093C, 0x0916, 0x093C,
+	0x0917, 0x093C, 0x091C, 0x093C, 0x0921, 0x093C, 0x0922, 0x093C,
+	0x092B, 0x093C, 0x092F, 0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7,
+	0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C,
+	0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C,
+	0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57,
+	0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE,
+	0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5,
+	0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2,
+	0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9,
+	0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF,
+	0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56, 0x0FB7,
+	0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71, 0x0F74,
+	0x0FB2, 0x0F80, 0x0FB3, 0x0F80, 0x0F71, 0x0F80, 0x0F92, 0x0FB7,
+	0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB, 0x0FB7,
+	0x0F90, 0x0FB5, 0x1025, 0x102E, 0x1B05, 0x1B35, 0x1B07, 0x1B35,
+	0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11, 0x1B35,
+	0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F, 0x1B35,
+	0x1B42, 0x1B35, 0x0041, 0x0325, 0x0061, 0x0325, 0x0042, 0x0307,
+	0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323, 0x0042, 0x0331,
+	0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301,
+	0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323, 0x0064, 0x0323,
+	0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327,
+	0x0044, 0x032D, 0x0064, 0x032D, 0x0045, 0x0304, 0x0300, 0x0065,
+	0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301,
+	0x0045, 0x032D, 0x0065, 0x032D, 0x0045, 0x0330, 0x0065, 0x0330,
+	0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307,
+	0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304, 0x0048, 0x0307,
+	0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308,
+	0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327, 0x0048, 0x032E,
+	0x0068, 0x032E, 0x0049, 0x0330, 0x0069, 0x0330, 0x0049, 0x0308,
+	0x0301, 0x0069, 0x0308, 0x0301, 0x004B, 0x0301, 0x006B, 0x0301,
+	0x004B, 0x0323, 0x006B, 0x0323, 0x004B, 0x0331, 0x006B, 0x0331,
+	0x004C, 0x0323, 0x006C, 0x0323, 0x004C, 0x0323, 0x0304, 0x006C,
+	0x0323, 0x0304, 0x004C, 0x0331, 0x006C, 0x0331, 0x004C, 0x032D,
+	0x006C, 0x032D, 0x004D, 0x0301, 0x006D, 0x0301, 0x004D, 0x0307,
+	0x006D, 0x0307, 0x004D, 0x0323, 0x006D, 0x0323, 0x004E, 0x0307,
+	0x006E, 0x0307, 0x004E, 0x0323, 0x006E, 0x0323, 0x004E, 0x0331,
+	0x006E, 0x0331, 0x004E, 0x032D, 0x006E, 0x032D, 0x004F, 0x0303,
+	0x0301, 0x006F, 0x0303, 0x0301, 0x004F, 0x0303, 0x0308, 0x006F,
+	0x0303, 0x0308, 0x004F, 0x0304, 0x0300, 0x006F, 0x0304, 0x0300,
+	0x004F, 0x0304, 0x0301, 0x006F, 0x0304, 0x0301, 0x0050, 0x0301,
+	0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307, 0x0052, 0x0307,
+	0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323,
+	0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331, 0x0072, 0x0331,
+	0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323, 0x0073, 0x0323,
+	0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030C,
+	0x0307, 0x0073, 0x030C, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073,
+	0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307, 0x0054, 0x0323,
+	0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331, 0x0054, 0x032D,
+	0x0074, 0x032D, 0x0055, 0x0324, 0x0075, 0x0324, 0x0055, 0x0330,
+	0x0075, 0x0330, 0x0055, 0x032D, 0x0075, 0x032D, 0x0055, 0x0303,
+	0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075,
+	0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323,
+	0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300, 0x0057, 0x0301,
+	0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308, 0x0057, 0x0307,
+	0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307,
+	0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308, 0x0059, 0x0307,
+	0x0079, 0x0307, 0x005A, 0x0302, 0x007A, 0x0302, 0x005A, 0x0323,
+	0x007A, 0x0323, 0x005A, 0x0331, 0x007A, 0x0331, 0x0068, 0x0331,
+	0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A, 0x017F, 0x0307,
+	0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309,
+	0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302,
+	0x0300, 0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061,
+	0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303,
+	0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306,
+	0x0301, 0x0061, 0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061,
+	0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309,
+	0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323,
+	0x0306, 0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x0065, 0x0323,
+	0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303,
+	0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302,
+	0x0300, 0x0065, 0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065,
+	0x0302, 0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303,
+	0x0045, 0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309,
+	0x0069, 0x0309, 0x0049, 0x0323, 0x0069, 0x0323, 0x004F, 0x0323,
+	0x006F, 0x0323, 0x004F, 0x0309, 0x006F, 0x0309, 0x004F, 0x0302,
+	0x0301, 0x006F, 0x0302, 0x0301, 0x004F, 0x0302, 0x0300, 0x006F,
+	0x0302, 0x0300, 0x004F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0309,
+	0x004F, 0x0302, 0x0303, 0x006F, 0x0302, 0x0303, 0x004F, 0x0323,
+	0x0302, 0x006F, 0x0323, 0x0302, 0x004F, 0x031B, 0x0301, 0x006F,
+	0x031B, 0x0301, 0x004F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0300,
+	0x004F, 0x031B, 0x0309, 0x006F, 0x031B, 0x0309, 0x004F, 0x031B,
+	0x0303, 0x006F, 0x031B, 0x0303, 0x004F, 0x031B, 0x0323, 0x006F,
+	0x031B, 0x0323, 0x0055, 0x0323, 0x0075, 0x0323, 0x0055, 0x0309,
+	0x0075, 0x0309, 0x0055, 0x031B, 0x0301, 0x0075, 0x031B, 0x0301,
+	0x0055, 0x031B, 0x0300, 0x0075, 0x031B, 0x0300, 0x0055, 0x031B,
+	0x0309, 0x0075, 0x031B, 0x0309, 0x0055, 0x031B, 0x0303, 0x0075,
+	0x031B, 0x0303, 0x0055, 0x031B, 0x0323, 0x0075, 0x031B, 0x0323,
+	0x0059, 0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323,
+	0x0059, 0x0309, 0x0079, 0x0309, 0x0059, 0x0303, 0x0079, 0x0303,
+	0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1,
+	0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301,
+	0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x0391, 0x0313,
+	0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300,
+	0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313,
+	0x0342, 0x0391, 0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314,
+	0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313,
+	0x0301, 0x03B5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314,
+	0x0395, 0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313,
+	0x0301, 0x0395, 0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314,
+	0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313,
+	0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7,
+	0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313,
+	0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397,
+	0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342,
+	0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9,
+	0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301,
+	0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x0399, 0x0313,
+	0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300,
+	0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313,
+	0x0342, 0x0399, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314,
+	0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313,
+	0x0301, 0x03BF, 0x0314, 0x0301, 0x039F, 0x0313, 0x039F, 0x0314,
+	0x039F, 0x0313, 0x0300, 0x039F, 0x0314, 0x0300, 0x039F, 0x0313,
+	0x0301, 0x039F, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314,
+	0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313,
+	0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5,
+	0x0314, 0x0342, 0x03A5, 0x0314, 0x03A5, 0x0314, 0x0300, 0x03A5,
+	0x0314, 0x0301, 0x03A5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9,
+	0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9,
+	0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342,
+	0x03C9, 0x0314, 0x0342, 0x03A9, 0x0313, 0x03A9, 0x0314, 0x03A9,
+	0x0313, 0x0300, 0x03A9, 0x0314, 0x0300, 0x03A9, 0x0313, 0x0301,
+	0x03A9, 0x0314, 0x0301, 0x03A9, 0x0313, 0x0342, 0x03A9, 0x0314,
+	0x0342, 0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5, 0x0300, 0x03B5,
+	0x0301, 0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B9, 0x0300, 0x03B9,
+	0x0301, 0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5, 0x0300, 0x03C5,
+	0x0301, 0x03C9, 0x0300, 0x03C9, 0x0301, 0x03B1, 0x0313, 0x0345,
+	0x03B1, 0x0314, 0x0345, 0x03B1, 0x0313, 0x0300, 0x0345, 0x03B1,
+	0x0314, 0x0300, 0x0345, 0x03B1, 0x0313, 0x0301, 0x0345, 0x03B1,
+	0x0314, 0x0301, 0x0345, 0x03B1, 0x0313, 0x0342, 0x0345, 0x03B1,
+	0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314,
+	0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300,
+	0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301,
+	0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342,
+	0x0345, 0x03B7, 0x0313, 0x0345, 0x03B7, 0x0314, 0x0345, 0x03B7,
+	0x0313, 0x0300, 0x0345, 0x03B7, 0x0314, 0x0300, 0x0345, 0x03B7,
+	0x0313, 0x0301, 0x0345, 0x03B7, 0x0314, 0x0301, 0x0345, 0x03B7,
+	0x0313, 0x0342, 0x0345, 0x03B7, 0x0314, 0x0342, 0x0345, 0x0397,
+	0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300,
+	0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301,
+	0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342,
+	0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03C9, 0x0313, 0x0345,
+	0x03C9, 0x0314, 0x0345, 0x03C9, 0x0313, 0x0300, 0x0345, 0x03C9,
+	0x0314, 0x0300, 0x0345, 0x03C9, 0x0313, 0x0301, 0x0345, 0x03C9,
+	0x0314, 0x0301, 0x0345, 0x03C9, 0x0313, 0x0342, 0x0345, 0x03C9,
+	0x0314, 0x0342, 0x0345, 0x03A9, 0x0313, 0x0345, 0x03A9, 0x0314,
+	0x0345, 0x03A9, 0x0313, 0x0300, 0x0345, 0x03A9, 0x0314, 0x0300,
+	0x0345, 0x03A9, 0x0313, 0x0301, 0x0345, 0x03A9, 0x0314, 0x0301,
+	0x0345, 0x03A9, 0x0313, 0x0342, 0x0345, 0x03A9, 0x0314, 0x0342,
+	0x0345, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x0345,
+	0x03B1, 0x0345, 0x03B1, 0x0301, 0x0345, 0x03B1, 0x0342, 0x03B1,
+	0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300,
+	0x0391, 0x0301, 0x0391, 0x0345, 0x03B9, 0x00A8, 0x0342, 0x03B7,
+	0x0300, 0x0345, 0x03B7, 0x0345, 0x03B7, 0x0301, 0x0345, 0x03B7,
+	0x0342, 0x03B7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0395, 0x0301,
+	0x0397, 0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1FBF, 0x0300,
+	0x1FBF, 0x0301, 0x1FBF, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304,
+	0x03B9, 0x0308, 0x0300, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342,
+	0x03B9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399,
+	0x0300, 0x0399, 0x0301, 0x1FFE, 0x0300, 0x1FFE, 0x0301, 0x1FFE,
+	0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308, 0x0300,
+	0x03C5, 0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0314, 0x03C5,
+	0x0342, 0x03C5, 0x0308, 0x0342, 0x03A5, 0x0306, 0x03A5, 0x0304,
+	0x03A5, 0x0300, 0x03A5, 0x0301, 0x03A1, 0x0314, 0x00A8, 0x0300,
+	0x00A8, 0x0301, 0x0060, 0x03C9, 0x0300, 0x0345, 0x03C9, 0x0345,
+	0x03C9, 0x0301, 0x0345, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x0345,
+	0x039F, 0x0300, 0x039F, 0x0301, 0x03A9, 0x0300, 0x03A9, 0x0301,
+	0x03A9, 0x0345, 0x00B4, 0x2002, 0x2003, 0x03A9, 0x004B, 0x0041,
+	0x030A, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21D0,
+	0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338, 0x2208,
+	0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x223C,
+	0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003D,
+	0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x003C, 0x0338, 0x003E,
+	0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273,
+	0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338, 0x227B,
+	0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287,
+	0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB,
+	0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338, 0x2292,
+	0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5,
+	0x0338, 0x3008, 0x3009, 0x2ADD, 0x0338, 0x304B, 0x3099, 0x304D,
+	0x3099, 0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+	0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D,
+	0x3099, 0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+	0x3099, 0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072,
+	0x3099, 0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078,
+	0x3099, 0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046,
+	0x3099, 0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF,
+	0x3099, 0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7,
+	0x3099, 0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF,
+	0x3099, 0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8,
+	0x3099, 0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2,
+	0x309A, 0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8,
+	0x309A, 0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF,
+	0x3099, 0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD,
+	0x3099, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5,
+	0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669,
+	0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9,
+	0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B,
+	0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8,
+	0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7,
+	0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C,
+	0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9,
+	0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262,
+	0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F,
+	0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C,
+	0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39,
+	0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+	0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+	0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565,
+	0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF,
+	0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD,
+	0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74,
+	0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+	0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD,
+	0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E,
+	0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469,
+	0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE,
+	0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599,
+	0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E,
+	0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B,
+	0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA,
+	0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F,
+	0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79,
+	0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0,
+	0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8,
+	0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336,
+	0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4,
+	0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A,
+	0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F,
+	0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF,
+	0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+	0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+	0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2,
+	0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422,
+	0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D,
+	0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72,
+	0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01,
+	0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B,
+	0x6075, 0xD850, 0xDEEE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80,
+	0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2,
+	0x585A, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9,
+	0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2,
+	0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B,
+	0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E,
+	0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B,
+	0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC,
+	0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352,
+	0x83EF, 0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB,
+	0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072,
+	0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B,
+	0x983B, 0x9B12, 0x9F9C, 0xD84A, 0xDC4A, 0xD84A, 0xDC44, 0xD84C,
+	0xDFD5, 0x3B9D, 0x4018, 0x4039, 0xD854, 0xDE49, 0xD857, 0xDCD0,
+	0xD85F, 0xDED3, 0x9F43, 0x9F8E, 0x05D9, 0x05B4, 0x05F2, 0x05B7,
+	0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9, 0x05BC, 0x05C1, 0x05E9,
+	0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0, 0x05B8, 0x05D0, 0x05BC,
+	0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3, 0x05BC, 0x05D4, 0x05BC,
+	0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8, 0x05BC, 0x05D9, 0x05BC,
+	0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC, 0x05BC, 0x05DE, 0x05BC,
+	0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3, 0x05BC, 0x05E4, 0x05BC,
+	0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8, 0x05BC, 0x05E9, 0x05BC,
+	0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1, 0x05BF, 0x05DB, 0x05BF,
+	0x05E4, 0x05BF, 0xD804, 0xDC99, 0xD804, 0xDCBA, 0xD804, 0xDC9B,
+	0xD804, 0xDCBA, 0xD804, 0xDCA5, 0xD804, 0xDCBA, 0xD804, 0xDD31,
+	0xD804, 0xDD27, 0xD804, 0xDD32, 0xD804, 0xDD27, 0xD804, 0xDF47,
+	0xD804, 0xDF3E, 0xD804, 0xDF47, 0xD804, 0xDF57, 0xD805, 0xDCB9,
+	0xD805, 0xDCBA, 0xD805, 0xDCB9, 0xD805, 0xDCB0, 0xD805, 0xDCB9,
+	0xD805, 0xDCBD, 0xD805, 0xDDB8, 0xD805, 0xDDAF, 0xD805, 0xDDB9,
+	0xD805, 0xDDAF, 0xD806, 0xDD35, 0xD806, 0xDD30, 0xD834, 0xDD57,
+	0xD834, 0xDD65, 0xD834, 0xDD58, 0xD834, 0xDD65, 0xD834, 0xDD58,
+	0xD834, 0xDD65, 0xD834, 0xDD6E, 0xD834, 0xDD58, 0xD834, 0xDD65,
+	0xD834, 0xDD6F, 0xD834, 0xDD58, 0xD834, 0xDD65, 0xD834, 0xDD70,
+	0xD834, 0xDD58, 0xD834, 0xDD65, 0xD834, 0xDD71, 0xD834, 0xDD58,
+	0xD834, 0xDD65, 0xD834, 0xDD72, 0xD834, 0xDDB9, 0xD834, 0xDD65,
+	0xD834, 0xDDBA, 0xD834, 0xDD65, 0xD834, 0xDDB9, 0xD834, 0xDD65,
+	0xD834, 0xDD6E, 0xD834, 0xDDBA, 0xD834, 0xDD65, 0xD834, 0xDD6E,
+	0xD834, 0xDDB9, 0xD834, 0xDD65, 0xD834, 0xDD6F, 0xD834, 0xDDBA,
+	0xD834, 0xDD65, 0xD834, 0xDD6F, 0x4E3D, 0x4E38, 0x4E41, 0xD840,
+	0xDD22, 0x4F60, 0x4FAE, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7,
+	0x50CF, 0x349E, 0xD841, 0xDE3A, 0x514D, 0x5154, 0x5164, 0x5177,
+	0xD841, 0xDD1C, 0x34B9, 0x5167, 0x518D, 0xD841, 0xDD4B, 0x5197,
+	0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0xD864, 0xDDDF, 0x51F5, 0x5203,
+	0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7, 0x52C9,
+	0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535A,
+	0x5373, 0x537D, 0x537F, 0x537F, 0x537F, 0xD842, 0xDE2C, 0x7070,
+	0x53CA, 0x53DF, 0xD842, 0xDF63, 0x53EB, 0x53F1, 0x5406, 0x549E,
+	0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563,
+	0x5584, 0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606,
+	0x5717, 0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D,
+	0x578B, 0x5832, 0x5831, 0x58AC, 0xD845, 0xDCE4, 0x58F2, 0x58F7,
+	0x5906, 0x591A, 0x5922, 0x5962, 0xD845, 0xDEA8, 0xD845, 0xDEEA,
+	0x59EC, 0x5A1B, 0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x36FC, 0x5B08,
+	0x5B3E, 0x5B3E, 0xD846, 0xDDC8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3,
+	0xD846, 0xDF18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22, 0x3781, 0x5C60,
+	0x5C6E, 0x5CC0, 0x5C8D, 0xD847, 0xDDE4, 0x5D43, 0xD847, 0xDDE6,
+	0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28,
+	0x5E3D, 0x5E69, 0x3862, 0xD848, 0xDD83, 0x387C, 0x5EB0, 0x5EB3,
+	0x5EB6, 0x5ECA, 0xD868, 0xDF92, 0x5EFE, 0xD848, 0xDF31, 0xD848,
+	0xDF31, 0x8201, 0x5F22, 0x5F22, 0x38C7, 0xD84C, 0xDEB8, 0xD858,
+	0xDDDA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9,
+	0x6081, 0x393A, 0x391C, 0x6094, 0xD849, 0xDED4, 0x60C7, 0x6148,
+	0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4, 0x61AF,
+	0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1, 0x62D4,
+	0x6350, 0xD84A, 0xDF0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4,
+	0xD84A, 0xDFF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E,
+	0x649D, 0x6477, 0x3A6C, 0x654F, 0x656C, 0xD84C, 0xDC0A, 0x65E3,
+	0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195,
+	0x6700, 0x669C, 0x80AD, 0x43D9, 0x6717, 0x671B, 0x6721, 0x675E,
+	0x6753, 0xD84C, 0xDFC3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885,
+	0xD84D, 0xDC6D, 0x688E, 0x681F, 0x6914, 0x3B9D, 0x6942, 0x69A3,
+	0x69EA, 0x6AA8, 0xD84D, 0xDEA3, 0x6ADB, 0x3C18, 0x6B21, 0xD84E,
+	0xDCA7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA, 0x6BBB, 0xD84E,
+	0xDE8D, 0xD847, 0xDD0B, 0xD84E, 0xDEFA, 0x6C4E, 0xD84F, 0xDCBC,
+	0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69,
+	0x6D78, 0x6D85, 0xD84F, 0xDD1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33,
+	0x6ECB, 0x6EC7, 0xD84F, 0xDED1, 0x6DF9, 0x6F6E, 0xD84F, 0xDF5E,
+	0xD84F, 0xDF8E, 0x6FC6, 0x7039, 0x701E, 0x701B, 0x3D96, 0x704A,
+	0x707D, 0x7077, 0x70AD, 0xD841, 0xDD25, 0x7145, 0xD850, 0xDE63,
+	0x719C, 0xD850, 0xDFAB, 0x7228, 0x7235, 0x7250, 0xD851, 0xDE08,
+	0x7280, 0x7295, 0xD851, 0xDF35, 0xD852, 0xDC14, 0x737A, 0x738B,
+	0x3EAC, 0x73A5, 0x3EB8, 0x3EB8, 0x7447, 0x745C, 0x7471, 0x7485,
+	0x74CA, 0x3F1B, 0x7524, 0xD853, 0xDC36, 0x753E, 0xD853, 0xDC92,
+	0x7570, 0xD848, 0xDD9F, 0x7610, 0xD853, 0xDFA1, 0xD853, 0xDFB8,
+	0xD854, 0xDC44, 0x3FFC, 0x4008, 0x76F4, 0xD854, 0xDCF3, 0xD854,
+	0xDCF2, 0xD854, 0xDD19, 0xD854, 0xDD33, 0x771E, 0x771F, 0x771F,
+	0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0xD855, 0xDC1D, 0x784E,
+	0x788C, 0x78CC, 0x40E3, 0xD855, 0xDE26, 0x7956, 0xD855, 0xDE9A,
+	0xD855, 0xDEC5, 0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F,
+	0xD856, 0xDD7C, 0xD856, 0xDEA7, 0xD856, 0xDEA7, 0x7AEE, 0x4202,
+	0xD856, 0xDFAB, 0x7BC6, 0x7BC9, 0x4227, 0xD857, 0xDC80, 0x7CD2,
+	0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0xD857, 0xDF86, 0x7D63, 0x4301,
+	0x7DC7, 0x7E02, 0x7E45, 0x4334, 0xD858, 0xDE28, 0xD858, 0xDE47,
+	0x4359, 0xD858, 0xDED9, 0x7F7A, 0xD858, 0xDF3E, 0x7F95, 0x7FFA,
+	0x8005, 0xD859, 0xDCDA, 0xD859, 0xDD23, 0x8060, 0xD859, 0xDDA8,
+	0x8070, 0xD84C, 0xDF5F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E,
+	0x5AB5, 0xD859, 0xDFA7, 0xD859, 0xDFB5, 0xD84C, 0xDF93, 0xD84C,
+	0xDF9C, 0x8201, 0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D,
+	0x52B3, 0x82B1, 0x82B3, 0x82BD, 0x82E6, 0xD85A, 0xDF3C, 0x82E5,
+	0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD, 0x83E7, 0x8457, 0x8353,
+	0x83CA, 0x83CC, 0x83DC, 0xD85B, 0xDC36, 0xD85B, 0xDD6B, 0xD85B,
+	0xDCD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0xD85C, 0xDFCA, 0x8564,
+	0xD85B, 0xDF2C, 0x455D, 0x4561, 0xD85B, 0xDFB1, 0xD85C, 0xDCD2,
+	0x456B, 0x8650, 0x865C, 0x8667, 0x8669, 0x86A9, 0x8688, 0x870E,
+	0x86E2, 0x8779, 0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1, 0x8801,
+	0x45F9, 0x8860, 0x8863, 0xD85D, 0xDE67, 0x88D7, 0x88DE, 0x4635,
+	0x88FA, 0x34BB, 0xD85E, 0xDCAE, 0xD85E, 0xDD66, 0x46BE, 0x46C7,
+	0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0xD85F, 0xDCA8, 0x8CAB, 0x8CC1,
+	0x8D1B, 0x8D77, 0xD85F, 0xDF2F, 0xD842, 0xDC04, 0x8DCB, 0x8DBC,
+	0x8DF0, 0xD842, 0xDCDE, 0x8ED4, 0x8F38, 0xD861, 0xDDD2, 0xD861,
+	0xDDED, 0x9094, 0x90F1, 0x9111, 0xD861, 0xDF2E, 0x911B, 0x9238,
+	0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0xD862, 0xDFFA, 0x958B,
+	0x4995, 0x95B7, 0xD863, 0xDD77, 0x49E6, 0x96C3, 0x5DB2, 0x9723,
+	0xD864, 0xDD45, 0xD864, 0xDE1A, 0x4A6E, 0x4A76, 0x97E0, 0xD865,
+	0xDC0A, 0x4AB2, 0xD865, 0xDC96, 0x980B, 0x980B, 0x9829, 0xD865,
+	0xDDB6, 0x98E2, 0x4B33, 0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE,
+	0xD866, 0xDF30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE, 0x4CED, 0x9D67,
+	0xD868, 0xDCCE, 0x4CF8, 0xD868, 0xDD05, 0xD868, 0xDE0E, 0xD868,
+	0xDE91, 0x9EBB, 0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16,
+	0x9F3B, 0xD869, 0xDE00
+};
+
+// sorted primary composites, first codepoint in bits [42 .. 63), second codepoint in bits [21 .. 42), composite codepoint in bits [0 .. 21)
+constexpr std::uint64_t arrNormalizeCompositions[941] =
+{
+	0x0000F0006700226E, 0x0000F40067002260, 0x0000F8006700226F, 0x00010400600000C0,
+	0x00010400602000C1, 0x00010400604000C2, 0x00010400606000C3, 0x0001040060800100,
+	0x0001040060C00102, 0x0001040060E00226, 0x00010400610000C4, 0x0001040061201EA2,
+	0x00010400614000C5, 0x00010400618001CD, 0x0001040061E00200, 0x0001040062200202,
+	0x0001040064601EA0, 0x0001040064A01E00, 0x0001040065000104, 0x0001080060E01E02,
+	0x0001080064601E04, 0x0001080066201E06, 0x00010C0060200106, 0x00010C0060400108,
+	0x00010C0060E0010A, 0x00010C006180010C, 0x00010C0064E000C7, 0x0001100060E01E0A,
+	0x000110006180010E, 0x0001100064601E0C, 0x0001100064E01E10, 0x0001100065A01E12,
+	0x0001100066201E0E, 0x00011400600000C8, 0x00011400602000C9, 0x00011400604000CA,
+	0x0001140060601EBC, 0x0001140060800112, 0x0001140060C00114, 0x0001140060E00116,
+	0x00011400610000CB, 0x0001140061201EBA, 0x000114006180011A, 0x0001140061E00204,
+	0x0001140062200206, 0x0001140064601EB8, 0x0001140064E00228, 0x0001140065000118,
+	0x0001140065A01E18, 0x0001140066001E1A, 0x0001180060E01E1E, 0x00011C00602001F4,
+	0x00011C006040011C, 0x00011C0060801E20, 0x00011C0060C0011E, 0x00011C0060E00120,
+	0x00011C00618001E6, 0x00011C0064E00122, 0x0001200060400124, 0x0001200060E01E22,
+	0x0001200061001E26, 0x000120006180021E, 0x0001200064601E24, 0x0001200064E01E28,
+	0x0001200065C01E2A, 0x00012400600000CC, 0x00012400602000CD, 0x00012400604000CE,
+	0x0001240060600128, 0x000124006080012A, 0x0001240060C0012C, 0x0001240060E00130,
+	0x00012400610000CF, 0x0001240061201EC8, 0x00012400618001CF, 0x0001240061E00208,
+	0x000124006220020A, 0x0001240064601ECA, 0x000124006500012E, 0x0001240066001E2C,
+	0x0001280060400134, 0x00012C0060201E30, 0x00012C00618001E8, 0x00012C0064601E32,
+	0x00012C0064E00136, 0x00012C0066201E34, 0x0001300060200139, 0x000130006180013D,
+	0x0001300064601E36, 0x0001300064E0013B, 0x0001300065A01E3C, 0x0001300066201E3A,
+	0x0001340060201E3E, 0x0001340060E01E40, 0x0001340064601E42, 0x00013800600001F8,
+	0x0001380060200143, 0x00013800606000D1, 0x0001380060E01E44, 0x0001380061800147,
+	0x0001380064601E46, 0x0001380064E00145, 0x0001380065A01E4A, 0x0001380066201E48,
+	0x00013C00600000D2, 0x00013C00602000D3, 0x00013C00604000D4, 0x00013C00606000D5,
+	0x00013C006080014C, 0x00013C0060C0014E, 0x00013C0060E0022E, 0x00013C00610000D6,
+	0x00013C0061201ECE, 0x00013C0061600150, 0x00013C00618001D1, 0x00013C0061E0020C,
+	0x00013C006220020E, 0x00013C00636001A0, 0x00013C0064601ECC, 0x00013C00650001EA,
+	0x0001400060201E54, 0x0001400060E01E56, 0x0001480060200154, 0x0001480060E01E58,
+	0x0001480061800158, 0x0001480061E00210, 0x0001480062200212, 0x0001480064601E5A,
+	0x0001480064E00156, 0x0001480066201E5E, 0x00014C006020015A, 0x00014C006040015C,
+	0x00014C0060E01E60, 0x00014C0061800160, 0x00014C0064601E62, 0x00014C0064C00218,
+	0x00014C0064E0015E, 0x0001500060E01E6A, 0x0001500061800164, 0x0001500064601E6C,
+	0x0001500064C0021A, 0x0001500064E00162, 0x0001500065A01E70, 0x0001500066201E6E,
+	0x00015400600000D9, 0x00015400602000DA, 0x00015400604000DB, 0x0001540060600168,
+	0x000154006080016A, 0x0001540060C0016C, 0x00015400610000DC, 0x0001540061201EE6,
+	0x000154006140016E, 0x0001540061600170, 0x00015400618001D3, 0x0001540061E00214,
+	0x0001540062200216, 0x00015400636001AF, 0x0001540064601EE4, 0x0001540064801E72,
+	0x0001540065000172, 0x0001540065A01E76, 0x0001540066001E74, 0x0001580060601E7C,
+	0x0001580064601E7E, 0x00015C0060001E80, 0x00015C0060201E82, 0x00015C0060400174,
+	0x00015C0060E01E86, 0x00015C0061001E84, 0x00015C0064601E88, 0x0001600060E01E8A,
+	0x0001600061001E8C, 0x0001640060001EF2, 0x00016400602000DD, 0x0001640060400176,
+	0x0001640060601EF8, 0x0001640060800232, 0x0001640060E01E8E, 0x0001640061000178,
+	0x0001640061201EF6, 0x0001640064601EF4, 0x0001680060200179, 0x0001680060401E90,
+	0x0001680060E0017B, 0x000168006180017D, 0x0001680064601E92, 0x0001680066201E94,
+	0x00018400600000E0, 0x00018400602000E1, 0x00018400604000E2, 0x00018400606000E3,
+	0x0001840060800101, 0x0001840060C00103, 0x0001840060E00227, 0x00018400610000E4,
+	0x0001840061201EA3, 0x00018400614000E5, 0x00018400618001CE, 0x0001840061E00201,
+	0x0001840062200203, 0x0001840064601EA1, 0x0001840064A01E01, 0x0001840065000105,
+	0x0001880060E01E03, 0x0001880064601E05, 0x0001880066201E07, 0x00018C0060200107,
+	0x00018C0060400109, 0x00018C0060E0010B, 0x00018C006180010D, 0x00018C0064E000E7,
+	0x0001900060E01E0B, 0x000190006180010F, 0x0001900064601E0D, 0x0001900064E01E11,
+	0x0001900065A01E13, 0x0001900066201E0F, 0x00019400600000E8, 0x00019400602000E9,
+	0x00019400604000EA, 0x0001940060601EBD, 0x0001940060800113, 0x0001940060C00115,
+	0x0001940060E00117, 0x00019400610000EB, 0x0001940061201EBB, 0x000194006180011B,
+	0x0001940061E00205, 0x0001940062200207, 0x0001940064601EB9, 0x0001940064E00229,
+	0x0001940065000119, 0x0001940065A01E19, 0x0001940066001E1B, 0x0001980060E01E1F,
+	0x00019C00602001F5, 0x00019C006040011D, 0x00019C0060801E21, 0x00019C0060C0011F,
+	0x00019C0060E00121, 0x00019C00618001E7, 0x00019C0064E00123, 0x0001A00060400125,
+	0x0001A00060E01E23, 0x0001A00061001E27, 0x0001A0006180021F, 0x0001A00064601E25,
+	0x0001A00064E01E29, 0x0001A00065C01E2B, 0x0001A00066201E96, 0x0001A400600000EC,
+	0x0001A400602000ED, 0x0001A400604000EE, 0x0001A40060600129, 0x0001A4006080012B,
+	0x0001A40060C0012D, 0x0001A400610000EF, 0x0001A40061201EC9, 0x0001A400618001D0,
+	0x0001A40061E00209, 0x0001A4006220020B, 0x0001A40064601ECB, 0x0001A4006500012F,
+	0x0001A40066001E2D, 0x0001A80060400135, 0x0001A800618001F0, 0x0001AC0060201E31,
+	0x0001AC00618001E9, 0x0001AC0064601E33, 0x0001AC0064E00137, 0x0001AC0066201E35,
+	0x0001B0006020013A, 0x0001B0006180013E, 0x0001B00064601E37, 0x0001B00064E0013C,
+	0x0001B00065A01E3D, 0x0001B00066201E3B, 0x0001B40060201E3F, 0x0001B40060E01E41,
+	0x0001B40064601E43, 0x0001B800600001F9, 0x0001B80060200144, 0x0001B800606000F1,
+	0x0001B80060E01E45, 0x0001B80061800148, 0x0001B80064601E47, 0x0001B80064E00146,
+	0x0001B80065A01E4B, 0x0001B80066201E49, 0x0001BC00600000F2, 0x0001BC00602000F3,
+	0x0001BC00604000F4, 0x0001BC00606000F5, 0x0001BC006080014D, 0x0001BC0060C0014F,
+	0x0001BC0060E0022F, 0x0001BC00610000F6, 0x0001BC0061201ECF, 0x0001BC0061600151,
+	0x0001BC00618001D2, 0x0001BC0061E0020D, 0x0001BC006220020F, 0x0001BC00636001A1,
+	0x0001BC0064601ECD, 0x0001BC00650001EB, 0x0001C00060201E55, 0x0001C00060E01E57,
+	0x0001C80060200155, 0x0001C80060E01E59, 0x0001C80061800159, 0x0001C80061E00211,
+	0x0001C80062200213, 0x0001C80064601E5B, 0x0001C80064E00157, 0x0001C80066201E5F,
+	0x0001CC006020015B, 0x0001CC006040015D, 0x0001CC0060E01E61, 0x0001CC0061800161,
+	0x0001CC0064601E63, 0x0001CC0064C00219, 0x0001CC0064E0015F, 0x0001D00060E01E6B,
+	0x0001D00061001E97, 0x0001D00061800165, 0x0001D00064601E6D, 0x0001D00064C0021B,
+	0x0001D00064E00163, 0x0001D00065A01E71, 0x0001D00066201E6F, 0x0001D400600000F9,
+	0x0001D400602000FA, 0x0001D400604000FB, 0x0001D40060600169, 0x0001D4006080016B,
+	0x0001D40060C0016D, 0x0001D400610000FC, 0x0001D40061201EE7, 0x0001D4006140016F,
+	0x0001D40061600171, 0x0001D400618001D4, 0x0001D40061E00215, 0x0001D40062200217,
+	0x0001D400636001B0, 0x0001D40064601EE5, 0x0001D40064801E73, 0x0001D40065000173,
+	0x0001D40065A01E77, 0x0001D40066001E75, 0x0001D80060601E7D, 0x0001D80064601E7F,
+	0x0001DC0060001E81, 0x0001DC0060201E83, 0x0001DC0060400175, 0x0001DC0060E01E87,
+	0x0001DC0061001E85, 0x0001DC0061401E98, 0x0001DC0064601E89, 0x0001E00060E01E8B,
+	0x0001E00061001E8D, 0x0001E40060001EF3, 0x0001E400602000FD, 0x0001E40060400177,
+	0x0001E40060601EF9, 0x0001E40060800233, 0x0001E40060E01E8F, 0x0001E400610000FF,
+	0x0001E40061201EF7, 0x0001E40061401E99, 0x0001E40064601EF5, 0x0001E8006020017A,
+	0x0001E80060401E91, 0x0001E80060E0017C, 0x0001E8006180017E, 0x0001E80064601E93,
+	0x0001E80066201E95, 0x0002A00060001FED, 0x0002A00060200385, 0x0002A00068401FC1,
+	0x0003080060001EA6, 0x0003080060201EA4, 0x0003080060601EAA, 0x0003080061201EA8,
+	0x00031000608001DE, 0x00031400602001FA, 0x00031800602001FC, 0x00031800608001E2,
+	0x00031C0060201E08, 0x0003280060001EC0, 0x0003280060201EBE, 0x0003280060601EC4,
+	0x0003280061201EC2, 0x00033C0060201E2E, 0x0003500060001ED2, 0x0003500060201ED0,
+	0x0003500060601ED6, 0x0003500061201ED4, 0x0003540060201E4C, 0x000354006080022C,
+	0x0003540061001E4E, 0x000358006080022A, 0x00036000602001FE, 0x00037000600001DB,
+	0x00037000602001D7, 0x00037000608001D5, 0x00037000618001D9, 0x0003880060001EA7,
+	0x0003880060201EA5, 0x0003880060601EAB, 0x0003880061201EA9, 0x00039000608001DF,
+	0x00039400602001FB, 0x00039800602001FD, 0x00039800608001E3, 0x00039C0060201E09,
+	0x0003A80060001EC1, 0x0003A80060201EBF, 0x0003A80060601EC5, 0x0003A80061201EC3,
+	0x0003BC0060201E2F, 0x0003D00060001ED3, 0x0003D00060201ED1, 0x0003D00060601ED7,
+	0x0003D00061201ED5, 0x0003D40060201E4D, 0x0003D4006080022D, 0x0003D40061001E4F,
+	0x0003D8006080022B, 0x0003E000602001FF, 0x0003F000600001DC, 0x0003F000602001D8,
+	0x0003F000608001D6, 0x0003F000618001DA, 0x0004080060001EB0, 0x0004080060201EAE,
+	0x0004080060601EB4, 0x0004080061201EB2, 0x00040C0060001EB1, 0x00040C0060201EAF,
+	0x00040C0060601EB5, 0x00040C0061201EB3, 0x0004480060001E14, 0x0004480060201E16,
+	0x00044C0060001E15, 0x00044C0060201E17, 0x0005300060001E50, 0x0005300060201E52,
+	0x0005340060001E51, 0x0005340060201E53, 0x0005680060E01E64, 0x00056C0060E01E65,
+	0x0005800060E01E66, 0x0005840060E01E67, 0x0005A00060201E78, 0x0005A40060201E79,
+	0x0005A80061001E7A, 0x0005AC0061001E7B, 0x0005FC0060E01E9B, 0x0006800060001EDC,
+	0x0006800060201EDA, 0x0006800060601EE0, 0x0006800061201EDE, 0x0006800064601EE2,
+	0x0006840060001EDD, 0x0006840060201EDB, 0x0006840060601EE1, 0x0006840061201EDF,
+	0x0006840064601EE3, 0x0006BC0060001EEA, 0x0006BC0060201EE8, 0x0006BC0060601EEE,
+	0x0006BC0061201EEC, 0x0006BC0064601EF0, 0x0006C00060001EEB, 0x0006C00060201EE9,
+	0x0006C00060601EEF, 0x0006C00061201EED, 0x0006C00064601EF1, 0x0006DC00618001EE,
+	0x0007A800608001EC, 0x0007AC00608001ED, 0x00089800608001E0, 0x00089C00608001E1,
+	0x0008A00060C01E1C, 0x0008A40060C01E1D, 0x0008B80060800230, 0x0008BC0060800231,
+	0x000A4800618001EF, 0x000E440060001FBA, 0x000E440060200386, 0x000E440060801FB9,
+	0x000E440060C01FB8, 0x000E440062601F08, 0x000E440062801F09, 0x000E440068A01FBC,
+	0x000E540060001FC8, 0x000E540060200388, 0x000E540062601F18, 0x000E540062801F19,
+	0x000E5C0060001FCA, 0x000E5C0060200389, 0x000E5C0062601F28, 0x000E5C0062801F29,
+	0x000E5C0068A01FCC, 0x000E640060001FDA, 0x000E64006020038A, 0x000E640060801FD9,
+	0x000E640060C01FD8, 0x000E6400610003AA, 0x000E640062601F38, 0x000E640062801F39,
+	0x000E7C0060001FF8, 0x000E7C006020038C, 0x000E7C0062601F48, 0x000E7C0062801F49,
+	0x000E840062801FEC, 0x000E940060001FEA, 0x000E94006020038E, 0x000E940060801FE9,
+	0x000E940060C01FE8, 0x000E9400610003AB, 0x000E940062801F59, 0x000EA40060001FFA,
+	0x000EA4006020038F, 0x000EA40062601F68, 0x000EA40062801F69, 0x000EA40068A01FFC,
+	0x000EB00068A01FB4, 0x000EB80068A01FC4, 0x000EC40060001F70, 0x000EC400602003AC,
+	0x000EC40060801FB1, 0x000EC40060C01FB0, 0x000EC40062601F00, 0x000EC40062801F01,
+	0x000EC40068401FB6, 0x000EC40068A01FB3, 0x000ED40060001F72, 0x000ED400602003AD,
+	0x000ED40062601F10, 0x000ED40062801F11, 0x000EDC0060001F74, 0x000EDC00602003AE,
+	0x000EDC0062601F20, 0x000EDC0062801F21, 0x000EDC0068401FC6, 0x000EDC0068A01FC3,
+	0x000EE40060001F76, 0x000EE400602003AF, 0x000EE40060801FD1, 0x000EE40060C01FD0,
+	0x000EE400610003CA, 0x000EE40062601F30, 0x000EE40062801F31, 0x000EE40068401FD6,
+	0x000EFC0060001F78, 0x000EFC00602003CC, 0x000EFC0062601F40, 0x000EFC0062801F41,
+	0x000F040062601FE4, 0x000F040062801FE5, 0x000F140060001F7A, 0x000F1400602003CD,
+	0x000F140060801FE1, 0x000F140060C01FE0, 0x000F1400610003CB, 0x000F140062601F50,
+	0x000F140062801F51, 0x000F140068401FE6, 0x000F240060001F7C, 0x000F2400602003CE,
+	0x000F240062601F60, 0x000F240062801F61, 0x000F240068401FF6, 0x000F240068A01FF3,
+	0x000F280060001FD2, 0x000F280060200390, 0x000F280068401FD7, 0x000F2C0060001FE2,
+	0x000F2C00602003B0, 0x000F2C0068401FE7, 0x000F380068A01FF4, 0x000F4800602003D3,
+	0x000F4800610003D4, 0x0010180061000407, 0x0010400060C004D0, 0x00104000610004D2,
+	0x00104C0060200403, 0x0010540060000400, 0x0010540060C004D6, 0x0010540061000401,
+	0x0010580060C004C1, 0x00105800610004DC, 0x00105C00610004DE, 0x001060006000040D,
+	0x00106000608004E2, 0x0010600060C00419, 0x00106000610004E4, 0x001068006020040C,
+	0x00107800610004E6, 0x00108C00608004EE, 0x00108C0060C0040E, 0x00108C00610004F0,
+	0x00108C00616004F2, 0x00109C00610004F4, 0x0010AC00610004F8, 0x0010B400610004EC,
+	0x0010C00060C004D1, 0x0010C000610004D3, 0x0010CC0060200453, 0x0010D40060000450,
+	0x0010D40060C004D7, 0x0010D40061000451, 0x0010D80060C004C2, 0x0010D800610004DD,
+	0x0010DC00610004DF, 0x0010E0006000045D, 0x0010E000608004E3, 0x0010E00060C00439,
+	0x0010E000610004E5, 0x0010E8006020045C, 0x0010F800610004E7, 0x00110C00608004EF,
+	0x00110C0060C0045E, 0x00110C00610004F1, 0x00110C00616004F3, 0x00111C00610004F5,
+	0x00112C00610004F9, 0x00113400610004ED, 0x0011580061000457, 0x0011D00061E00476,
+	0x0011D40061E00477, 0x00136000610004DA, 0x00136400610004DB, 0x0013A000610004EA,
+	0x0013A400610004EB, 0x00189C00CA600622, 0x00189C00CA800623, 0x00189C00CAA00625,
+	0x00192000CA800624, 0x00192800CA800626, 0x001B0400CA8006C2, 0x001B4800CA8006D3,
+	0x001B5400CA8006C0, 0x0024A00127800929, 0x0024C00127800931, 0x0024CC0127800934,
+	0x00271C0137C009CB, 0x00271C013AE009CC, 0x002D1C0167C00B4B, 0x002D1C016AC00B48,
+	0x002D1C016AE00B4C, 0x002E48017AE00B94, 0x002F180177C00BCA, 0x002F18017AE00BCC,
+	0x002F1C0177C00BCB, 0x003118018AC00C48, 0x0032FC019AA00CC0, 0x0033180198400CCA,
+	0x003318019AA00CC7, 0x003318019AC00CC8, 0x003328019AA00CCB, 0x00351801A7C00D4A,
+	0x00351801AAE00D4C, 0x00351C01A7C00D4B, 0x00376401B9400DDA, 0x00376401B9E00DDC,
+	0x00376401BBE00DDE, 0x00377001B9400DDD, 0x0040940205C01026, 0x006C140366A01B06,
+	0x006C1C0366A01B08, 0x006C240366A01B0A, 0x006C2C0366A01B0C, 0x006C340366A01B0E,
+	0x006C440366A01B12, 0x006CE80366A01B3B, 0x006CF00366A01B3D, 0x006CF80366A01B40,
+	0x006CFC0366A01B41, 0x006D080366A01B43, 0x0078D80060801E38, 0x0078DC0060801E39,
+	0x0079680060801E5C, 0x00796C0060801E5D, 0x0079880060E01E68, 0x00798C0060E01E69,
+	0x007A800060401EAC, 0x007A800060C01EB6, 0x007A840060401EAD, 0x007A840060C01EB7,
+	0x007AE00060401EC6, 0x007AE40060401EC7, 0x007B300060401ED8, 0x007B340060401ED9,
+	0x007C000060001F02, 0x007C000060201F04, 0x007C000068401F06, 0x007C000068A01F80,
+	0x007C040060001F03, 0x007C040060201F05, 0x007C040068401F07, 0x007C040068A01F81,
+	0x007C080068A01F82, 0x007C0C0068A01F83, 0x007C100068A01F84, 0x007C140068A01F85,
+	0x007C180068A01F86, 0x007C1C0068A01F87, 0x007C200060001F0A, 0x007C200060201F0C,
+	0x007C200068401F0E, 0x007C200068A01F88, 0x007C240060001F0B, 0x007C240060201F0D,
+	0x007C240068401F0F, 0x007C240068A01F89, 0x007C280068A01F8A, 0x007C2C0068A01F8B,
+	0x007C300068A01F8C, 0x007C340068A01F8D, 0x007C380068A01F8E, 0x007C3C0068A01F8F,
+	0x007C400060001F12, 0x007C400060201F14, 0x007C440060001F13, 0x007C440060201F15,
+	0x007C600060001F1A, 0x007C600060201F1C, 0x007C640060001F1B, 0x007C640060201F1D,
+	0x007C800060001F22, 0x007C800060201F24, 0x007C800068401F26, 0x007C800068A01F90,
+	0x007C840060001F23, 0x007C840060201F25, 0x007C840068401F27, 0x007C840068A01F91,
+	0x007C880068A01F92, 0x007C8C0068A01F93, 0x007C900068A01F94, 0x007C940068A01F95,
+	0x007C980068A01F96, 0x007C9C0068A01F97, 0x007CA00060001F2A, 0x007CA00060201F2C,
+	0x007CA00068401F2E, 0x007CA00068A01F98, 0x007CA40060001F2B, 0x007CA40060201F2D,
+	0x007CA40068401F2F, 0x007CA40068A01F99, 0x007CA80068A01F9A, 0x007CAC0068A01F9B,
+	0x007CB00068A01F9C, 0x007CB40068A01F9D, 0x007CB80068A01F9E, 0x007CBC0068A01F9F,
+	0x007CC00060001F32, 0x007CC00060201F34, 0x007CC00068401F36, 0x007CC40060001F33,
+	0x007CC40060201F35, 0x007CC40068401F37, 0x007CE00060001F3A, 0x007CE00060201F3C,
+	0x007CE00068401F3E, 0x007CE40060001F3B, 0x007CE40060201F3D, 0x007CE40068401F3F,
+	0x007D000060001F42, 0x007D000060201F44, 0x007D040060001F43, 0x007D040060201F45,
+	0x007D200060001F4A, 0x007D200060201F4C, 0x007D240060001F4B, 0x007D240060201F4D,
+	0x007D400060001F52, 0x007D400060201F54, 0x007D400068401F56, 0x007D440060001F53,
+	0x007D440060201F55, 0x007D440068401F57, 0x007D640060001F5B, 0x007D640060201F5D,
+	0x007D640068401F5F, 0x007D800060001F62, 0x007D800060201F64, 0x007D800068401F66,
+	0x007D800068A01FA0, 0x007D840060001F63, 0x007D840060201F65, 0x007D840068401F67,
+	0x007D840068A01FA1, 0x007D880068A01FA2, 0x007D8C0068A01FA3, 0x007D900068A01FA4,
+	0x007D940068A01FA5, 0x007D980068A01FA6, 0x007D9C0068A01FA7, 0x007DA00060001F6A,
+	0x007DA00060201F6C, 0x007DA00068401F6E, 0x007DA00068A01FA8, 0x007DA40060001F6B,
+	0x007DA40060201F6D, 0x007DA40068401F6F, 0x007DA40068A01FA9, 0x007DA80068A01FAA,
+	0x007DAC0068A01FAB, 0x007DB00068A01FAC, 0x007DB40068A01FAD, 0x007DB80068A01FAE,
+	0x007DBC0068A01FAF, 0x007DC00068A01FB2, 0x007DD00068A01FC2, 0x007DF00068A01FF2,
+	0x007ED80068A01FB7, 0x007EFC0060001FCD, 0x007EFC0060201FCE, 0x007EFC0068401FCF,
+	0x007F180068A01FC7, 0x007FD80068A01FF7, 0x007FF80060001FDD, 0x007FF80060201FDE,
+	0x007FF80068401FDF, 0x008640006700219A, 0x008648006700219B, 0x00865000670021AE,
+	0x00874000670021CD, 0x00874800670021CF, 0x00875000670021CE, 0x00880C0067002204,
+	0x0088200067002209, 0x00882C006700220C, 0x00888C0067002224, 0x0088940067002226,
+	0x0088F00067002241, 0x00890C0067002244, 0x0089140067002247, 0x0089200067002249,
+	0x008934006700226D, 0x0089840067002262, 0x0089900067002270, 0x0089940067002271,
+	0x0089C80067002274, 0x0089CC0067002275, 0x0089D80067002278, 0x0089DC0067002279,
+	0x0089E80067002280, 0x0089EC0067002281, 0x0089F000670022E0, 0x0089F400670022E1,
+	0x008A080067002284, 0x008A0C0067002285, 0x008A180067002288, 0x008A1C0067002289,
+	0x008A4400670022E2, 0x008A4800670022E3, 0x008A8800670022AC, 0x008AA000670022AD,
+	0x008AA400670022AE, 0x008AAC00670022AF, 0x008AC800670022EA, 0x008ACC00670022EB,
+	0x008AD000670022EC, 0x008AD400670022ED, 0x00C1180613203094, 0x00C12C061320304C,
+	0x00C134061320304E, 0x00C13C0613203050, 0x00C1440613203052, 0x00C14C0613203054,
+	0x00C1540613203056, 0x00C15C0613203058, 0x00C164061320305A, 0x00C16C061320305C,
+	0x00C174061320305E, 0x00C17C0613203060, 0x00C1840613203062, 0x00C1900613203065,
+	0x00C1980613203067, 0x00C1A00613203069, 0x00C1BC0613203070, 0x00C1BC0613403071,
+	0x00C1C80613203073, 0x00C1C80613403074, 0x00C1D40613203076, 0x00C1D40613403077,
+	0x00C1E00613203079, 0x00C1E0061340307A, 0x00C1EC061320307C, 0x00C1EC061340307D,
+	0x00C274061320309E, 0x00C29806132030F4, 0x00C2AC06132030AC, 0x00C2B406132030AE,
+	0x00C2BC06132030B0, 0x00C2C406132030B2, 0x00C2CC06132030B4, 0x00C2D406132030B6,
+	0x00C2DC06132030B8, 0x00C2E406132030BA, 0x00C2EC06132030BC, 0x00C2F406132030BE,
+	0x00C2FC06132030C0, 0x00C30406132030C2, 0x00C31006132030C5, 0x00C31806132030C7,
+	0x00C32006132030C9, 0x00C33C06132030D0, 0x00C33C06134030D1, 0x00C34806132030D3,
+	0x00C34806134030D4, 0x00C35406132030D6, 0x00C35406134030D7, 0x00C36006132030D9,
+	0x00C36006134030DA, 0x00C36C06132030DC, 0x00C36C06134030DD, 0x00C3BC06132030F7,
+	0x00C3C006132030F8, 0x00C3C406132030F9, 0x00C3C806132030FA, 0x00C3F406132030FE,
+	0x044264221741109A, 0x04426C221741109C, 0x04429422174110AB, 0x0444C42224E1112E,
+	0x0444C82224E1112F, 0x044D1C2267C1134B, 0x044D1C226AE1134C, 0x0452E422960114BC,
+	0x0452E422974114BB, 0x0452E42297A114BE, 0x0456E022B5E115BA, 0x0456E422B5E115BB,
+	0x0464D42326011938
+};
+#endif
@@ -0,0 +1,103 @@
+/*
+ * exhaustive tests of the single-precision floating-point conversions
+ * - opt-in, not a part of the regular tests since it converts every one of 2^32 bit patterns, that takes about an hour on a single core
+ * - standalone, exits with non-zero code on failure: c++ -std=c++20 -O2 -I<include-directory> tests/convert-float.cpp -o test-convert-float
+ * - usage: test-convert-float [<first bits> <last bits>], hexadecimal inclusive range of the bit patterns to check, all of them by default, e.g. to split the range between several processes
+ */
+#define Q_CRT_STRING_CONVERT
+#include <q-tee/crt/crt.h>
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+static int nFailedCount = 0;
+
+static void Expect(const bool bCondition, const char* szName, const std::uint32_t uBits, const char* szSource)
+{
+	if (bCondition)
+		return;
+
+	// limit the output when the conversion is broken entirely
+	if (++nFailedCount <= 100)
+		std::fprintf(stderr, "%s failed for 0x%08X: %s\n", szName, uBits, szSource);
+}
+
+// parsed value is the same as the original one, any NaN matches any other NaN, since the payload isn't the part of the string
+static bool IsSameValue(const float flValue, const float flOriginal)
+{
+	if (std::isnan(flOriginal))
+		return std::isnan(flValue);
+
+	return std::bit_cast<std::uint32_t>(flValue) == std::bit_cast<std::uint32_t>(flOriginal);
+}
+
+// the shortest and the 9 significant digits representations round-trip through 'StringToReal()' and agree with 'strtof()', the shortest representation of 'to_chars()' round-trips too
+static void TestBits(const std::uint32_t uBits)
+{
+	const float flValue = std::bit_cast<float>(uBits);
+
+	char szShortest[32];
+	const char* szShortestBegin = CRT::RealToString(flValue, szShortest, sizeof(szShortest), CRT::REAL_FORMAT_SHORTEST);
+	if (szShortestBegin == nullptr)
+	{
+		Expect(false, "RealToString<float>", uBits, "shortest notation doesn't fit");
+		return;
+	}
+
+	const float flShortest = CRT::StringToReal<float>(szShortestBegin);
+	Expect(IsSameValue(flShortest, flValue), "shortest RealToString -> StringToReal<float>", uBits, szShortestBegin);
+	Expect(IsSameValue(flShortest, std::strtof(szShortestBegin, nullptr)), "StringToReal<float> of shortest against strtof", uBits, szShortestBegin);
+
+	char szGeneral[32];
+	const char* szGeneralBegin = CRT::RealToString(flValue, szGeneral, sizeof(szGeneral), CRT::REAL_FORMAT_GENERAL, 9);
+	if (szGeneralBegin == nullptr)
+	{
+		Expect(false, "RealToString<float>", uBits, "general notation doesn't fit");
+		return;
+	}
+
+	const float flGeneral = CRT::StringToReal<float>(szGeneralBegin);
+	Expect(IsSameValue(flGeneral, flValue), "general RealToString -> StringToReal<float>", uBits, szGeneralBegin);
+	Expect(IsSameValue(flGeneral, std::strtof(szGeneralBegin, nullptr)), "StringToReal<float> of general against strtof", uBits, szGeneralBegin);
+
+	// NaN and infinity are written by 'to_chars()' in the same form as 'StringToReal()' accepts them
+	char szReference[32];
+	const std::to_chars_result result = std::to_chars(szReference, szReference + sizeof(szReference) - 1, flValue);
+	*result.ptr = '\0';
+	Expect(IsSameValue(CRT::StringToReal<float>(szReference), flValue), "to_chars -> StringToReal<float>", uBits, szReference);
+}
+
+int main(int nArgumentCount, char** arrArguments)
+{
+	std::uint32_t uFirstBits = 0U, uLastBits = 0xFFFFFFFF;
+	if (nArgumentCount == 3)
+	{
+		uFirstBits = static_cast<std::uint32_t>(std::strtoul(arrArguments[1], nullptr, 16));
+		uLastBits = static_cast<std::uint32_t>(std::strtoul(arrArguments[2], nullptr, 16));
+	}
+	else if (nArgumentCount != 1)
+	{
+		std::fprintf(stderr, "usage: test-convert-float [<first bits> <last bits>]\n");
+		return EXIT_FAILURE;
+	}
+
+	for (std::uint32_t uBits = uFirstBits; ; ++uBits)
+	{
+		TestBits(uBits);
+
+		if (uBits == uLastBits)
+			break;
+	}
+
+	if (nFailedCount != 0)
+	{
+		std::fprintf(stderr, "%d checks failed\n", nFailedCount);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
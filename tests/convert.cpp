@@ -0,0 +1,148 @@
+/*
+ * tests of the string conversion functionality
+ * - standalone, exits with non-zero code on failure: c++ -std=c++20 -O2 -I<include-directory> tests/convert.cpp -o test-convert
+ */
+#define Q_CRT_STRING_CONVERT
+#include <q-tee/crt/crt.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+
+static int nFailedCount = 0;
+
+static void Expect(const bool bCondition, const char* szName, const char* szDescription)
+{
+	if (bCondition)
+		return;
+
+	std::fprintf(stderr, "%s failed: %s\n", szName, szDescription);
+	++nFailedCount;
+}
+
+// day of the month is padded with space to the two digits, e.g. "Dec  1"
+static void TestTimeToStringMonthDay()
+{
+	std::tm time = { };
+	time.tm_year = 2023 - 1900;
+	time.tm_mon = 11;
+
+	for (int iMonthDay = 1; iMonthDay <= 31; ++iMonthDay)
+	{
+		time.tm_mday = iMonthDay;
+
+		char szExpected[8];
+		szExpected[0] = (iMonthDay < 10 ? ' ' : static_cast<char>('0' + iMonthDay / 10));
+		szExpected[1] = static_cast<char>('0' + iMonthDay % 10);
+		szExpected[2] = '\0';
+
+		char szBuffer[8];
+		const std::size_t nLength = CRT::TimeToString(szBuffer, sizeof(szBuffer), "%e", &time);
+		Expect(nLength == 2U && CRT::StringCompare(szBuffer, szExpected) == 0, "TimeToString", szExpected);
+
+		wchar_t wszBuffer[8];
+		const std::size_t nWideLength = CRT::TimeToString(wszBuffer, sizeof(wszBuffer) / sizeof(wchar_t), L"%e", &time);
+		Expect(nWideLength == 2U && wszBuffer[0] == static_cast<wchar_t>(szExpected[0]) && wszBuffer[1] == static_cast<wchar_t>(szExpected[1]), "wide TimeToString", szExpected);
+	}
+}
+
+// compiled time format converts the same as 'TimeToString()', and fails every conversion when the expanded format doesn't fit its capacity
+static void TestTimeFormat()
+{
+	std::tm time = { };
+	time.tm_year = 2024 - 1900;
+	time.tm_mon = 1;
+	time.tm_mday = 29;
+	time.tm_hour = 13;
+	time.tm_min = 5;
+	time.tm_sec = 7;
+
+	char szExpected[64];
+	CRT::TimeToString(szExpected, sizeof(szExpected), "%Y-%m-%d %T", &time);
+
+	char szBuffer[64];
+	CRT::TimeFormat_t<char> format("%Y-%m-%d %T");
+	Expect(format.IsValid() && format.Format(szBuffer, sizeof(szBuffer), &time) == CRT::StringLength(szExpected) && CRT::StringCompare(szBuffer, szExpected) == 0, "TimeFormat_t", szExpected);
+
+	// expanded format is longer than the capacity of 8 characters
+	CRT::TimeFormat_t<char, 8U> formatSmall("%Y-%m-%d %T");
+	Expect(!formatSmall.IsValid() && formatSmall.Format(szBuffer, sizeof(szBuffer), &time) == 0U, "TimeFormat_t", "expanded format doesn't fit the capacity");
+}
+
+// numbers with more significant digits than the significand keeps are rounded by all of their digits
+static void TestStringToRealLongDigits()
+{
+	struct RealCase_t
+	{
+		const char* szSource;
+		double dbExpected;
+		float flExpected;
+	};
+
+	static constexpr RealCase_t arrCases[] =
+	{
+		{ "3216711630407369.256", 0x1.6db2a14268d93p+51, 0x1.6db2a2p+51F },
+		// halfway between two doubles, and tiny amounts below and above it
+		{ "1.00000000000000011102230246251565404236316680908203125", 0x1.0p+0, 0x1.0p+0F },
+		{ "1.00000000000000011102230246251565404236316680908203124999999999999999999999", 0x1.0p+0, 0x1.0p+0F },
+		{ "1.00000000000000011102230246251565404236316680908203125000000000000000000001", 0x1.0000000000001p+0, 0x1.0p+0F },
+		{ "9007199254740993", 0x1.0p+53, 0x1.0p+53F },
+		{ "9007199254740993.0000000000000000000000001", 0x1.0000000000001p+53, 0x1.0p+53F },
+		// halfway between two floats
+		{ "7.00649232162408535461864791644958065640130970938257885878534141944895541342930300743319094181060791015625e-46", 0x1.0p-150, 0.0F },
+		{ "7.00649232162408535461864791644958065640130970938257885878534141944895541342930300743319094181060791015625001e-46", 0x1.0p-150, 0x1.0p-149F }
+	};
+
+	for (const RealCase_t& realCase : arrCases)
+	{
+		Expect(CRT::StringToReal<double>(realCase.szSource) == realCase.dbExpected, "StringToReal<double>", realCase.szSource);
+		Expect(CRT::StringToReal<float>(realCase.szSource) == realCase.flExpected, "StringToReal<float>", realCase.szSource);
+	}
+}
+
+#ifdef __SIZEOF_INT128__
+// 128-bit integers convert in both directions also with the strict standard dialect, where the standard library doesn't treat them as integral types
+static void TestInteger128()
+{
+	constexpr __int128_t iMinimal = -static_cast<__int128_t>((~static_cast<__uint128_t>(0U)) >> 1U) - 1;
+	constexpr __uint128_t uMaximal = ~static_cast<__uint128_t>(0U);
+	const char* szMinimal = "-170141183460469231731687303715884105728";
+	const char* szMaximal = "340282366920938463463374607431768211455";
+
+	char szBuffer[CRT::IntegerToString_t<__int128_t, 10U>::MaxCount()];
+	Expect(CRT::StringCompare(CRT::IntegerToString(iMinimal, szBuffer), szMinimal) == 0, "IntegerToString<__int128>", szMinimal);
+	Expect(CRT::StringCompare(CRT::IntegerToString(uMaximal, szBuffer), szMaximal) == 0, "IntegerToString<unsigned __int128>", szMaximal);
+
+	*CRT::IntegerToChars(iMinimal, szBuffer) = '\0';
+	Expect(CRT::StringCompare(szBuffer, szMinimal) == 0, "IntegerToChars<__int128>", szMinimal);
+
+	Expect(CRT::StringToInteger<__int128_t>(szMinimal) == iMinimal, "StringToInteger<__int128>", szMinimal);
+	Expect(CRT::StringToInteger<__uint128_t>(szMaximal) == uMaximal, "StringToInteger<unsigned __int128>", szMaximal);
+
+	// clamped on overflow
+	int nError = 0;
+	Expect(CRT::StringToInteger<__int128_t>("-170141183460469231731687303715884105729", static_cast<char**>(nullptr), 10, &nError) == iMinimal && nError == ERANGE, "StringToInteger<__int128>", "negative overflow");
+
+	__uint128_t uValue = 0U;
+	const CRT::CharsToNumberResult_t<char> result = CRT::CharsToInteger(szMaximal, szMaximal + CRT::StringLength(szMaximal), uValue);
+	Expect(result.nError == 0 && uValue == uMaximal, "CharsToInteger<unsigned __int128>", szMaximal);
+}
+#endif
+
+int main()
+{
+	TestTimeToStringMonthDay();
+	TestTimeFormat();
+	TestStringToRealLongDigits();
+#ifdef __SIZEOF_INT128__
+	TestInteger128();
+#endif
+
+	if (nFailedCount != 0)
+	{
+		std::fprintf(stderr, "%d checks failed\n", nFailedCount);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
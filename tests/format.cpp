@@ -0,0 +1,133 @@
+/*
+ * tests of the string formatting functionality
+ * - standalone, exits with non-zero code on failure: c++ -std=c++20 -O2 -I<include-directory> tests/format.cpp -o test-format
+ */
+#define Q_CRT_STRING_CONVERT
+#define Q_CRT_STRING_FORMAT
+#include <q-tee/crt/crt.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+static int nFailedCount = 0;
+
+static void Expect(const bool bCondition, const char* szName, const char* szDescription)
+{
+	if (bCondition)
+		return;
+
+	std::fprintf(stderr, "%s failed: %s\n", szName, szDescription);
+	++nFailedCount;
+}
+
+// check that the ring sink keeps the last characters of the @a`szWritten` in the order they were written
+static void ExpectRingSink(const CRT::FormatRingSink_t<char>& sink, const std::size_t nStorageSize, const char* szWritten, const char* szDescription)
+{
+	const std::size_t nWrittenLength = CRT::StringLength(szWritten);
+	const std::size_t nKeptLength = (nWrittenLength < nStorageSize ? nWrittenLength : nStorageSize);
+
+	char szBuffer[64];
+	const char* szBufferEnd = sink.CopyTo(szBuffer);
+
+	bool bIsEqual = (sink.GetLength() == nKeptLength && sink.GetTotalLength() == nWrittenLength && static_cast<std::size_t>(szBufferEnd - szBuffer) == nKeptLength);
+	for (std::size_t i = 0U; bIsEqual && i < nKeptLength; ++i)
+		bIsEqual = (szBuffer[i] == szWritten[nWrittenLength - nKeptLength + i]);
+
+	Expect(bIsEqual, "FormatRingSink_t", szDescription);
+}
+
+// ring sink keeps the last written characters when its storage is exactly full, one character past full and wrapped multiple times
+static void TestRingSink()
+{
+	char szStorage[4];
+
+	CRT::FormatRingSink_t<char> sink(szStorage, sizeof(szStorage));
+	ExpectRingSink(sink, sizeof(szStorage), "", "empty");
+
+	sink.Write("abc", 3U);
+	ExpectRingSink(sink, sizeof(szStorage), "abc", "partially full");
+
+	sink.Write("d", 1U);
+	ExpectRingSink(sink, sizeof(szStorage), "abcd", "exactly full");
+
+	sink.Write("e", 1U);
+	ExpectRingSink(sink, sizeof(szStorage), "abcde", "one past full");
+
+	sink.Reset();
+	sink.Write("abcd", 4U);
+	ExpectRingSink(sink, sizeof(szStorage), "abcd", "exactly full by single write");
+
+	sink.Reset();
+	sink.Write("abcde", 5U);
+	ExpectRingSink(sink, sizeof(szStorage), "abcde", "one past full by single write");
+
+	sink.Reset();
+	sink.Write("abcdefghijkl", 12U);
+	ExpectRingSink(sink, sizeof(szStorage), "abcdefghijkl", "exactly full after multiple wraps by single write");
+
+	// write the same sequence in pieces of the different lengths, so the storage is wrapped at every position
+	const char* szSequence = "0123456789abcdefghijklmnopqrstuvwxyz";
+	for (std::size_t nPieceLength = 1U; nPieceLength <= 9U; ++nPieceLength)
+	{
+		sink.Reset();
+
+		char szWritten[40] = { };
+		for (std::size_t nWrittenLength = 0U; nWrittenLength < 36U;)
+		{
+			const std::size_t nLength = (nPieceLength < 36U - nWrittenLength ? nPieceLength : 36U - nWrittenLength);
+			sink.Write(szSequence + nWrittenLength, nLength);
+			nWrittenLength += nLength;
+
+			CRT::StringCopyN(szWritten, szSequence, nWrittenLength);
+			szWritten[nWrittenLength] = '\0';
+			ExpectRingSink(sink, sizeof(szStorage), szWritten, "multiple wraps");
+		}
+	}
+
+	sink.Reset();
+	sink.Fill('x', 4U);
+	ExpectRingSink(sink, sizeof(szStorage), "xxxx", "exactly full by fill");
+
+	sink.Fill('y', 6U);
+	ExpectRingSink(sink, sizeof(szStorage), "xxxxyyyyyy", "multiple wraps by fill");
+
+	sink.Reset();
+	CRT::StringPrintTo(sink, "%d-%d", 12, 345);
+	ExpectRingSink(sink, sizeof(szStorage), "12-345", "formatted output");
+}
+
+// null string is written as "(null)" only when the precision allows the whole of it, as of glibc
+static void TestNullString()
+{
+	const char* szNull = nullptr;
+	char szBuffer[32];
+
+	CRT::StringPrint(szBuffer, "%s|", szNull);
+	Expect(CRT::StringCompare(szBuffer, "(null)|") == 0, "StringPrint", "null string without precision");
+
+	CRT::StringPrint(szBuffer, "%.6s|", szNull);
+	Expect(CRT::StringCompare(szBuffer, "(null)|") == 0, "StringPrint", "null string with precision of its length");
+
+	CRT::StringPrint(szBuffer, "%.3s|", szNull);
+	Expect(CRT::StringCompare(szBuffer, "|") == 0, "StringPrint", "null string with smaller precision");
+
+	CRT::StringPrint(szBuffer, "%5.2s|", szNull);
+	Expect(CRT::StringCompare(szBuffer, "     |") == 0, "StringPrint", "null string with smaller precision and width");
+
+	CRT::StringPrint(szBuffer, "%.*s|", 5, szNull);
+	Expect(CRT::StringCompare(szBuffer, "|") == 0, "StringPrint", "null string with smaller precision argument");
+}
+
+int main()
+{
+	TestRingSink();
+	TestNullString();
+
+	if (nFailedCount != 0)
+	{
+		std::fprintf(stderr, "%d checks failed\n", nFailedCount);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
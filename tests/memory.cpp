@@ -0,0 +1,93 @@
+/*
+ * tests of the memory functionality
+ * - standalone, exits with non-zero code on failure: c++ -std=c++20 -O2 -I<include-directory> tests/memory.cpp -o test-memory
+ */
+#include <q-tee/crt/crt.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+static int nFailedCount = 0;
+
+static void Expect(const bool bCondition, const char* szName, const std::size_t nOffset, const std::size_t nCount)
+{
+	if (bCondition)
+		return;
+
+	std::fprintf(stderr, "%s failed, offset: %zu, count: %zu\n", szName, nOffset, nCount);
+	++nFailedCount;
+}
+
+// cover the vectorized loops with several blocks, including the sizes of 32 bytes and up, and the unaligned heads
+static void TestMemorySet()
+{
+	constexpr std::size_t kGuardSize = 16U;
+	std::uint8_t arrBuffer[512 + kGuardSize * 2U];
+
+	for (std::size_t nOffset = 0U; nOffset < 16U; ++nOffset)
+	{
+		for (std::size_t nCount = 0U; nCount <= 300U; ++nCount)
+		{
+			for (std::uint8_t& uByte : arrBuffer)
+				uByte = 0xCC;
+
+			std::uint8_t* pDestination = arrBuffer + kGuardSize + nOffset;
+			const void* pEnd = CRT::MemorySet(pDestination, 0x5A, nCount);
+
+			bool bIsValid = (pEnd == pDestination + nCount);
+			for (std::size_t i = 0U; i < sizeof(arrBuffer); ++i)
+			{
+				const bool bIsInside = (arrBuffer + i >= pDestination && arrBuffer + i < pDestination + nCount);
+				bIsValid &= (arrBuffer[i] == (bIsInside ? 0x5A : 0xCC));
+			}
+
+			Expect(bIsValid, "MemorySet", nOffset, nCount);
+		}
+	}
+}
+
+static void TestMemoryCopy()
+{
+	constexpr std::size_t kGuardSize = 16U;
+	std::uint8_t arrSource[512];
+	std::uint8_t arrBuffer[512 + kGuardSize * 2U];
+
+	for (std::size_t i = 0U; i < sizeof(arrSource); ++i)
+		arrSource[i] = static_cast<std::uint8_t>(i * 7U + 1U);
+
+	for (std::size_t nOffset = 0U; nOffset < 16U; ++nOffset)
+	{
+		for (std::size_t nCount = 0U; nCount <= 300U; ++nCount)
+		{
+			for (std::uint8_t& uByte : arrBuffer)
+				uByte = 0xCC;
+
+			std::uint8_t* pDestination = arrBuffer + kGuardSize + nOffset;
+			const std::uint8_t* pSource = arrSource + (15U - nOffset);
+			const void* pEnd = CRT::MemoryCopy(pDestination, pSource, nCount);
+
+			bool bIsValid = (pEnd == pDestination + nCount);
+			for (std::size_t i = 0U; i < sizeof(arrBuffer); ++i)
+			{
+				const bool bIsInside = (arrBuffer + i >= pDestination && arrBuffer + i < pDestination + nCount);
+				bIsValid &= (arrBuffer[i] == (bIsInside ? pSource[arrBuffer + i - pDestination] : 0xCC));
+			}
+
+			Expect(bIsValid, "MemoryCopy", nOffset, nCount);
+		}
+	}
+}
+
+int main()
+{
+	TestMemorySet();
+	TestMemoryCopy();
+
+	if (nFailedCount != 0)
+	{
+		std::fprintf(stderr, "%d checks failed\n", nFailedCount);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,76 @@
+/*
+ * tests of the wide character type functionality
+ * - standalone, exits with non-zero code on failure: c++ -std=c++20 -O2 -I<include-directory> tests/wctype.cpp -o test-wctype
+ */
+#define Q_CRT_STRING_WIDE_TYPE
+#include <q-tee/crt/crt.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+// lookup tables cover all planes and must fit into 10KiB, well under the 11KiB of the original BMP-only tables
+static_assert(sizeof(CRT::arrWideCharacterTypeIndices) + sizeof(CRT::arrWideCharacterTypeOffsets) + sizeof(CRT::arrWideCharacterTypeLUT) + sizeof(CRT::arrWideCharacterTypePalette) + sizeof(CRT::arrWideCharacterTypeASCII) < 10U * 1024U);
+
+static int nFailedCount = 0;
+
+static void Expect(const std::uint32_t uChar, const std::uint8_t uExpectedType)
+{
+	const std::uint8_t uType = CRT::DETAIL::GetWideCharType(uChar);
+	if (uType == uExpectedType)
+		return;
+
+	std::fprintf(stderr, "GetWideCharType failed at U+%04X: 0x%02X, expected: 0x%02X\n", uChar, uType, uExpectedType);
+	++nFailedCount;
+}
+
+// types of the shipped tables, including the ones that differ from the general category rules of the recent Unicode versions
+static void TestTypes()
+{
+	using namespace CRT;
+
+	Expect(0x0009, TYPE_CONTROL | TYPE_SPACE | TYPE_BLANK);
+	Expect(0x0041, TYPE_UPPER | TYPE_ALPHA);
+	Expect(0x00AA, TYPE_PUNCT | TYPE_LOWER | TYPE_ALPHA);
+	Expect(0x00B2, TYPE_PUNCT | TYPE_DIGIT);
+	Expect(0x00B5, TYPE_PUNCT | TYPE_LOWER | TYPE_ALPHA);
+	Expect(0x00D7, TYPE_PUNCT);
+	Expect(0x0660, TYPE_DIGIT);
+	Expect(0x2028, TYPE_SPACE);
+	Expect(0x3000, TYPE_SPACE | TYPE_BLANK);
+	Expect(0x4E00, TYPE_ALPHA);
+	Expect(0xFF21, TYPE_UPPER | TYPE_ALPHA);
+
+	// supplementary planes
+	Expect(0x10400, TYPE_UPPER | TYPE_ALPHA);
+	Expect(0x10428, TYPE_LOWER | TYPE_ALPHA);
+	Expect(0x1D400, TYPE_UPPER | TYPE_ALPHA);
+	Expect(0x1F600, 0U);
+	Expect(0x20000, TYPE_ALPHA);
+	Expect(0xE0001, TYPE_CONTROL);
+	Expect(0x10FFFF, 0U);
+
+	// out of the Unicode range
+	Expect(0x110000, 0U);
+	Expect(0xFFFFFFFF, 0U);
+}
+
+// direct ASCII table must agree with the trie
+static void TestASCII()
+{
+	for (std::uint32_t uChar = 0U; uChar < 128U; ++uChar)
+		Expect(uChar, CRT::arrWideCharacterTypeASCII[uChar]);
+}
+
+int main()
+{
+	TestTypes();
+	TestASCII();
+
+	if (nFailedCount != 0)
+	{
+		std::fprintf(stderr, "%d checks failed\n", nFailedCount);
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,700 @@
+/*
+ * generator of the wide character type lookup tables ('string/wctype.inl') from the Unicode Character Database
+ * - standalone, depends only on the standard library: c++ -std=c++20 -O2 tools/unicode-wctype.cpp -o unicode-wctype
+ * - usage: unicode-wctype <ucd-directory> [-o <output>] [-v <existing>] [-r <rules>] [-l <legacy>] [-p <plane bits>] [-b <block bits>] [-i <index bits>] [-c <classes>]
+ *   <ucd-directory>  directory with 'UnicodeData.txt' and optionally 'DerivedCoreProperties.txt'
+ *   -o <output>      path of the output file, standard output by default
+ *   -v <existing>    path of the existing file to compare with the output instead of writing it, fails when they differ, e.g. to check that 'string/wctype.inl' is up to date
+ *   -r <rules>       classification rules: 'legacy' for the types of the shipped tables (default), 'category' for the general categories or 'derived' for the general categories with the case and alphabetic classes of 'DerivedCoreProperties.txt'
+ *   -l <legacy>      path of the legacy BMP types for the 'legacy' rules, 'tools/unicode-wctype-legacy.txt' by default
+ *   -p <plane bits>  log2 of codepoints count covered by single entry of the first stage, 10 by default
+ *   -b <block bits>  log2 of codepoints count covered by single entry of the second stage, 5 by default
+ *   -i <index bits>  bits per packed type index in the third stage: 1, 2, 4 or 8, the smallest fitting by default
+ *   -c <classes>     comma separated list of the emitted classes, all by default: control,space,blank,punct,digit,lower,upper,alpha
+ *
+ * layout of the tables:
+ * - all planes share the single three-stage trie of the packed type indices, that resolve through the palette of type flags,
+ *   so the lookup of any codepoint takes the same four loads, while equal blocks of BMP and supplementary planes are stored once
+ * - ASCII range has the separate table of type flags, to lookup them directly
+ *
+ * classification rules:
+ * - legacy: BMP types are read as is from the legacy file, since they don't follow any single UCD version, and each supplementary codepoint takes the most frequent BMP type of its general category
+ * - category and derived:
+ *   - control: general category 'Cc' or 'Cf', that includes C0 and C1 controls
+ *   - space: general category 'Zs', 'Zl', 'Zp', U+0009..U+000D or U+0085 (next line)
+ *   - blank: U+0009 or general category 'Zs' without '<noBreak>' decomposition
+ *   - punct: general category 'P*', 'S*' or 'No', i.e. any graphic character that is not a mark, a letter or a digit, as of 'ispunct()' for the default C locale
+ *   - digit: general category 'Nd'
+ *   - lower, upper, alpha: general category 'Ll'/'Lt', 'Lu'/'Lt' and 'L*'/'Nl' with 'category', or 'Lowercase', 'Uppercase', 'Alphabetic' derived properties with 'derived'
+ */
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <iterator>
+#include <algorithm>
+
+enum EWideCharacterTypeFlags_t : std::uint8_t
+{
+	TYPE_CONTROL = 0x01,
+	TYPE_SPACE = 0x02,
+	TYPE_BLANK = 0x04,
+	TYPE_PUNCT = 0x08,
+	TYPE_DIGIT = 0x10,
+	TYPE_LOWER = 0x20,
+	TYPE_UPPER = 0x40,
+	TYPE_ALPHA = 0x80
+};
+
+static constexpr std::uint32_t kCodepointCount = 0x110000;
+static constexpr std::uint32_t kBMPCodepointCount = 0x10000;
+
+static constexpr struct
+{
+	const char* szName;
+	std::uint8_t uFlag;
+} arrClassNames[] =
+{
+	{ "control", TYPE_CONTROL },
+	{ "space", TYPE_SPACE },
+	{ "blank", TYPE_BLANK },
+	{ "punct", TYPE_PUNCT },
+	{ "digit", TYPE_DIGIT },
+	{ "lower", TYPE_LOWER },
+	{ "upper", TYPE_UPPER },
+	{ "alpha", TYPE_ALPHA }
+};
+
+enum EClassificationRules : std::uint8_t
+{
+	CLASSIFICATION_RULES_LEGACY = 0,
+	CLASSIFICATION_RULES_CATEGORY,
+	CLASSIFICATION_RULES_DERIVED
+};
+
+struct Options_t
+{
+	std::string strDirectory;
+	std::string strOutput;
+	std::string strExisting;
+	std::string strLegacy = "tools/unicode-wctype-legacy.txt";
+	EClassificationRules nRules = CLASSIFICATION_RULES_LEGACY;
+	std::uint32_t nPlaneBits = 10U;
+	std::uint32_t nBlockBits = 5U;
+	std::uint32_t nIndexBits = 0U;
+	std::uint8_t uClassMask = 0xFF;
+};
+
+static std::size_t Min(const std::size_t nLeft, const std::size_t nRight)
+{
+	return (nLeft < nRight ? nLeft : nRight);
+}
+
+/// split the line by ';' separator and trim the whitespaces of each field
+static std::vector<std::string_view> SplitFields(std::string_view strLine)
+{
+	std::vector<std::string_view> vecFields;
+
+	while (true)
+	{
+		const std::size_t nSeparator = strLine.find(';');
+		std::string_view strField = strLine.substr(0U, nSeparator);
+
+		while (!strField.empty() && (strField.front() == ' ' || strField.front() == '\t'))
+			strField.remove_prefix(1U);
+		while (!strField.empty() && (strField.back() == ' ' || strField.back() == '\t' || strField.back() == '\r'))
+			strField.remove_suffix(1U);
+
+		vecFields.push_back(strField);
+
+		if (nSeparator == std::string_view::npos)
+			break;
+
+		strLine.remove_prefix(nSeparator + 1U);
+	}
+
+	return vecFields;
+}
+
+static std::uint32_t ParseCodepoint(const std::string_view strCodepoint)
+{
+	return static_cast<std::uint32_t>(std::strtoul(std::string(strCodepoint).c_str(), nullptr, 16));
+}
+
+/// @returns: two letters of general category packed into the single value, e.g. 'Lu'
+static std::uint16_t PackCategory(const std::string_view strCategory)
+{
+	return static_cast<std::uint16_t>(strCategory.size() == 2U ? (static_cast<std::uint8_t>(strCategory[0]) << 8U) | static_cast<std::uint8_t>(strCategory[1]) : 0U);
+}
+
+/// parse 'UnicodeData.txt' and classify codepoints by their general category
+/// @param[out] vecCategories packed general category of each codepoint, unassigned codepoints are left untouched
+/// @returns: true if file has been parsed successfully, false otherwise
+static bool ParseUnicodeData(const std::string& strPath, std::vector<std::uint8_t>& vecTypes, std::vector<std::uint16_t>& vecCategories)
+{
+	std::ifstream file(strPath);
+	if (!file)
+		return false;
+
+	std::uint32_t uRangeFirst = 0U;
+	std::string strLine;
+	while (std::getline(file, strLine))
+	{
+		const std::vector<std::string_view> vecFields = SplitFields(strLine);
+		if (vecFields.size() < 6U)
+			continue;
+
+		const std::uint32_t uCodepoint = ParseCodepoint(vecFields[0]);
+		const std::string_view strName = vecFields[1];
+		const std::string_view strCategory = vecFields[2];
+
+		std::uint8_t uType = 0U;
+		if (strCategory == "Cc" || strCategory == "Cf")
+			uType |= TYPE_CONTROL;
+		if (strCategory == "Zs" || strCategory == "Zl" || strCategory == "Zp" || (uCodepoint >= 0x09 && uCodepoint <= 0x0D) || uCodepoint == 0x85)
+			uType |= TYPE_SPACE;
+		if (uCodepoint == 0x09 || (strCategory == "Zs" && !vecFields[5].starts_with("<noBreak>")))
+			uType |= TYPE_BLANK;
+		if (strCategory.starts_with('P') || strCategory.starts_with('S') || strCategory == "No")
+			uType |= TYPE_PUNCT;
+		if (strCategory == "Nd")
+			uType |= TYPE_DIGIT;
+
+		// replaced by the derived properties when they're requested
+		if (strCategory == "Ll" || strCategory == "Lt")
+			uType |= TYPE_LOWER;
+		if (strCategory == "Lu" || strCategory == "Lt")
+			uType |= TYPE_UPPER;
+		if (strCategory.starts_with('L') || strCategory == "Nl")
+			uType |= TYPE_ALPHA;
+
+		// handle ranges, e.g. "<CJK Ideograph, First>" .. "<CJK Ideograph, Last>"
+		if (strName.ends_with(", First>"))
+			uRangeFirst = uCodepoint;
+		else if (strName.ends_with(", Last>"))
+		{
+			for (std::uint32_t uRangeCodepoint = uRangeFirst; uRangeCodepoint < uCodepoint; ++uRangeCodepoint)
+			{
+				vecTypes[uRangeCodepoint] = uType;
+				vecCategories[uRangeCodepoint] = PackCategory(strCategory);
+			}
+		}
+
+		if (uCodepoint < kCodepointCount)
+		{
+			vecTypes[uCodepoint] = uType;
+			vecCategories[uCodepoint] = PackCategory(strCategory);
+		}
+	}
+
+	return true;
+}
+
+/// parse 'DerivedCoreProperties.txt' and replace case and alphabetic flags with the derived properties
+/// @returns: true if file has been parsed successfully, false otherwise
+static bool ParseDerivedCoreProperties(const std::string& strPath, std::vector<std::uint8_t>& vecTypes)
+{
+	std::ifstream file(strPath);
+	if (!file)
+		return false;
+
+	for (std::uint8_t& uType : vecTypes)
+		uType &= ~(TYPE_LOWER | TYPE_UPPER | TYPE_ALPHA);
+
+	std::string strLine;
+	while (std::getline(file, strLine))
+	{
+		const std::string_view strData = std::string_view(strLine).substr(0U, strLine.find('#'));
+		const std::vector<std::string_view> vecFields = SplitFields(strData);
+		if (vecFields.size() < 2U)
+			continue;
+
+		std::uint8_t uFlag;
+		if (vecFields[1] == "Lowercase")
+			uFlag = TYPE_LOWER;
+		else if (vecFields[1] == "Uppercase")
+			uFlag = TYPE_UPPER;
+		else if (vecFields[1] == "Alphabetic")
+			uFlag = TYPE_ALPHA;
+		else
+			continue;
+
+		// either single codepoint or range "XXXX..YYYY"
+		const std::size_t nRangeSeparator = vecFields[0].find("..");
+		const std::uint32_t uFirst = ParseCodepoint(vecFields[0].substr(0U, nRangeSeparator));
+		const std::uint32_t uLast = (nRangeSeparator != std::string_view::npos ? ParseCodepoint(vecFields[0].substr(nRangeSeparator + 2U)) : uFirst);
+
+		for (std::uint32_t uCodepoint = uFirst; uCodepoint <= uLast && uCodepoint < kCodepointCount; ++uCodepoint)
+			vecTypes[uCodepoint] |= uFlag;
+	}
+
+	return true;
+}
+
+/// parse the legacy BMP types and replace the types of BMP with them
+/// @returns: true if file has been parsed successfully, false otherwise
+static bool ParseLegacyTypes(const std::string& strPath, std::vector<std::uint8_t>& vecTypes)
+{
+	std::ifstream file(strPath);
+	if (!file)
+		return false;
+
+	std::fill(vecTypes.begin(), vecTypes.begin() + kBMPCodepointCount, static_cast<std::uint8_t>(0U));
+
+	std::string strLine;
+	while (std::getline(file, strLine))
+	{
+		const std::string_view strData = std::string_view(strLine).substr(0U, strLine.find('#'));
+		const std::vector<std::string_view> vecFields = SplitFields(strData);
+		if (vecFields.size() < 2U)
+			continue;
+
+		std::uint8_t uType = 0U;
+		std::string_view strClasses = vecFields[1];
+		while (!strClasses.empty())
+		{
+			const std::size_t nSeparator = strClasses.find(' ');
+			const std::string_view strClass = strClasses.substr(0U, nSeparator);
+
+			bool bFound = false;
+			for (const auto& [szName, uFlag] : arrClassNames)
+			{
+				if (strClass == szName)
+				{
+					uType |= uFlag;
+					bFound = true;
+				}
+			}
+
+			if (!bFound)
+			{
+				std::fprintf(stderr, "unknown legacy class: %.*s\n", static_cast<int>(strClass.size()), strClass.data());
+				return false;
+			}
+
+			strClasses.remove_prefix(nSeparator == std::string_view::npos ? strClasses.size() : nSeparator + 1U);
+		}
+
+		// either single codepoint or range "XXXX..YYYY"
+		const std::size_t nRangeSeparator = vecFields[0].find("..");
+		const std::uint32_t uFirst = ParseCodepoint(vecFields[0].substr(0U, nRangeSeparator));
+		const std::uint32_t uLast = (nRangeSeparator != std::string_view::npos ? ParseCodepoint(vecFields[0].substr(nRangeSeparator + 2U)) : uFirst);
+
+		if (uLast >= kBMPCodepointCount || uFirst > uLast)
+		{
+			std::fprintf(stderr, "legacy types must be BMP ranges: %.*s\n", static_cast<int>(vecFields[0].size()), vecFields[0].data());
+			return false;
+		}
+
+		for (std::uint32_t uCodepoint = uFirst; uCodepoint <= uLast; ++uCodepoint)
+			vecTypes[uCodepoint] = uType;
+	}
+
+	return true;
+}
+
+/// classify each supplementary codepoint with the most frequent BMP type of its general category, the smaller type wins on equal frequency
+static void ExtendLegacyTypes(std::vector<std::uint8_t>& vecTypes, const std::vector<std::uint16_t>& vecCategories)
+{
+	std::map<std::uint16_t, std::vector<std::uint32_t>> mapTypeCounts;
+	for (std::uint32_t uChar = 0U; uChar < kBMPCodepointCount; ++uChar)
+	{
+		std::vector<std::uint32_t>& vecCounts = mapTypeCounts[vecCategories[uChar]];
+		vecCounts.resize(256U, 0U);
+		++vecCounts[vecTypes[uChar]];
+	}
+
+	std::map<std::uint16_t, std::uint8_t> mapCategoryTypes;
+	for (const auto& [uCategory, vecCounts] : mapTypeCounts)
+	{
+		std::uint32_t uDominantType = 0U;
+		for (std::uint32_t uType = 1U; uType < 256U; ++uType)
+		{
+			if (vecCounts[uType] > vecCounts[uDominantType])
+				uDominantType = uType;
+		}
+
+		mapCategoryTypes.emplace(uCategory, static_cast<std::uint8_t>(uDominantType));
+	}
+
+	for (std::uint32_t uChar = kBMPCodepointCount; uChar < kCodepointCount; ++uChar)
+	{
+		const auto it = mapCategoryTypes.find(vecCategories[uChar]);
+		vecTypes[uChar] = (it != mapCategoryTypes.end() ? it->second : 0U);
+	}
+}
+
+/// @returns: version string from the header line of UCD file, e.g. "# DerivedCoreProperties-14.0.0.txt", empty string if there is no version
+static std::string ParseVersion(const std::string& strPath)
+{
+	std::ifstream file(strPath);
+	std::string strLine;
+	if (!std::getline(file, strLine))
+		return { };
+
+	const std::size_t nBegin = strLine.find('-');
+	const std::size_t nEnd = strLine.rfind(".txt");
+	if (nBegin == std::string::npos || nEnd == std::string::npos || nEnd <= nBegin)
+		return { };
+
+	return strLine.substr(nBegin + 1U, nEnd - nBegin - 1U);
+}
+
+/// pack the blocks into the single array, reusing any existing equal sequence including the tail of array (sliding window)
+/// @returns: offset of each block in the packed array
+static std::vector<std::uint32_t> PackBlocks(const std::vector<std::vector<std::uint8_t>>& vecBlocks, std::vector<std::uint8_t>& vecPacked)
+{
+	std::map<std::vector<std::uint8_t>, std::uint32_t> mapOffsets;
+	std::vector<std::uint32_t> vecOffsets;
+	vecOffsets.reserve(vecBlocks.size());
+
+	for (const std::vector<std::uint8_t>& vecBlock : vecBlocks)
+	{
+		if (const auto it = mapOffsets.find(vecBlock); it != mapOffsets.end())
+		{
+			vecOffsets.push_back(it->second);
+			continue;
+		}
+
+		const std::size_t nBlockSize = vecBlock.size();
+		std::size_t nOffset = vecPacked.size();
+
+		// search for the whole block inside of already packed data
+		for (std::size_t nPosition = 0U; nPosition + nBlockSize <= vecPacked.size(); ++nPosition)
+		{
+			if (std::memcmp(vecPacked.data() + nPosition, vecBlock.data(), nBlockSize) == 0)
+			{
+				nOffset = nPosition;
+				break;
+			}
+		}
+
+		// otherwise overlap the block prefix with the packed data suffix
+		if (nOffset == vecPacked.size())
+		{
+			std::size_t nOverlap = Min(nBlockSize - 1U, vecPacked.size());
+			while (nOverlap != 0U && std::memcmp(vecPacked.data() + vecPacked.size() - nOverlap, vecBlock.data(), nOverlap) != 0)
+				--nOverlap;
+
+			nOffset = vecPacked.size() - nOverlap;
+			vecPacked.insert(vecPacked.end(), vecBlock.begin() + static_cast<std::ptrdiff_t>(nOverlap), vecBlock.end());
+		}
+
+		mapOffsets.emplace(vecBlock, static_cast<std::uint32_t>(nOffset));
+		vecOffsets.push_back(static_cast<std::uint32_t>(nOffset));
+	}
+
+	return vecOffsets;
+}
+
+template <typename T>
+static void WriteArray(std::ostringstream& stream, const char* szComment, const char* szType, const char* szName, const std::vector<T>& vecValues, const std::size_t nValuesPerLine, const int nDigits)
+{
+	stream << "// " << szComment << "\nconstexpr " << szType << ' ' << szName << '[' << vecValues.size() << "] =\n{\n";
+
+	char szValue[16];
+	for (std::size_t i = 0U; i < vecValues.size(); ++i)
+	{
+		std::snprintf(szValue, sizeof(szValue), "0x%0*X", nDigits, static_cast<unsigned int>(vecValues[i]));
+		stream << ((i % nValuesPerLine) == 0U ? "\t" : " ") << szValue << (i + 1U != vecValues.size() ? "," : "") << ((i % nValuesPerLine) == nValuesPerLine - 1U || i + 1U == vecValues.size() ? "\n" : "");
+	}
+
+	stream << "};\n";
+}
+
+static bool ParseOptions(const int nArgumentCount, char** arrArguments, Options_t& options)
+{
+	for (int i = 1; i < nArgumentCount; ++i)
+	{
+		const std::string_view strArgument = arrArguments[i];
+
+		if (strArgument.size() == 2U && strArgument[0] == '-' && i + 1 < nArgumentCount)
+		{
+			const char* szValue = arrArguments[++i];
+
+			switch (strArgument[1])
+			{
+			case 'o':
+				options.strOutput = szValue;
+				break;
+			case 'v':
+				options.strExisting = szValue;
+				break;
+			case 'r':
+			{
+				const std::string_view strRules = szValue;
+				if (strRules == "legacy")
+					options.nRules = CLASSIFICATION_RULES_LEGACY;
+				else if (strRules == "category")
+					options.nRules = CLASSIFICATION_RULES_CATEGORY;
+				else if (strRules == "derived")
+					options.nRules = CLASSIFICATION_RULES_DERIVED;
+				else
+				{
+					std::fprintf(stderr, "unknown rules: %s\n", szValue);
+					return false;
+				}
+				break;
+			}
+			case 'l':
+				options.strLegacy = szValue;
+				break;
+			case 'p':
+				options.nPlaneBits = static_cast<std::uint32_t>(std::strtoul(szValue, nullptr, 10));
+				break;
+			case 'b':
+				options.nBlockBits = static_cast<std::uint32_t>(std::strtoul(szValue, nullptr, 10));
+				break;
+			case 'i':
+				options.nIndexBits = static_cast<std::uint32_t>(std::strtoul(szValue, nullptr, 10));
+				break;
+			case 'c':
+			{
+				options.uClassMask = 0U;
+
+				std::string_view strClasses = szValue;
+				while (!strClasses.empty())
+				{
+					const std::size_t nSeparator = strClasses.find(',');
+					const std::string_view strClass = strClasses.substr(0U, nSeparator);
+
+					bool bFound = false;
+					for (const auto& [szName, uFlag] : arrClassNames)
+					{
+						if (strClass == szName)
+						{
+							options.uClassMask |= uFlag;
+							bFound = true;
+						}
+					}
+
+					if (!bFound)
+					{
+						std::fprintf(stderr, "unknown class: %.*s\n", static_cast<int>(strClass.size()), strClass.data());
+						return false;
+					}
+
+					strClasses.remove_prefix(nSeparator == std::string_view::npos ? strClasses.size() : nSeparator + 1U);
+				}
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+		else if (options.strDirectory.empty())
+			options.strDirectory = strArgument;
+		else
+			return false;
+	}
+
+	if (options.strDirectory.empty() || (!options.strOutput.empty() && !options.strExisting.empty()) || options.nBlockBits < 1U || options.nPlaneBits <= options.nBlockBits || options.nPlaneBits > 20U)
+		return false;
+
+	return (options.nIndexBits == 0U || options.nIndexBits == 1U || options.nIndexBits == 2U || options.nIndexBits == 4U || options.nIndexBits == 8U);
+}
+
+int main(int nArgumentCount, char** arrArguments)
+{
+	Options_t options;
+	if (!ParseOptions(nArgumentCount, arrArguments, options))
+	{
+		std::fprintf(stderr, "usage: unicode-wctype <ucd-directory> [-o <output>] [-v <existing>] [-r <rules>] [-l <legacy>] [-p <plane bits>] [-b <block bits>] [-i <index bits>] [-c <classes>]\n");
+		return EXIT_FAILURE;
+	}
+
+	// unassigned codepoints have 'Cn' general category
+	std::vector<std::uint8_t> vecTypes(kCodepointCount, 0U);
+	std::vector<std::uint16_t> vecCategories(kCodepointCount, PackCategory("Cn"));
+	if (!ParseUnicodeData(options.strDirectory + "/UnicodeData.txt", vecTypes, vecCategories))
+	{
+		std::fprintf(stderr, "failed to read UnicodeData.txt from: %s\n", options.strDirectory.c_str());
+		return EXIT_FAILURE;
+	}
+
+	const std::string strPropertiesPath = options.strDirectory + "/DerivedCoreProperties.txt";
+	if (options.nRules == CLASSIFICATION_RULES_DERIVED && !ParseDerivedCoreProperties(strPropertiesPath, vecTypes))
+	{
+		std::fprintf(stderr, "failed to read DerivedCoreProperties.txt from: %s\n", options.strDirectory.c_str());
+		return EXIT_FAILURE;
+	}
+
+	if (options.nRules == CLASSIFICATION_RULES_LEGACY)
+	{
+		if (!ParseLegacyTypes(options.strLegacy, vecTypes))
+		{
+			std::fprintf(stderr, "failed to read legacy types from: %s\n", options.strLegacy.c_str());
+			return EXIT_FAILURE;
+		}
+
+		ExtendLegacyTypes(vecTypes, vecCategories);
+	}
+
+	// 'UnicodeData.txt' has no version header, take it from the properties file when it's present
+	const std::string strVersion = ParseVersion(strPropertiesPath);
+
+	for (std::uint8_t& uType : vecTypes)
+		uType &= options.uClassMask;
+
+	// build the palette of distinct type flags
+	std::vector<std::uint8_t> vecPalette;
+	std::uint8_t arrPaletteIndices[256] = { };
+	{
+		bool arrUsed[256] = { };
+		for (const std::uint8_t uType : vecTypes)
+			arrUsed[uType] = true;
+
+		for (std::uint32_t uType = 0U; uType < 256U; ++uType)
+		{
+			if (arrUsed[uType])
+			{
+				arrPaletteIndices[uType] = static_cast<std::uint8_t>(vecPalette.size());
+				vecPalette.push_back(static_cast<std::uint8_t>(uType));
+			}
+		}
+	}
+
+	std::uint32_t nIndexBits = options.nIndexBits;
+	if (nIndexBits == 0U)
+	{
+		nIndexBits = 1U;
+		while ((1U << nIndexBits) < vecPalette.size())
+			nIndexBits <<= 1U;
+	}
+	else if ((1ULL << nIndexBits) < vecPalette.size())
+	{
+		std::fprintf(stderr, "%zu distinct types don't fit into %u index bits\n", vecPalette.size(), nIndexBits);
+		return EXIT_FAILURE;
+	}
+
+	// third stage, blocks of packed type indices
+	const std::uint32_t nBlockSize = 1U << options.nBlockBits;
+	if (nBlockSize * nIndexBits < 8U)
+	{
+		std::fprintf(stderr, "block must hold at least one byte of type indices\n");
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::vector<std::uint8_t>> vecTypeBlocks;
+	for (std::uint32_t uBlockBegin = 0U; uBlockBegin < kCodepointCount; uBlockBegin += nBlockSize)
+	{
+		std::vector<std::uint8_t> vecBlock(nBlockSize * nIndexBits / 8U, 0U);
+		for (std::uint32_t i = 0U; i < nBlockSize; ++i)
+		{
+			const std::uint32_t uPosition = i * nIndexBits;
+			vecBlock[uPosition >> 3U] |= static_cast<std::uint8_t>(arrPaletteIndices[vecTypes[uBlockBegin + i]] << (uPosition & 7U));
+		}
+
+		vecTypeBlocks.push_back(std::move(vecBlock));
+	}
+
+	std::vector<std::uint8_t> vecLUT;
+	const std::vector<std::uint32_t> vecBlockOffsets = PackBlocks(vecTypeBlocks, vecLUT);
+
+	// second stage, blocks of the third stage offsets, deduplicated
+	const std::uint32_t nOffsetsPerPlane = 1U << (options.nPlaneBits - options.nBlockBits);
+	std::map<std::vector<std::uint32_t>, std::uint32_t> mapPlaneIndices;
+	std::vector<std::uint32_t> vecOffsets, vecIndices;
+	for (std::size_t nPlaneBegin = 0U; nPlaneBegin < vecBlockOffsets.size(); nPlaneBegin += nOffsetsPerPlane)
+	{
+		std::vector<std::uint32_t> vecPlane(vecBlockOffsets.begin() + static_cast<std::ptrdiff_t>(nPlaneBegin), vecBlockOffsets.begin() + static_cast<std::ptrdiff_t>(Min(nPlaneBegin + nOffsetsPerPlane, vecBlockOffsets.size())));
+		vecPlane.resize(nOffsetsPerPlane, vecPlane.back());
+
+		const auto [it, bInserted] = mapPlaneIndices.emplace(vecPlane, static_cast<std::uint32_t>(mapPlaneIndices.size()));
+		if (bInserted)
+			vecOffsets.insert(vecOffsets.end(), vecPlane.begin(), vecPlane.end());
+
+		vecIndices.push_back(it->second);
+	}
+
+	// verify the lookup before emitting
+	for (std::uint32_t uChar = 0U; uChar < kCodepointCount; ++uChar)
+	{
+		const std::uint32_t uBlockOffset = vecOffsets[(vecIndices[uChar >> options.nPlaneBits] << (options.nPlaneBits - options.nBlockBits)) + ((uChar >> options.nBlockBits) & (nOffsetsPerPlane - 1U))];
+		const std::uint32_t uPosition = (uChar & (nBlockSize - 1U)) * nIndexBits;
+		const std::uint8_t uType = vecPalette[(vecLUT[uBlockOffset + (uPosition >> 3U)] >> (uPosition & 7U)) & ((1U << nIndexBits) - 1U)];
+
+		if (uType != vecTypes[uChar])
+		{
+			std::fprintf(stderr, "lookup verification failed at U+%04X\n", uChar);
+			return EXIT_FAILURE;
+		}
+	}
+
+	const bool bWideIndices = (mapPlaneIndices.size() > 256U);
+	const bool bWideOffsets = (vecLUT.size() > 0xFFFF);
+	const std::size_t nTotalSize = vecIndices.size() * (bWideIndices ? 2U : 1U) + vecOffsets.size() * (bWideOffsets ? 4U : 2U) + vecLUT.size() + vecPalette.size() + 128U;
+
+	std::ostringstream stream;
+	stream << "#ifndef Q_CRT_STRING_WIDE_IMPLEMENTATION\n#define Q_CRT_STRING_WIDE_IMPLEMENTATION\n";
+	stream << "// autogenerated with 'q-tee/tools/unicode-wctype'" << (strVersion.empty() ? "" : ", Unicode ") << strVersion << '\n';
+	stream << "// @note: three-stage trie of " << nIndexBits << "-bit type indices, block sizes: " << (1U << options.nPlaneBits) << '/' << nBlockSize << ", sliding window size: " << (nBlockSize * nIndexBits / 8U) << ", total size: " << nTotalSize << " bytes\n\n";
+	stream << "enum EWideCharacterTypeFlags_t : std::uint8_t\n{\n";
+	for (std::size_t i = 0U; i < std::size(arrClassNames); ++i)
+	{
+		std::string strName = arrClassNames[i].szName;
+		for (char& chName : strName)
+			chName = static_cast<char>(chName - ('a' - 'A'));
+
+		char szValue[8];
+		std::snprintf(szValue, sizeof(szValue), "0x%02X", arrClassNames[i].uFlag);
+		stream << "\tTYPE_" << strName << " = " << szValue << (i + 1U != std::size(arrClassNames) ? ",\n" : "\n");
+	}
+	stream << "};\n\n";
+
+	stream << "// layout of the lookup tables\n";
+	stream << "constexpr std::uint32_t kWideCharacterTypePlaneShift = " << options.nPlaneBits << "U;\n";
+	stream << "constexpr std::uint32_t kWideCharacterTypeBlockShift = " << options.nBlockBits << "U;\n";
+	stream << "constexpr std::uint32_t kWideCharacterTypeIndexBits = " << nIndexBits << "U;\n\n";
+
+	WriteArray(stream, "mapping of codepoint plane block to the offsets block index", bWideIndices ? "std::uint16_t" : "std::uint8_t", "arrWideCharacterTypeIndices", vecIndices, bWideIndices ? 8U : 16U, bWideIndices ? 4 : 2);
+	stream << '\n';
+	WriteArray(stream, "mapping of codepoint block to lookup table block offset", bWideOffsets ? "std::uint32_t" : "std::uint16_t", "arrWideCharacterTypeOffsets", vecOffsets, 8U, bWideOffsets ? 8 : 4);
+	stream << '\n';
+	WriteArray(stream, "lookup table for packed wide character type indices, lower bits are for lower codepoints", "std::uint8_t", "arrWideCharacterTypeLUT", vecLUT, 16U, 2);
+	stream << '\n';
+	WriteArray(stream, "wide character type flags for the type indices", "std::uint8_t", "arrWideCharacterTypePalette", vecPalette, 16U, 2);
+	stream << '\n';
+	WriteArray(stream, "wide character type flags for ASCII range, to lookup them directly", "std::uint8_t", "arrWideCharacterTypeASCII", std::vector<std::uint8_t>(vecTypes.begin(), vecTypes.begin() + 128), 16U, 2);
+	stream << "#endif\n";
+
+	if (!options.strExisting.empty())
+	{
+		std::ifstream file(options.strExisting, std::ios::binary);
+		const std::string strExisting((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		const std::string strGenerated = stream.str();
+
+		if (!file.is_open() || strExisting != strGenerated)
+		{
+			// report the first line that differs
+			std::size_t nLine = 1U;
+			for (std::size_t i = 0U; i < Min(strExisting.size(), strGenerated.size()) && strExisting[i] == strGenerated[i]; ++i)
+				nLine += (strGenerated[i] == '\n');
+
+			std::fprintf(stderr, "%s differs from the generated output at line %zu\n", options.strExisting.c_str(), nLine);
+			return EXIT_FAILURE;
+		}
+
+		std::fprintf(stderr, "%s is identical to the generated output\n", options.strExisting.c_str());
+	}
+	else if (options.strOutput.empty())
+		std::fputs(stream.str().c_str(), stdout);
+	else
+	{
+		std::ofstream file(options.strOutput, std::ios::binary);
+		if (!(file << stream.str()))
+		{
+			std::fprintf(stderr, "failed to write: %s\n", options.strOutput.c_str());
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::fprintf(stderr, "distinct types: %zu, indices: %zu, offsets: %zu, lut: %zu, total: %zu bytes\n", vecPalette.size(), vecIndices.size(), vecOffsets.size(), vecLUT.size(), nTotalSize);
+	return EXIT_SUCCESS;
+}